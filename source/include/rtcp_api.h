@@ -18,6 +18,26 @@ RtcpResult_t Rtcp_SerializeReceiverReport( RtcpContext_t * pCtx,
                                            uint8_t * pBuffer,
                                            size_t * pBufferLength );
 
+/* Serializes a NACK packet from its sequence number list, which must be in
+ * order, and may wrap around. The sequence numbers are packed into the fewest
+ * PID and BLP entries. */
+RtcpResult_t Rtcp_SerializeNackPacket( RtcpContext_t * pCtx,
+                                       const RtcpNackPacket_t * pNackPacket,
+                                       uint8_t * pBuffer,
+                                       size_t * pBufferLength );
+
+/* Serializes a TWCC packet from its arrival info list, which has one entry
+ * per packet from the base sequence number, in order. The packet status count
+ * is the list length, the sequence numbers in the list are not used, and
+ * packets not received have the remote arrival time
+ * RTCP_TWCC_PACKET_LOST_TIME. The packet chunks are encoded to take the
+ * fewest bytes. Returns RTCP_RESULT_BAD_PARAM if a receive delta does not fit
+ * in 16 bits, i.e. packets more than 8 seconds apart. */
+RtcpResult_t Rtcp_SerializeTwccPacket( RtcpContext_t * pCtx,
+                                       const RtcpTwccPacket_t * pTwccPacket,
+                                       uint8_t * pBuffer,
+                                       size_t * pBufferLength );
+
 RtcpResult_t Rtcp_DeserializePacket( RtcpContext_t * pCtx,
                                      const uint8_t * pSerializedPacket,
                                      size_t serializedPacketLength,
@@ -51,10 +71,41 @@ RtcpResult_t Rtcp_ParseNackPacket( RtcpContext_t * pCtx,
                                    const RtcpPacket_t * pRtcpPacket,
                                    RtcpNackPacket_t * pNackPacket );
 
+/* Parses a NACK packet into its PID and BLP entries, with no expansion into
+ * sequence numbers. A NULL FCI list only counts the entries. On
+ * RTCP_RESULT_OUT_OF_MEMORY, the FCI list length is the number of entries. */
+RtcpResult_t Rtcp_ParseNackPacketFcis( RtcpContext_t * pCtx,
+                                       const RtcpPacket_t * pRtcpPacket,
+                                       RtcpNackFciPacket_t * pNackFciPacket );
+
+/* On RTCP_RESULT_OUT_OF_MEMORY, the arrival info list holds the arrival
+ * infos which fit, with their arrival times, and its length is their count. */
 RtcpResult_t Rtcp_ParseTwccPacket( RtcpContext_t * pCtx,
                                    const RtcpPacket_t * pRtcpPacket,
                                    RtcpTwccPacket_t * pTwccPacket );
 
+/* Parses a TWCC packet into runs of received and not received packets, and
+ * the arrival times of the received packets. Adjacent chunks with the same
+ * status are merged into one run, so that a long loss burst is one entry.
+ * A NULL run list or arrival time list only counts the entries. As in
+ * Rtcp_ParseTwccPacket, a run length chunk reports its whole run, even past
+ * the packet status count. */
+RtcpResult_t Rtcp_ParseTwccPacketRuns( RtcpContext_t * pCtx,
+                                       const RtcpPacket_t * pRtcpPacket,
+                                       RtcpTwccRunsPacket_t * pTwccRunsPacket );
+
+/* Decodes the arrival infos of a TWCC packet straight into the visitor, in
+ * batches of RTCP_TWCC_VISITOR_BATCH_LENGTH, with no caller provided list.
+ * The arrival infos are the same as Rtcp_ParseTwccPacket gives. The packet is
+ * validated first, so the visitor is not called for a malformed packet. On
+ * return, the arrival info list length of pTwccPacket is the number of
+ * arrival infos visited. */
+RtcpResult_t Rtcp_VisitTwccPacket( RtcpContext_t * pCtx,
+                                   const RtcpPacket_t * pRtcpPacket,
+                                   RtcpTwccPacket_t * pTwccPacket,
+                                   RtcpTwccArrivalVisitor_t visitor,
+                                   void * pUserData );
+
 /*-----------------------------------------------------------*/
 
 #endif /* RTCP_API_H */
@@ -356,6 +356,24 @@ typedef struct RtcpNackPacket
     size_t seqNumListLength;
 } RtcpNackPacket_t;
 
+/* A PID and BLP entry of a NACK packet. Sequence number pid is lost, and so
+ * is pid + i + 1 for each bit i set in blp. */
+typedef struct RtcpNackFci
+{
+    uint16_t pid;
+    uint16_t blp;
+} RtcpNackFci_t;
+
+/* NACK packet parsed by Rtcp_ParseNackPacketFcis, with the PID and BLP
+ * entries as they are in the packet instead of a sequence number each. */
+typedef struct RtcpNackFciPacket
+{
+    uint32_t senderSsrc;
+    uint32_t mediaSourceSsrc;
+    RtcpNackFci_t * pFciList;
+    size_t fciListLength;
+} RtcpNackFciPacket_t;
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -407,6 +425,43 @@ typedef struct RtcpTwccPacket
     size_t arrivalInfoListLength;
 } RtcpTwccPacket_t;
 
+/* Consecutive packets that were all received, or all not received. */
+typedef struct TwccPacketRun
+{
+    uint16_t startSeqNum;
+    uint16_t length;
+    uint8_t received;
+} TwccPacketRun_t;
+
+/* TWCC packet parsed by Rtcp_ParseTwccPacketRuns. Instead of an arrival info
+ * per packet, the packets are described by runs, and the remote arrival times
+ * of the received packets are in a separate list, in sequence number order. */
+typedef struct RtcpTwccRunsPacket
+{
+    uint32_t senderSsrc;
+    uint32_t mediaSourceSsrc;
+    uint16_t baseSeqNum;
+    uint16_t packetStatusCount;
+    uint32_t referenceTime;
+    uint8_t feedbackPacketCount;
+    TwccPacketRun_t * pRunList;
+    size_t runListLength;
+    uint64_t * pArrivalTimeList;
+    size_t arrivalTimeListLength;
+} RtcpTwccRunsPacket_t;
+
+/* Number of arrival infos Rtcp_VisitTwccPacket passes to the visitor at once.
+ * The batch is on the stack. */
+#ifndef RTCP_TWCC_VISITOR_BATCH_LENGTH
+    #define RTCP_TWCC_VISITOR_BATCH_LENGTH    32
+#endif
+
+/* Called by Rtcp_VisitTwccPacket with consecutive batches of arrival infos.
+ * The batch is only valid during the call. */
+typedef void ( * RtcpTwccArrivalVisitor_t ) ( void * pUserData,
+                                              const PacketArrivalInfo_t * pArrivalInfos,
+                                              size_t arrivalInfosLength );
+
 /*-----------------------------------------------------------*/
 
 #endif /* RTCP_DATA_TYPES_H */
@@ -0,0 +1,120 @@
+#ifndef RTCP_DELAY_BASED_ESTIMATOR_H
+#define RTCP_DELAY_BASED_ESTIMATOR_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Delay based bandwidth estimator modelled after Google Congestion Control
+ * (draft-ietf-rmcat-gcc-02). Packets are grouped into bursts, the variation
+ * of the inter-group delay is smoothed with a trendline filter, an adaptive
+ * threshold detects overuse and an AIMD controller adjusts the target bitrate.
+ *
+ * All times are in 100s of nanoseconds, same as the TWCC manager. The filter
+ * and the detector use fixed point arithmetic: delays, the trend and the
+ * threshold are Q16 values, i.e. in 1/65536 ms or ms per ms.
+ */
+
+/* Packets sent within this duration belong to the same group. */
+#define RTCP_DELAY_BASED_ESTIMATOR_BURST_TIME                   ( 5 * 10000 )
+
+/* Number of (arrival time, smoothed delay) samples used for the trendline. */
+#define RTCP_DELAY_BASED_ESTIMATOR_TRENDLINE_WINDOW_LENGTH      20
+
+/* Duration over which the acknowledged bitrate is measured. */
+#define RTCP_DELAY_BASED_ESTIMATOR_ACKED_BITRATE_WINDOW         ( 500 * 10000 )
+
+/*-----------------------------------------------------------*/
+
+typedef enum RtcpDelayBasedEstimatorResult
+{
+    RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+    RTCP_DELAY_BASED_ESTIMATOR_RESULT_BAD_PARAM
+} RtcpDelayBasedEstimatorResult_t;
+
+typedef enum RtcpBandwidthUsage
+{
+    RTCP_BANDWIDTH_USAGE_NORMAL,
+    RTCP_BANDWIDTH_USAGE_UNDERUSING,
+    RTCP_BANDWIDTH_USAGE_OVERUSING
+} RtcpBandwidthUsage_t;
+
+typedef enum RtcpRateControlState
+{
+    RTCP_RATE_CONTROL_STATE_HOLD,
+    RTCP_RATE_CONTROL_STATE_INCREASE,
+    RTCP_RATE_CONTROL_STATE_DECREASE
+} RtcpRateControlState_t;
+
+typedef struct RtcpPacketGroup
+{
+    uint64_t firstSentTime;
+    uint64_t lastSentTime;
+    uint64_t lastArrivalTime;
+    size_t size;
+} RtcpPacketGroup_t;
+
+typedef struct RtcpDelayBasedEstimator
+{
+    /* Inter-arrival. */
+    RtcpPacketGroup_t currentGroup;
+    RtcpPacketGroup_t previousGroup;
+    uint8_t currentGroupValid;
+    uint8_t previousGroupValid;
+
+    /* Trendline filter. */
+    int64_t accumulatedDelay;
+    int64_t smoothedDelay;                                                           /* Q16 ms. */
+    int64_t arrivalTimeWindow[ RTCP_DELAY_BASED_ESTIMATOR_TRENDLINE_WINDOW_LENGTH ]; /* In 1/16 ms. */
+    int64_t smoothedDelayWindow[ RTCP_DELAY_BASED_ESTIMATOR_TRENDLINE_WINDOW_LENGTH ];
+    size_t windowIndex;
+    size_t windowCount;
+    uint64_t firstArrivalTime;
+    uint32_t numDeltas;
+    int64_t trend; /* Q16. */
+    int64_t previousTrend;
+
+    /* Overuse detector. */
+    int64_t threshold; /* Q16 ms. */
+    uint64_t lastThresholdUpdateTime;
+    int64_t timeOverUsing; /* Negative when not overusing. */
+    uint32_t overuseCounter;
+    RtcpBandwidthUsage_t bandwidthUsage;
+
+    /* Acknowledged bitrate. */
+    uint64_t ackedWindowStartTime;
+    size_t ackedWindowBytes;
+    uint8_t ackedWindowStarted;
+    uint32_t ackedBitrateBps;
+
+    /* AIMD rate controller. */
+    RtcpRateControlState_t rateControlState;
+    uint64_t lastRateUpdateTime;
+    uint32_t targetBitrateBps;
+    uint32_t minBitrateBps;
+    uint32_t maxBitrateBps;
+} RtcpDelayBasedEstimator_t;
+
+/*-----------------------------------------------------------*/
+
+RtcpDelayBasedEstimatorResult_t RtcpDelayBasedEstimator_Init( RtcpDelayBasedEstimator_t * pEstimator,
+                                                              uint32_t initialBitrateBps,
+                                                              uint32_t minBitrateBps,
+                                                              uint32_t maxBitrateBps );
+
+/* Must be called for every received packet, in the order of transport wide
+ * sequence numbers. Lost packets must not be reported. */
+RtcpDelayBasedEstimatorResult_t RtcpDelayBasedEstimator_AddPacketFeedback( RtcpDelayBasedEstimator_t * pEstimator,
+                                                                           uint64_t localSentTime,
+                                                                           uint64_t remoteArrivalTime,
+                                                                           size_t packetSize );
+
+RtcpDelayBasedEstimatorResult_t RtcpDelayBasedEstimator_GetTargetBitrate( const RtcpDelayBasedEstimator_t * pEstimator,
+                                                                          uint32_t * pTargetBitrateBps );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTCP_DELAY_BASED_ESTIMATOR_H */
@@ -0,0 +1,83 @@
+#ifndef RTCP_LOSS_BASED_ESTIMATOR_H
+#define RTCP_LOSS_BASED_ESTIMATOR_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/* API includes. */
+#include "rtcp_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Loss based bandwidth estimator. Each TWCC packet and each reception report
+ * provides a loss sample, expressed like the fraction lost field of a
+ * reception report, i.e. as a fixed point number with the binary point at
+ * the left edge of 8 bits. The target bitrate is:
+ *  - increased by 8% when the loss is below 2% and no burst of lost packets
+ *    was seen in the TWCC packet,
+ *  - held when the loss is between 2% and 10%,
+ *  - decreased by half of the loss when the loss is above 10%.
+ *
+ * All times are in 100s of nanoseconds.
+ */
+
+/* Loss thresholds, as fractions of 256. */
+#define RTCP_LOSS_BASED_ESTIMATOR_LOW_LOSS_THRESHOLD         5  /* ~2% */
+#define RTCP_LOSS_BASED_ESTIMATOR_HIGH_LOSS_THRESHOLD        26 /* ~10% */
+
+/* A run of at least these many lost packets in a TWCC packet indicates a
+ * queue overflow, even when the overall loss is low. */
+#define RTCP_LOSS_BASED_ESTIMATOR_BURST_LOSS_RUN_LENGTH      8
+
+/* Minimum durations between two increases and two decreases. */
+#define RTCP_LOSS_BASED_ESTIMATOR_INCREASE_INTERVAL          ( 1000 * 10000 )
+#define RTCP_LOSS_BASED_ESTIMATOR_DECREASE_INTERVAL          ( 300 * 10000 )
+
+/*-----------------------------------------------------------*/
+
+typedef enum RtcpLossBasedEstimatorResult
+{
+    RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+    RTCP_LOSS_BASED_ESTIMATOR_RESULT_BAD_PARAM
+} RtcpLossBasedEstimatorResult_t;
+
+typedef struct RtcpLossBasedEstimator
+{
+    uint32_t targetBitrateBps;
+    uint32_t minBitrateBps;
+    uint32_t maxBitrateBps;
+    uint64_t lastIncreaseTime;
+    uint64_t lastDecreaseTime;
+
+    /* Last loss sample. */
+    uint8_t fractionLost;
+
+    /* From the last TWCC packet. */
+    size_t longestLostRun;
+} RtcpLossBasedEstimator_t;
+
+/*-----------------------------------------------------------*/
+
+RtcpLossBasedEstimatorResult_t RtcpLossBasedEstimator_Init( RtcpLossBasedEstimator_t * pEstimator,
+                                                            uint32_t initialBitrateBps,
+                                                            uint32_t minBitrateBps,
+                                                            uint32_t maxBitrateBps );
+
+/* Takes a loss sample from the arrival infos of a parsed TWCC packet. */
+RtcpLossBasedEstimatorResult_t RtcpLossBasedEstimator_AddTwccPacket( RtcpLossBasedEstimator_t * pEstimator,
+                                                                     const RtcpTwccPacket_t * pTwccPacket,
+                                                                     uint64_t currentTime );
+
+/* Takes a loss sample from the fraction lost of a parsed reception report. */
+RtcpLossBasedEstimatorResult_t RtcpLossBasedEstimator_AddReceptionReport( RtcpLossBasedEstimator_t * pEstimator,
+                                                                          const RtcpReceptionReport_t * pReceptionReport,
+                                                                          uint64_t currentTime );
+
+RtcpLossBasedEstimatorResult_t RtcpLossBasedEstimator_GetTargetBitrate( const RtcpLossBasedEstimator_t * pEstimator,
+                                                                        uint32_t * pTargetBitrateBps );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTCP_LOSS_BASED_ESTIMATOR_H */
@@ -0,0 +1,100 @@
+#ifndef RTCP_NACK_GENERATOR_H
+#define RTCP_NACK_GENERATOR_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/* API includes. */
+#include "rtcp_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Receive side tracker of lost RTP packets, from which NACK packets are sent
+ * back to the sender. Received sequence numbers are kept in a caller provided
+ * bitmap, which slides with the highest sequence number received. Sequence
+ * numbers skipped over are added to a caller provided list of lost packets,
+ * and are NACKed until they are received, leave the bitmap window, or were
+ * NACKed too many times. A lost packet is NACKed again at most once per round
+ * trip time. The NACK packet is serialized with Rtcp_SerializeNackPacket. All
+ * times are in hundreds of nanoseconds.
+ */
+
+/*-----------------------------------------------------------*/
+
+typedef enum RtcpNackGeneratorResult
+{
+    RTCP_NACK_GENERATOR_RESULT_OK,
+    RTCP_NACK_GENERATOR_RESULT_BAD_PARAM,
+    RTCP_NACK_GENERATOR_RESULT_EMPTY,
+    RTCP_NACK_GENERATOR_RESULT_FULL
+} RtcpNackGeneratorResult_t;
+
+/*-----------------------------------------------------------*/
+
+typedef struct RtcpNackGeneratorLostPacket
+{
+    uint64_t lastNackTime;
+    uint16_t seqNum;
+    uint8_t nackCount;
+} RtcpNackGeneratorLostPacket_t;
+
+typedef struct RtcpNackGenerator
+{
+    uint32_t * pReceivedBitmap;
+    size_t receivedBitmapLength; /* In 32 bit words. */
+    RtcpNackGeneratorLostPacket_t * pLostPacketArray;
+    size_t lostPacketArrayLength;
+    size_t lostPacketHead;
+    size_t lostPacketCount;
+    uint16_t highestSeqNum;
+    uint8_t highestSeqNumValid;
+    uint64_t roundTripTime;
+    uint64_t minNackInterval;
+    uint8_t maxNackCount;
+} RtcpNackGenerator_t;
+
+/*-----------------------------------------------------------*/
+
+/* The received bitmap length is in 32 bit words, and must be a power of two,
+ * up to 1024, i.e. a window of up to 32768 sequence numbers. Lost packets are
+ * NACKed at most 10 times, and again after a round trip time of 100ms until
+ * RtcpNackGenerator_UpdateRoundTripTime is called. */
+RtcpNackGeneratorResult_t RtcpNackGenerator_Init( RtcpNackGenerator_t * pNackGenerator,
+                                                  uint32_t * pReceivedBitmap,
+                                                  size_t receivedBitmapLength,
+                                                  RtcpNackGeneratorLostPacket_t * pLostPacketArray,
+                                                  size_t lostPacketArrayLength );
+
+/* Sets the minimum time before a lost packet is NACKed again, used when the
+ * round trip time is shorter, and the maximum number of NACKs of a lost
+ * packet. */
+RtcpNackGeneratorResult_t RtcpNackGenerator_SetRetryLimit( RtcpNackGenerator_t * pNackGenerator,
+                                                           uint64_t minNackInterval,
+                                                           uint8_t maxNackCount );
+
+RtcpNackGeneratorResult_t RtcpNackGenerator_UpdateRoundTripTime( RtcpNackGenerator_t * pNackGenerator,
+                                                                 uint64_t roundTripTime );
+
+/* Records a received packet. Packets further behind the highest sequence
+ * number than the bitmap window are ignored. Returns
+ * RTCP_NACK_GENERATOR_RESULT_FULL if the packet was recorded, but the oldest
+ * lost packets were given up to make room in the lost packet list, in which
+ * case the caller may want to request a key frame instead. */
+RtcpNackGeneratorResult_t RtcpNackGenerator_RecordPacket( RtcpNackGenerator_t * pNackGenerator,
+                                                          uint16_t seqNum );
+
+/* Fills the NACK packet, except for the SSRCs, with the lost packets due for
+ * a NACK at the current time, and counts them as NACKed. The sequence number
+ * list of the NACK packet is pSeqNumList, in increasing order. Returns
+ * RTCP_NACK_GENERATOR_RESULT_EMPTY if no packet is due. */
+RtcpNackGeneratorResult_t RtcpNackGenerator_GetNackPacket( RtcpNackGenerator_t * pNackGenerator,
+                                                           uint64_t currentTime,
+                                                           uint16_t * pSeqNumList,
+                                                           size_t seqNumListLength,
+                                                           RtcpNackPacket_t * pNackPacket );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTCP_NACK_GENERATOR_H */
@@ -0,0 +1,81 @@
+#ifndef RTCP_RECEIVER_STATISTICS_H
+#define RTCP_RECEIVER_STATISTICS_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/* API includes. */
+#include "rtcp_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Receive side statistics of an RTP source, from which the reception report
+ * blocks of SR and RR packets are filled. The sequence number validation, the
+ * loss and the jitter follow the algorithms of RFC 3550 Appendix A.1, A.3 and
+ * A.8, in integer arithmetic, in constant time per packet. A source is on
+ * probation until two packets with consecutive sequence numbers are
+ * received.
+ *
+ * RFC - https://datatracker.ietf.org/doc/html/rfc3550#appendix-A.1
+ */
+
+/*-----------------------------------------------------------*/
+
+typedef enum RtcpReceiverStatisticsResult
+{
+    RTCP_RECEIVER_STATISTICS_RESULT_OK,
+    RTCP_RECEIVER_STATISTICS_RESULT_BAD_PARAM,
+    RTCP_RECEIVER_STATISTICS_RESULT_INVALID_PACKET,
+    RTCP_RECEIVER_STATISTICS_RESULT_EMPTY
+} RtcpReceiverStatisticsResult_t;
+
+/*-----------------------------------------------------------*/
+
+typedef struct RtcpReceiverStatistics
+{
+    uint32_t sourceSsrc;
+    uint32_t clockRate;
+    uint64_t firstArrivalTime;
+    uint16_t maxSeq;
+    uint32_t cycles; /* Shifted count of sequence number cycles. */
+    uint32_t baseSeq;
+    uint32_t badSeq;
+    uint8_t probation;
+    uint8_t firstPacketReceived;
+    uint32_t received;
+    uint32_t expectedPrior;
+    uint32_t receivedPrior;
+    uint32_t transit;
+    uint8_t transitValid;
+    uint32_t jitter; /* In 1/16 RTP timestamp units. */
+} RtcpReceiverStatistics_t;
+
+/*-----------------------------------------------------------*/
+
+/* The clock rate is that of the RTP timestamps of the source, e.g. 90000 for
+ * video. */
+RtcpReceiverStatisticsResult_t RtcpReceiverStatistics_Init( RtcpReceiverStatistics_t * pReceiverStatistics,
+                                                            uint32_t sourceSsrc,
+                                                            uint32_t clockRate );
+
+/* Updates the statistics with a received RTP packet. The arrival time is in
+ * hundreds of nanoseconds. Returns
+ * RTCP_RECEIVER_STATISTICS_RESULT_INVALID_PACKET if the packet is not counted,
+ * while the source is on probation or after a large sequence number jump,
+ * in which case RFC 3550 suggests not to process it further. */
+RtcpReceiverStatisticsResult_t RtcpReceiverStatistics_UpdatePacket( RtcpReceiverStatistics_t * pReceiverStatistics,
+                                                                    uint16_t seqNum,
+                                                                    uint32_t rtpTimestamp,
+                                                                    uint64_t arrivalTime );
+
+/* Fills the reception report, except for the LSR and DLSR fields, and starts
+ * the interval of the fraction lost of the next one. Returns
+ * RTCP_RECEIVER_STATISTICS_RESULT_EMPTY if no valid packet was received. */
+RtcpReceiverStatisticsResult_t RtcpReceiverStatistics_GetReceptionReport( RtcpReceiverStatistics_t * pReceiverStatistics,
+                                                                          RtcpReceptionReport_t * pReceptionReport );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTCP_RECEIVER_STATISTICS_H */
@@ -0,0 +1,102 @@
+#ifndef RTCP_REPORT_SCHEDULER_H
+#define RTCP_REPORT_SCHEDULER_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/* API includes. */
+#include "rtcp_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Scheduler of the SR and RR packets of a participant, which keeps the RTCP
+ * traffic of the session at 5% of the session bandwidth, with 1/4 of it for
+ * the senders when they are few. The report interval grows with the number
+ * of members and the average RTCP packet size, is at least 5 seconds, or 2.5
+ * seconds before the first report, and is randomized between 0.5 and 1.5
+ * times its value. When a report is due, the interval is computed again with
+ * the current number of members, and the report is postponed if it grew
+ * (timer reconsideration). When members leave, the next report is brought
+ * forward (reverse reconsideration). The caller provides a uniformly
+ * distributed 32 bit random value for each interval. All times are in
+ * hundreds of nanoseconds.
+ *
+ * RFC - https://datatracker.ietf.org/doc/html/rfc3550#section-6.3
+ */
+
+/*-----------------------------------------------------------*/
+
+typedef enum RtcpReportSchedulerResult
+{
+    RTCP_REPORT_SCHEDULER_RESULT_OK,
+    RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM
+} RtcpReportSchedulerResult_t;
+
+typedef enum RtcpScheduledReport
+{
+    RTCP_SCHEDULED_REPORT_NONE,
+    RTCP_SCHEDULED_REPORT_SENDER_REPORT,
+    RTCP_SCHEDULED_REPORT_RECEIVER_REPORT
+} RtcpScheduledReport_t;
+
+/*-----------------------------------------------------------*/
+
+typedef struct RtcpReportScheduler
+{
+    uint64_t rtcpBandwidth; /* In bytes per second. */
+    uint64_t previousReportTime;
+    uint64_t nextReportTime;
+    uint32_t members;
+    uint32_t previousMembers;
+    uint32_t senders;
+    uint32_t averagePacketSize; /* In 1/16 bytes. */
+    uint8_t initial;
+    uint8_t rtpSentSinceReport;
+    uint8_t rtpSentBeforeReport;
+} RtcpReportScheduler_t;
+
+/*-----------------------------------------------------------*/
+
+/* Schedules the first report of a participant joining the session at the
+ * current time. The session bandwidth is in bits per second. */
+RtcpReportSchedulerResult_t RtcpReportScheduler_Init( RtcpReportScheduler_t * pReportScheduler,
+                                                      uint64_t sessionBandwidthBps,
+                                                      uint64_t currentTime,
+                                                      uint32_t randomValue );
+
+/* Records that an RTP packet was sent, so that SR packets are sent until two
+ * reports without RTP packets sent. */
+RtcpReportSchedulerResult_t RtcpReportScheduler_RecordRtpPacketSent( RtcpReportScheduler_t * pReportScheduler );
+
+/* Records the size of a sent or received compound RTCP packet, including the
+ * UDP and IP headers, into the average RTCP packet size. */
+RtcpReportSchedulerResult_t RtcpReportScheduler_RecordRtcpPacket( RtcpReportScheduler_t * pReportScheduler,
+                                                                  size_t packetSize );
+
+/* Updates the number of members of the session, including the local
+ * participant, and the number of senders among them. If members left, the
+ * next report is brought forward. */
+RtcpReportSchedulerResult_t RtcpReportScheduler_UpdateMembers( RtcpReportScheduler_t * pReportScheduler,
+                                                               uint32_t members,
+                                                               uint32_t senders,
+                                                               uint64_t currentTime );
+
+/* Called at the next report time, or later. The scheduled report is set to
+ * the report to serialize and send now, with Rtcp_SerializeSenderReport or
+ * Rtcp_SerializeReceiverReport, and the next one is scheduled, or to
+ * RTCP_SCHEDULED_REPORT_NONE if the report is not due yet or was
+ * postponed. */
+RtcpReportSchedulerResult_t RtcpReportScheduler_CheckReport( RtcpReportScheduler_t * pReportScheduler,
+                                                             uint64_t currentTime,
+                                                             uint32_t randomValue,
+                                                             RtcpScheduledReport_t * pScheduledReport );
+
+/* The time at which RtcpReportScheduler_CheckReport should be called next. */
+RtcpReportSchedulerResult_t RtcpReportScheduler_GetNextReportTime( const RtcpReportScheduler_t * pReportScheduler,
+                                                                   uint64_t * pNextReportTime );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTCP_REPORT_SCHEDULER_H */
@@ -0,0 +1,106 @@
+#ifndef RTCP_RETRANSMISSION_HISTORY_H
+#define RTCP_RETRANSMISSION_HISTORY_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/* API includes. */
+#include "rtcp_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Send side history of recently sent RTP packets, which answers NACK packets
+ * with the packets to resend. The history keeps references to the caller's
+ * packet buffers, in a caller provided array of slots indexed by sequence
+ * number, so that a packet is replaced by the one sent a slot array length
+ * later. All times are in hundreds of nanoseconds.
+ */
+
+/*-----------------------------------------------------------*/
+
+typedef enum RtcpRetransmissionHistoryResult
+{
+    RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+    RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+    RTCP_RETRANSMISSION_HISTORY_RESULT_FULL
+} RtcpRetransmissionHistoryResult_t;
+
+/*-----------------------------------------------------------*/
+
+/* A sent RTP packet. The packet buffer is owned by the caller, and must stay
+ * valid until the packet is evicted from the history. */
+typedef struct RtcpRetransmissionPacket
+{
+    const uint8_t * pPacket;
+    size_t packetLength;
+    uint64_t lastSentTime;
+    uint16_t seqNum;
+    uint8_t resendCount;
+} RtcpRetransmissionPacket_t;
+
+typedef struct RtcpRetransmissionHistory
+{
+    RtcpRetransmissionPacket_t * pPacketArray;
+    size_t packetArrayLength;
+    uint64_t minResendInterval;
+    uint8_t maxResendCount;
+    uint64_t maxResendBytesPerSecond;
+    uint64_t resendBytesBudget;
+    uint64_t lastBudgetUpdateTime;
+} RtcpRetransmissionHistory_t;
+
+/*-----------------------------------------------------------*/
+
+/* The packet array length must be a power of two, up to 32768. Packets are
+ * resent at most once per 10ms and 10 times, with no rate limit, until
+ * RtcpRetransmissionHistory_SetRateLimit is called. */
+RtcpRetransmissionHistoryResult_t RtcpRetransmissionHistory_Init( RtcpRetransmissionHistory_t * pHistory,
+                                                                  RtcpRetransmissionPacket_t * pPacketArray,
+                                                                  size_t packetArrayLength );
+
+/* Sets the minimum time between two sends of a packet, e.g. the round trip
+ * time, the maximum number of resends of a packet, which must not be 0, and
+ * the maximum resent bytes per second, with a burst of up to one second. A
+ * maximum of 0 bytes per second is no limit. */
+RtcpRetransmissionHistoryResult_t RtcpRetransmissionHistory_SetRateLimit( RtcpRetransmissionHistory_t * pHistory,
+                                                                          uint64_t minResendInterval,
+                                                                          uint8_t maxResendCount,
+                                                                          uint64_t maxResendBytesPerSecond );
+
+/* Adds a sent packet. If pEvictedPacket is not NULL, it is given the packet
+ * replaced by this one, with a NULL packet buffer if the slot was empty, so
+ * that the caller can release its buffer. */
+RtcpRetransmissionHistoryResult_t RtcpRetransmissionHistory_AddPacket( RtcpRetransmissionHistory_t * pHistory,
+                                                                       uint16_t seqNum,
+                                                                       const uint8_t * pPacket,
+                                                                       size_t packetLength,
+                                                                       uint64_t sentTime,
+                                                                       RtcpRetransmissionPacket_t * pEvictedPacket );
+
+/* Finds the packets to resend for a NACK packet parsed with
+ * Rtcp_ParseNackPacket, and counts them as resent at the current time. The
+ * resend list is given pointers to the packets in the history, valid until
+ * the next packet is added. Packets no longer in the history, resent too
+ * recently or too often, or over the rate limit are skipped. On input,
+ * *pResendListLength is the length of the resend list, and on output the
+ * number of packets to resend. Returns RTCP_RETRANSMISSION_HISTORY_RESULT_FULL
+ * if the resend list was filled before all the packets were handled. */
+RtcpRetransmissionHistoryResult_t RtcpRetransmissionHistory_HandleNackPacket( RtcpRetransmissionHistory_t * pHistory,
+                                                                              const RtcpNackPacket_t * pNackPacket,
+                                                                              uint64_t currentTime,
+                                                                              RtcpRetransmissionPacket_t ** ppResendList,
+                                                                              size_t * pResendListLength );
+
+/* Same as RtcpRetransmissionHistory_HandleNackPacket, for a NACK packet
+ * parsed with Rtcp_ParseNackPacketFcis. */
+RtcpRetransmissionHistoryResult_t RtcpRetransmissionHistory_HandleNackFciPacket( RtcpRetransmissionHistory_t * pHistory,
+                                                                                 const RtcpNackFciPacket_t * pNackFciPacket,
+                                                                                 uint64_t currentTime,
+                                                                                 RtcpRetransmissionPacket_t ** ppResendList,
+                                                                                 size_t * pResendListLength );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTCP_RETRANSMISSION_HISTORY_H */
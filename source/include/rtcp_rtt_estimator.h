@@ -0,0 +1,90 @@
+#ifndef RTCP_RTT_ESTIMATOR_H
+#define RTCP_RTT_ESTIMATOR_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/* API includes. */
+#include "rtcp_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Send side round trip time estimator, from the LSR and DLSR fields of the
+ * reception reports about our stream. The estimator keeps the compact NTP
+ * time and the local send time of the recently sent SR packets in a caller
+ * provided array, so that an echoed LSR is matched to the SR it refers to,
+ * and the round trip time is the time since that SR was sent, minus the
+ * DLSR. The smoothed round trip time is the exponentially weighted moving
+ * average of the samples, with a weight of 1/8, as in RFC 6298. All times
+ * are in hundreds of nanoseconds.
+ *
+ * RFC - https://datatracker.ietf.org/doc/html/rfc3550#section-6.4.1
+ */
+
+/*-----------------------------------------------------------*/
+
+typedef enum RtcpRttEstimatorResult
+{
+    RTCP_RTT_ESTIMATOR_RESULT_OK,
+    RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM,
+    RTCP_RTT_ESTIMATOR_RESULT_EMPTY
+} RtcpRttEstimatorResult_t;
+
+/*-----------------------------------------------------------*/
+
+typedef struct RtcpRttEstimatorSenderReport
+{
+    uint64_t sentTime;
+    uint32_t compactNtpTime; /* The middle 32 bits of the NTP time. */
+} RtcpRttEstimatorSenderReport_t;
+
+typedef struct RtcpRttEstimator
+{
+    uint32_t localSsrc;
+    RtcpRttEstimatorSenderReport_t * pSenderReportArray;
+    size_t senderReportArrayLength;
+    size_t senderReportCount;
+    size_t nextSenderReportIndex;
+    uint64_t smoothedRtt;
+    uint8_t rttValid;
+} RtcpRttEstimator_t;
+
+/*-----------------------------------------------------------*/
+
+/* Reception reports are used only if their source SSRC is the local SSRC. */
+RtcpRttEstimatorResult_t RtcpRttEstimator_Init( RtcpRttEstimator_t * pRttEstimator,
+                                                uint32_t localSsrc,
+                                                RtcpRttEstimatorSenderReport_t * pSenderReportArray,
+                                                size_t senderReportArrayLength );
+
+/* Records a sent SR packet. The oldest one is replaced when the array is
+ * full. */
+RtcpRttEstimatorResult_t RtcpRttEstimator_AddSenderReport( RtcpRttEstimator_t * pRttEstimator,
+                                                           const RtcpSenderReport_t * pSenderReport,
+                                                           uint64_t sentTime );
+
+/* Updates the round trip time with the reception reports of an RR packet
+ * parsed with Rtcp_ParseReceiverReport, received at the arrival time. If
+ * pRttSample is not NULL, it is given the latest sample. Returns
+ * RTCP_RTT_ESTIMATOR_RESULT_EMPTY if no report refers to a recorded SR. */
+RtcpRttEstimatorResult_t RtcpRttEstimator_HandleReceiverReport( RtcpRttEstimator_t * pRttEstimator,
+                                                                const RtcpReceiverReport_t * pReceiverReport,
+                                                                uint64_t arrivalTime,
+                                                                uint64_t * pRttSample );
+
+/* Same as RtcpRttEstimator_HandleReceiverReport, for an SR packet parsed with
+ * Rtcp_ParseSenderReport. */
+RtcpRttEstimatorResult_t RtcpRttEstimator_HandleSenderReport( RtcpRttEstimator_t * pRttEstimator,
+                                                              const RtcpSenderReport_t * pSenderReport,
+                                                              uint64_t arrivalTime,
+                                                              uint64_t * pRttSample );
+
+/* Returns RTCP_RTT_ESTIMATOR_RESULT_EMPTY if there is no sample yet. */
+RtcpRttEstimatorResult_t RtcpRttEstimator_GetRoundTripTime( const RtcpRttEstimator_t * pRttEstimator,
+                                                            uint64_t * pSmoothedRtt );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTCP_RTT_ESTIMATOR_H */
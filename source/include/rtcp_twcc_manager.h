@@ -7,6 +7,39 @@
 
 /* API includes. */
 #include "rtcp_data_types.h"
+#include "rtcp_delay_based_estimator.h"
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Flags accepted by RtcpTwccManager_InitWithFlags.
+ *
+ * RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED - The slot of a packet info in the
+ * array is derived from its sequence number, unwrapped to 64 bits, which makes
+ * lookups constant time. 16-bit sequence numbers are resolved to the nearest
+ * one to the newest packet info, so packet infos more than 32768 packets older
+ * than the newest one can only be found with
+ * RtcpTwccManager_FindPacketInfoExtended.
+ *
+ * RTCP_TWCC_MANAGER_FLAG_POWER_OF_TWO_LENGTH - The array length must be a
+ * power of two, which lets the manager wrap indices with a mask instead of a
+ * division.
+ *
+ * RTCP_TWCC_MANAGER_FLAG_LAZY_EVICTION - Packet infos older than the time
+ * window are evicted by advancing the read index past them, found with a
+ * binary search on the sent time, instead of clearing them one by one. This
+ * requires packet infos to be added in the order they are sent.
+ */
+#define RTCP_TWCC_MANAGER_FLAG_NONE                     0x00000000
+#define RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED          0x00000001
+#define RTCP_TWCC_MANAGER_FLAG_POWER_OF_TWO_LENGTH      0x00000002
+#define RTCP_TWCC_MANAGER_FLAG_LAZY_EVICTION            0x00000004
+
+/* The maximum array length without RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED,
+ * and of the SPSC manager, whose lookups match 16-bit sequence numbers. Longer
+ * histories could hold packet infos more than 32768 packets apart, and match
+ * an older one of two with the same 16-bit sequence number. */
+#define RTCP_TWCC_MANAGER_MAX_LINEAR_LENGTH             32768
 
 /*-----------------------------------------------------------*/
 
@@ -15,7 +48,8 @@ typedef enum RtcpTwccManagerResult
     RTCP_TWCC_MANAGER_RESULT_OK,
     RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
     RTCP_TWCC_MANAGER_RESULT_EMPTY,
-    RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND
+    RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+    RTCP_TWCC_MANAGER_RESULT_FULL
 } RtcpTwccManagerResult_t;
 
 /*-----------------------------------------------------------*/
@@ -36,6 +70,30 @@ typedef struct TwccPacketInfo
     uint16_t packetSeqNum;
 } TwccPacketInfo_t;
 
+/* Send and arrival information of a packet matched while handling a TWCC
+ * packet. The remote arrival time is RTCP_TWCC_PACKET_LOST_TIME for lost
+ * packets. */
+typedef struct TwccPacketFeedback
+{
+    uint64_t localSentTime;
+    uint64_t remoteArrivalTime;
+    size_t packetSize;
+    uint16_t packetSeqNum;
+} TwccPacketFeedback_t;
+
+/* Compact storage for packet infos, used with RtcpTwccManager_InitCompact.
+ * Each array must have twccPacketInfoArrayLength entries. A packet info takes
+ * 8 bytes instead of 24 bytes (on 64-bit targets) and sequence number searches
+ * only touch the dense sequence number array. Sent times are stored relative
+ * to a base time maintained by the manager and packet sizes must fit in 16
+ * bits. */
+typedef struct TwccCompactPacketInfoArrays
+{
+    uint16_t * pSeqNumArray;
+    uint32_t * pRelativeSentTimeArray;
+    uint16_t * pPacketSizeArray;
+} TwccCompactPacketInfoArrays_t;
+
 typedef struct RtcpTwccManager
 {
     TwccPacketInfo_t * pTwccPacketInfoArray;
@@ -43,14 +101,83 @@ typedef struct RtcpTwccManager
     size_t writeIndex;
     size_t readIndex;
     size_t count;
+    size_t indexMask;
+    uint32_t flags;
+
+    /* Packet infos older than this, with respect to the newest packet info,
+     * are deleted. Defaults to RTCP_TWCC_ESTIMATOR_TIME_WINDOW. */
+    uint64_t timeWindow;
+
+    /* Used only in sequence number indexed mode. */
+    uint64_t newestExtendedSeqNum;
+
+    /* Used only in compact storage mode. */
+    TwccCompactPacketInfoArrays_t compactArrays;
+    uint64_t baseSentTime;
+    TwccPacketInfo_t foundTwccPacketInfo;
+
+    /* Fed with every received packet while handling TWCC packets, if set. */
+    RtcpDelayBasedEstimator_t * pDelayBasedEstimator;
 } RtcpTwccManager_t;
 
+/* Maps 16-bit transport wide sequence numbers to monotonically increasing
+ * 64-bit sequence numbers, e.g. the base sequence numbers of parsed TWCC
+ * packets. A sequence number is taken to be the one nearest to the previous
+ * one, i.e. within 32768 packets of it. */
+typedef struct RtcpTwccSeqNumUnwrapper
+{
+    uint64_t lastExtendedSeqNum;
+    uint8_t initialized;
+} RtcpTwccSeqNumUnwrapper_t;
+
+/* Single-producer/single-consumer variant of RtcpTwccManager_t. Packet infos
+ * are added by one thread (usually the RTP send thread) while TWCC packets are
+ * handled by another thread (usually the RTCP receive thread), without any
+ * lock. Each index is written by one side only and the indices are never
+ * wrapped, so the array length must be a power of two. */
+typedef struct RtcpTwccSpscManager
+{
+    TwccPacketInfo_t * pTwccPacketInfoArray;
+    size_t twccPacketInfoArrayLength;
+    size_t indexMask;
+    size_t writeIndex; /* Written by the producer only. */
+    size_t readIndex;  /* Written by the consumer only. */
+
+    /* Used by the consumer only. Defaults to
+     * RTCP_TWCC_ESTIMATOR_TIME_WINDOW. */
+    uint64_t timeWindow;
+} RtcpTwccSpscManager_t;
+
 /*-----------------------------------------------------------*/
 
 RtcpTwccManagerResult_t RtcpTwccManager_Init( RtcpTwccManager_t * pTwccManager,
                                               TwccPacketInfo_t * pTwccPacketInfoArray,
                                               size_t twccPacketInfoArrayLength );
 
+RtcpTwccManagerResult_t RtcpTwccManager_InitWithFlags( RtcpTwccManager_t * pTwccManager,
+                                                       TwccPacketInfo_t * pTwccPacketInfoArray,
+                                                       size_t twccPacketInfoArrayLength,
+                                                       uint32_t flags );
+
+/* Same as RtcpTwccManager_InitWithFlags but stores packet infos in the given
+ * compact arrays. In this mode, RtcpTwccManager_FindPacketInfo returns a copy
+ * of the packet info which is valid until the next call to the manager. */
+RtcpTwccManagerResult_t RtcpTwccManager_InitCompact( RtcpTwccManager_t * pTwccManager,
+                                                     const TwccCompactPacketInfoArrays_t * pCompactArrays,
+                                                     size_t twccPacketInfoArrayLength,
+                                                     uint32_t flags );
+
+/* Attaches a delay based estimator which is updated with the matched
+ * send/arrival times of every received packet during
+ * RtcpTwccManager_HandleTwccPacket. Pass NULL to detach. */
+RtcpTwccManagerResult_t RtcpTwccManager_SetDelayBasedEstimator( RtcpTwccManager_t * pTwccManager,
+                                                                RtcpDelayBasedEstimator_t * pDelayBasedEstimator );
+
+/* Sets the time window, in hundreds of nanoseconds, for which packet infos
+ * are kept. Takes effect from the next packet info added. */
+RtcpTwccManagerResult_t RtcpTwccManager_SetTimeWindow( RtcpTwccManager_t * pTwccManager,
+                                                       uint64_t timeWindow );
+
 RtcpTwccManagerResult_t RtcpTwccManager_AddPacketInfo( RtcpTwccManager_t * pTwccManager,
                                                        const TwccPacketInfo_t * pTwccPacketInfoToAdd );
 
@@ -58,10 +185,58 @@ RtcpTwccManagerResult_t RtcpTwccManager_FindPacketInfo( RtcpTwccManager_t * pTwc
                                                         uint16_t seqNum,
                                                         TwccPacketInfo_t ** ppOutTwccPacketInfo );
 
+/* Finds a packet info by its 64-bit (unwrapped) sequence number. Only
+ * supported in the sequence number indexed mode. */
+RtcpTwccManagerResult_t RtcpTwccManager_FindPacketInfoExtended( RtcpTwccManager_t * pTwccManager,
+                                                                uint64_t extendedSeqNum,
+                                                                TwccPacketInfo_t ** ppOutTwccPacketInfo );
+
 RtcpTwccManagerResult_t RtcpTwccManager_HandleTwccPacket( RtcpTwccManager_t * pTwccManager,
                                                           const RtcpTwccPacket_t * pTwccPacket,
                                                           TwccBandwidthInfo_t * pBandwidthInfo );
 
+/* Same as RtcpTwccManager_HandleTwccPacket but also outputs the feedback of
+ * every matched packet, in the order of the arrival infos, so that congestion
+ * controllers do not need to look the packets up again. The feedback array
+ * must have at least as many entries as the arrival info list of the TWCC
+ * packet. */
+RtcpTwccManagerResult_t RtcpTwccManager_HandleTwccPacketWithFeedback( RtcpTwccManager_t * pTwccManager,
+                                                                      const RtcpTwccPacket_t * pTwccPacket,
+                                                                      TwccBandwidthInfo_t * pBandwidthInfo,
+                                                                      TwccPacketFeedback_t * pPacketFeedbackArray,
+                                                                      size_t packetFeedbackArrayLength,
+                                                                      size_t * pPacketFeedbackCount );
+
+RtcpTwccManagerResult_t RtcpTwccSeqNumUnwrapper_Init( RtcpTwccSeqNumUnwrapper_t * pSeqNumUnwrapper );
+
+/* The first sequence number is unwrapped to itself. */
+RtcpTwccManagerResult_t RtcpTwccSeqNumUnwrapper_Unwrap( RtcpTwccSeqNumUnwrapper_t * pSeqNumUnwrapper,
+                                                        uint16_t seqNum,
+                                                        uint64_t * pExtendedSeqNum );
+
+/* Must be called before the producer and consumer threads start. */
+RtcpTwccManagerResult_t RtcpTwccSpscManager_Init( RtcpTwccSpscManager_t * pTwccSpscManager,
+                                                  TwccPacketInfo_t * pTwccPacketInfoArray,
+                                                  size_t twccPacketInfoArrayLength );
+
+/* Producer side. Returns RTCP_TWCC_MANAGER_RESULT_FULL, without blocking, if
+ * the consumer has not yet released enough packet infos. */
+RtcpTwccManagerResult_t RtcpTwccSpscManager_AddPacketInfo( RtcpTwccSpscManager_t * pTwccSpscManager,
+                                                           const TwccPacketInfo_t * pTwccPacketInfoToAdd );
+
+/* Consumer side. Sets the time window, in hundreds of nanoseconds, for which
+ * packet infos are kept. Must be called from the consumer thread, or before
+ * the producer and consumer threads start. */
+RtcpTwccManagerResult_t RtcpTwccSpscManager_SetTimeWindow( RtcpTwccSpscManager_t * pTwccSpscManager,
+                                                           uint64_t timeWindow );
+
+/* Consumer side. Also releases the packet infos which are older than the
+ * time window with respect to the newest packet info, and the packet infos up
+ * to the last sequence number covered by the TWCC packet. */
+RtcpTwccManagerResult_t RtcpTwccSpscManager_HandleTwccPacket( RtcpTwccSpscManager_t * pTwccSpscManager,
+                                                              const RtcpTwccPacket_t * pTwccPacket,
+                                                              TwccBandwidthInfo_t * pBandwidthInfo );
+
 /*-----------------------------------------------------------*/
 
 #endif /* TWCC_MANAGER_H */
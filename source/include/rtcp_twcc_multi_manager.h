@@ -0,0 +1,110 @@
+#ifndef RTCP_TWCC_MULTI_MANAGER_H
+#define RTCP_TWCC_MULTI_MANAGER_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/* API includes. */
+#include "rtcp_data_types.h"
+#include "rtcp_twcc_manager.h"
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Pool of TWCC managers for servers which send to many peers from one thread,
+ * e.g. an SFU. The managers and their packet info histories live in two
+ * caller provided contiguous arrays, and are referred to by session handles.
+ * A handle encodes the index of the session in the lower 16 bits and a
+ * generation number in the upper 16 bits, so that the handle of a closed
+ * session is not accepted once the session is reused.
+ */
+
+#define RTCP_TWCC_MULTI_MANAGER_MAX_SESSIONS    65535
+
+/*-----------------------------------------------------------*/
+
+typedef uint32_t RtcpTwccSessionHandle_t;
+
+typedef struct RtcpTwccSession
+{
+    RtcpTwccManager_t twccManager;
+    uint16_t generation;
+    uint16_t nextFreeSessionIndex;
+    uint8_t inUse;
+} RtcpTwccSession_t;
+
+/* An entry of RtcpTwccMultiManager_AddPacketInfos. */
+typedef struct RtcpTwccSessionPacketInfo
+{
+    RtcpTwccSessionHandle_t sessionHandle;
+    TwccPacketInfo_t twccPacketInfo;
+} RtcpTwccSessionPacketInfo_t;
+
+/* An entry of RtcpTwccMultiManager_HandleTwccPackets. The bandwidth info and
+ * the result are outputs. */
+typedef struct RtcpTwccSessionTwccPacket
+{
+    RtcpTwccSessionHandle_t sessionHandle;
+    const RtcpTwccPacket_t * pTwccPacket;
+    TwccBandwidthInfo_t bandwidthInfo;
+    RtcpTwccManagerResult_t result;
+} RtcpTwccSessionTwccPacket_t;
+
+typedef struct RtcpTwccMultiManager
+{
+    RtcpTwccSession_t * pSessionArray;
+    size_t sessionArrayLength;
+    TwccPacketInfo_t * pTwccPacketInfoSlab;
+    size_t twccPacketInfoArrayLength; /* Per session. */
+    uint32_t flags;
+    size_t freeSessionIndex;
+    size_t openSessionCount;
+} RtcpTwccMultiManager_t;
+
+/*-----------------------------------------------------------*/
+
+/* The packet info slab must have at least sessionArrayLength *
+ * twccPacketInfoArrayLength entries, or RTCP_TWCC_MANAGER_RESULT_BAD_PARAM is
+ * returned. Each session gets its own slice of twccPacketInfoArrayLength
+ * entries, and is initialized with the given flags as with
+ * RtcpTwccManager_InitWithFlags. */
+RtcpTwccManagerResult_t RtcpTwccMultiManager_Init( RtcpTwccMultiManager_t * pTwccMultiManager,
+                                                   RtcpTwccSession_t * pSessionArray,
+                                                   size_t sessionArrayLength,
+                                                   TwccPacketInfo_t * pTwccPacketInfoSlab,
+                                                   size_t twccPacketInfoSlabLength,
+                                                   size_t twccPacketInfoArrayLength,
+                                                   uint32_t flags );
+
+/* Returns RTCP_TWCC_MANAGER_RESULT_FULL if all the sessions are open. */
+RtcpTwccManagerResult_t RtcpTwccMultiManager_OpenSession( RtcpTwccMultiManager_t * pTwccMultiManager,
+                                                          RtcpTwccSessionHandle_t * pSessionHandle );
+
+RtcpTwccManagerResult_t RtcpTwccMultiManager_CloseSession( RtcpTwccMultiManager_t * pTwccMultiManager,
+                                                           RtcpTwccSessionHandle_t sessionHandle );
+
+/* Returns the manager of a session, e.g. to set its time window or attach a
+ * delay based estimator. The manager is valid until the session is closed. */
+RtcpTwccManagerResult_t RtcpTwccMultiManager_GetManager( RtcpTwccMultiManager_t * pTwccMultiManager,
+                                                         RtcpTwccSessionHandle_t sessionHandle,
+                                                         RtcpTwccManager_t ** ppTwccManager );
+
+/* Adds packet infos to their sessions, in order. If any session handle is
+ * invalid, RTCP_TWCC_MANAGER_RESULT_BAD_PARAM is returned and nothing is
+ * added. Otherwise, the first error of RtcpTwccManager_AddPacketInfo is
+ * returned, and the other packet infos are added regardless. */
+RtcpTwccManagerResult_t RtcpTwccMultiManager_AddPacketInfos( RtcpTwccMultiManager_t * pTwccMultiManager,
+                                                             const RtcpTwccSessionPacketInfo_t * pSessionPacketInfoArray,
+                                                             size_t sessionPacketInfoArrayLength );
+
+/* Handles TWCC packets for their sessions, in order. Each entry gets its own
+ * result, RTCP_TWCC_MANAGER_RESULT_BAD_PARAM for an invalid session handle,
+ * and the other entries are handled regardless. */
+RtcpTwccManagerResult_t RtcpTwccMultiManager_HandleTwccPackets( RtcpTwccMultiManager_t * pTwccMultiManager,
+                                                                RtcpTwccSessionTwccPacket_t * pSessionTwccPacketArray,
+                                                                size_t sessionTwccPacketArrayLength );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTCP_TWCC_MULTI_MANAGER_H */
@@ -0,0 +1,69 @@
+#ifndef RTCP_TWCC_RECORDER_H
+#define RTCP_TWCC_RECORDER_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/* API includes. */
+#include "rtcp_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Receive side recorder of the transport wide sequence numbers and arrival
+ * times of RTP packets, from which TWCC packets are sent back to the sender.
+ * The recorder keeps an arrival info per sequence number, from the base
+ * sequence number of the next TWCC packet up to the highest one recorded, in
+ * a caller provided array. The TWCC packet is serialized with
+ * Rtcp_SerializeTwccPacket.
+ */
+
+/*-----------------------------------------------------------*/
+
+typedef enum RtcpTwccRecorderResult
+{
+    RTCP_TWCC_RECORDER_RESULT_OK,
+    RTCP_TWCC_RECORDER_RESULT_BAD_PARAM,
+    RTCP_TWCC_RECORDER_RESULT_EMPTY,
+    RTCP_TWCC_RECORDER_RESULT_FULL
+} RtcpTwccRecorderResult_t;
+
+/*-----------------------------------------------------------*/
+
+typedef struct RtcpTwccRecorder
+{
+    PacketArrivalInfo_t * pArrivalInfoArray;
+    size_t arrivalInfoArrayLength;
+    size_t arrivalInfoCount;
+    uint16_t baseSeqNum;
+    uint8_t baseSeqNumValid;
+    uint8_t feedbackPacketCount;
+} RtcpTwccRecorder_t;
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccRecorderResult_t RtcpTwccRecorder_Init( RtcpTwccRecorder_t * pTwccRecorder,
+                                                PacketArrivalInfo_t * pArrivalInfoArray,
+                                                size_t arrivalInfoArrayLength );
+
+/* Records the arrival time of a packet, in 100s of nanoseconds. Packets with
+ * a sequence number before the base sequence number were already reported as
+ * not received, and are ignored. Returns RTCP_TWCC_RECORDER_RESULT_FULL if
+ * the packet is too far ahead of the base sequence number for the array, in
+ * which case a TWCC packet should be sent first. */
+RtcpTwccRecorderResult_t RtcpTwccRecorder_RecordPacket( RtcpTwccRecorder_t * pTwccRecorder,
+                                                        uint16_t seqNum,
+                                                        uint64_t arrivalTime );
+
+/* Fills the TWCC packet with the packets recorded since the previous one,
+ * except for the SSRCs, and starts the next one after them. The arrival info
+ * list points into the recorder array, and is valid until the next packet is
+ * recorded. Returns RTCP_TWCC_RECORDER_RESULT_EMPTY if no packet was
+ * recorded. */
+RtcpTwccRecorderResult_t RtcpTwccRecorder_GetTwccPacket( RtcpTwccRecorder_t * pTwccRecorder,
+                                                         RtcpTwccPacket_t * pTwccPacket );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTCP_TWCC_RECORDER_H */
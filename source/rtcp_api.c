@@ -180,6 +180,11 @@
 #define RTCP_TWCC_PACKET_STATUS_NOT_RECEIVED           0
 #define RTCP_TWCC_PACKET_STATUS_SMALL_DELTA            1
 #define RTCP_TWCC_PACKET_STATUS_LARGE_DELTA            2
+#define RTCP_TWCC_PACKET_STATUS_INVALID                3
+
+#define RTCP_TWCC_PACKET_CHUNK_MAX_RUN_LENGTH          8191
+#define RTCP_TWCC_PACKET_CHUNK_ONE_BIT_SYMBOLS         14
+#define RTCP_TWCC_PACKET_CHUNK_TWO_BIT_SYMBOLS         7
 
 #define RTCP_TWCC_PACKET_CHUNK_EXTRACT_TYPE( packetChunk )              \
         ( ( ( packetChunk ) & RTCP_TWCC_PACKET_CHUNK_TYPE_BITMASK ) >>  \
@@ -207,11 +212,27 @@
         ( ( symbolSize ) == 1 ? ( ( ( symbolList ) >> ( 14 - ( ( i + 1 ) * ( symbolSize ) ) ) ) & 1 )   \
                               : ( ( ( symbolList ) >> ( 14 - ( ( i + 1 ) * ( symbolSize ) ) ) ) & 3 ) )
 
-#define RTCP_TWCC_MS_TO_HUNDRED_OF_NANOS( ms )  \
-        ( ( ( ms ) * RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND ) / 1000 )
+/* Arrival times are accumulated in receive delta ticks of 250us, in which the
+ * reference time of 64ms is 256 ticks, and are converted with a multiply.
+ * Large deltas are signed, so a sum below zero wraps around like any other
+ * unsigned arithmetic on the arrival times. */
+#define RTCP_TWCC_REFERENCE_TIME_TO_TICKS( referenceTime )  \
+        ( ( int64_t ) ( referenceTime ) * 256 )
+
+#define RTCP_TWCC_TICKS_TO_HUNDRED_OF_NANOS( ticks )    \
+        ( ( uint64_t ) ( ticks ) * ( RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND / 4000 ) )
 
-#define RTCP_TWCC_US_TO_HUNDRED_OF_NANOS( us )  \
-        ( ( ( us ) * RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND ) / 1000000 )
+/* The serializer works on ticks modulo 2^32, as the 24 bit reference time
+ * wraps around at 2^32 ticks. */
+#define RTCP_TWCC_HUNDRED_OF_NANOS_TO_TICKS( time ) \
+        ( ( uint32_t ) ( ( time ) / ( RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND / 4000 ) ) )
+
+/* Look up the receive delta bytes of a whole status vector chunk in tables
+ * (384 bytes). Define to 0 before compiling this file to count them with bit
+ * operations instead, e.g. on targets short of ROM. */
+#ifndef RTCP_TWCC_STATUS_VECTOR_LOOKUP_TABLES
+    #define RTCP_TWCC_STATUS_VECTOR_LOOKUP_TABLES    1
+#endif
 
 /*-----------------------------------------------------------*/
 
@@ -396,27 +417,155 @@ static void ReadReceptionReport( RtcpContext_t * pCtx,
 
 /*-----------------------------------------------------------*/
 
+/* Remote arrival time stored by ParseTwccPacketChunks for each status symbol.
+ * The reserved symbol is treated as not received. */
+static const uint64_t twccPacketStatusTable[ 4 ] =
+{
+    RTCP_TWCC_PACKET_LOST_TIME,
+    RTCP_TWCC_PACKET_STATUS_SMALL_DELTA,
+    RTCP_TWCC_PACKET_STATUS_LARGE_DELTA,
+    RTCP_TWCC_PACKET_LOST_TIME
+};
+
+/* Receive delta bytes for each status symbol. */
+static const uint8_t twccReceiveDeltaSizeTable[ 4 ] = { 0, 1, 2, 0 };
+
+#if ( RTCP_TWCC_STATUS_VECTOR_LOOKUP_TABLES == 1 )
+
+/* Receive delta bytes of 7 one bit symbols, indexed by the symbols. */
+    #define ONE_BIT_SYMBOLS_2( n )      ( n ), ( n ) + 1
+    #define ONE_BIT_SYMBOLS_4( n )      ONE_BIT_SYMBOLS_2( n ), ONE_BIT_SYMBOLS_2( ( n ) + 1 )
+    #define ONE_BIT_SYMBOLS_8( n )      ONE_BIT_SYMBOLS_4( n ), ONE_BIT_SYMBOLS_4( ( n ) + 1 )
+    #define ONE_BIT_SYMBOLS_16( n )     ONE_BIT_SYMBOLS_8( n ), ONE_BIT_SYMBOLS_8( ( n ) + 1 )
+    #define ONE_BIT_SYMBOLS_32( n )     ONE_BIT_SYMBOLS_16( n ), ONE_BIT_SYMBOLS_16( ( n ) + 1 )
+    #define ONE_BIT_SYMBOLS_64( n )     ONE_BIT_SYMBOLS_32( n ), ONE_BIT_SYMBOLS_32( ( n ) + 1 )
+    #define ONE_BIT_SYMBOLS_128( n )    ONE_BIT_SYMBOLS_64( n ), ONE_BIT_SYMBOLS_64( ( n ) + 1 )
+
+static const uint8_t twccOneBitSymbolsReceiveDeltaSizeTable[ 128 ] = { ONE_BIT_SYMBOLS_128( 0 ) };
+
+/* Receive delta bytes of 4 two bit symbols, indexed by the symbols. */
+    #define TWO_BIT_SYMBOLS_4( n )      ( n ), ( n ) + 1, ( n ) + 2, ( n )
+    #define TWO_BIT_SYMBOLS_16( n )     TWO_BIT_SYMBOLS_4( n ), TWO_BIT_SYMBOLS_4( ( n ) + 1 ), TWO_BIT_SYMBOLS_4( ( n ) + 2 ), TWO_BIT_SYMBOLS_4( n )
+    #define TWO_BIT_SYMBOLS_64( n )     TWO_BIT_SYMBOLS_16( n ), TWO_BIT_SYMBOLS_16( ( n ) + 1 ), TWO_BIT_SYMBOLS_16( ( n ) + 2 ), TWO_BIT_SYMBOLS_16( n )
+    #define TWO_BIT_SYMBOLS_256( n )    TWO_BIT_SYMBOLS_64( n ), TWO_BIT_SYMBOLS_64( ( n ) + 1 ), TWO_BIT_SYMBOLS_64( ( n ) + 2 ), TWO_BIT_SYMBOLS_64( n )
+
+static const uint8_t twccTwoBitSymbolsReceiveDeltaSizeTable[ 256 ] = { TWO_BIT_SYMBOLS_256( 0 ) };
+
+#else /* if ( RTCP_TWCC_STATUS_VECTOR_LOOKUP_TABLES == 1 ) */
+
+static uint16_t CountSetBits( uint16_t value )
+{
+    uint16_t count = value;
+
+    /* Add up adjacent bit fields of increasing widths. */
+    count = count - ( ( count >> 1 ) & 0x5555U );
+    count = ( count & 0x3333U ) + ( ( count >> 2 ) & 0x3333U );
+    count = ( count + ( count >> 4 ) ) & 0x0F0FU;
+    count = ( count + ( count >> 8 ) ) & 0x001FU;
+
+    return count;
+}
+
+#endif /* if ( RTCP_TWCC_STATUS_VECTOR_LOOKUP_TABLES == 1 ) */
+
+/*-----------------------------------------------------------*/
+
+/* Returns the number of receive delta bytes of all the symbols in a status
+ * vector chunk symbol list. Unused trailing symbols must be zero. */
+static size_t GetStatusVectorReceiveDeltaLength( uint16_t symbolList,
+                                                 uint16_t symbolSize )
+{
+    size_t receiveDeltaLength;
+
+    #if ( RTCP_TWCC_STATUS_VECTOR_LOOKUP_TABLES == 1 )
+        if( symbolSize == 1 )
+        {
+            receiveDeltaLength = ( size_t ) twccOneBitSymbolsReceiveDeltaSizeTable[ symbolList >> 7 ] +
+                                 twccOneBitSymbolsReceiveDeltaSizeTable[ symbolList & 0x7FU ];
+        }
+        else
+        {
+            /* The first 4 symbols, and the last 3 symbols padded with a not
+             * received symbol. */
+            receiveDeltaLength = ( size_t ) twccTwoBitSymbolsReceiveDeltaSizeTable[ symbolList >> 6 ] +
+                                 twccTwoBitSymbolsReceiveDeltaSizeTable[ symbolList & 0x3FU ];
+        }
+    #else /* if ( RTCP_TWCC_STATUS_VECTOR_LOOKUP_TABLES == 1 ) */
+        uint16_t highBits, lowBits;
+
+        if( symbolSize == 1 )
+        {
+            /* 1 - Packet received, small delta. */
+            receiveDeltaLength = CountSetBits( symbolList );
+        }
+        else
+        {
+            /* 01 - Small delta, 10 - Large delta, 11 - Reserved. */
+            highBits = ( symbolList >> 1 ) & 0x1555U;
+            lowBits = symbolList & 0x1555U;
+
+            receiveDeltaLength = ( size_t ) CountSetBits( lowBits & ( uint16_t ) ~highBits ) +
+                                 ( 2U * CountSetBits( highBits & ( uint16_t ) ~lowBits ) );
+        }
+    #endif /* if ( RTCP_TWCC_STATUS_VECTOR_LOOKUP_TABLES == 1 ) */
+
+    return receiveDeltaLength;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Returns how many of the packets of a chunk fit in the arrival info list.
+ * With no arrival info list, all of them are counted. */
+static uint16_t GetNumArrivalInfosToWrite( const RtcpTwccPacket_t * pTwccPacket,
+                                           size_t numArrivalInfos,
+                                           uint16_t numPacketsInChunk )
+{
+    uint16_t numArrivalInfosToWrite = numPacketsInChunk;
+
+    if( pTwccPacket->pArrivalInfoList == NULL )
+    {
+        /* Only counting. */
+    }
+    else if( ( pTwccPacket->arrivalInfoListLength - numArrivalInfos ) < numPacketsInChunk )
+    {
+        numArrivalInfosToWrite = ( uint16_t ) ( pTwccPacket->arrivalInfoListLength - numArrivalInfos );
+    }
+    else
+    {
+        /* All of them fit. */
+    }
+
+    return numArrivalInfosToWrite;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Decodes the packet chunks in a single pass. When an arrival info list is
+ * given, the status of each packet is stored in its remote arrival time for
+ * ParseTwccReceiveDeltas to resolve: RTCP_TWCC_PACKET_STATUS_SMALL_DELTA,
+ * RTCP_TWCC_PACKET_STATUS_LARGE_DELTA or RTCP_TWCC_PACKET_LOST_TIME. The
+ * receive deltas of all the packets are bounds checked here at once. Once
+ * the arrival info list is full, the remaining chunks are only read to find
+ * the receive deltas. */
 static RtcpResult_t ParseTwccPacketChunks( RtcpContext_t * pCtx,
                                            const RtcpPacket_t * pRtcpPacket,
                                            size_t packetChunkStartIndex,
-                                           size_t receiveDeltaStartIndex,
-                                           RtcpTwccPacket_t * pTwccPacket )
+                                           RtcpTwccPacket_t * pTwccPacket,
+                                           size_t * pReceiveDeltaStartIndex )
 {
     RtcpResult_t result = RTCP_RESULT_OK;
     size_t currentPacketChunkIndex = packetChunkStartIndex;
-    size_t currentReceiveDeltaIndex = receiveDeltaStartIndex;
+    size_t receiveDeltaLength = 0;
     size_t numArrivalInfos = 0;
     uint16_t packetsRemaining = pTwccPacket->packetStatusCount;
-    uint16_t i, packetChunk, statusSymbol, numPacketsInRunLengthChunk, recvDelta;
-    uint16_t remoteSeqNum, symbolSize, symbolCount, symbolList;
-    uint64_t referenceTime = 0;
-    uint64_t remoteArrivalTime = 0;
+    uint16_t i, packetChunk, statusSymbol, numPacketsInChunk, numArrivalInfosToWrite;
+    uint16_t remoteSeqNum, symbolSize, symbolList;
+    uint64_t packetStatus;
+    PacketArrivalInfo_t * pArrivalInfo;
 
     remoteSeqNum = pTwccPacket->baseSeqNum;
-    referenceTime = RTCP_TWCC_MS_TO_HUNDRED_OF_NANOS( pTwccPacket->referenceTime * 64 ); /* Reference time is represented in multiples of 64ms. */
 
-    while( ( result == RTCP_RESULT_OK ) &&
-           ( packetsRemaining > 0 ) &&
+    while( ( packetsRemaining > 0 ) &&
            ( ( currentPacketChunkIndex + 1 ) < pRtcpPacket->payloadLength ) ) /* +1 because we read 2 bytes at a time. */
     {
         packetChunk = RTCP_READ_UINT16( &( pRtcpPacket->pPayload[ currentPacketChunkIndex ] ) );
@@ -425,154 +574,791 @@ static RtcpResult_t ParseTwccPacketChunks( RtcpContext_t * pCtx,
         if( RTCP_TWCC_PACKET_CHUNK_EXTRACT_TYPE( packetChunk ) == RTCP_TWCC_PACKET_CHUNK_TYPE_RUN_LENGTH )
         {
             statusSymbol = RTCP_TWCC_PACKET_CHUNK_EXTRACT_STATUS( packetChunk );
-            numPacketsInRunLengthChunk = RTCP_TWCC_PACKET_CHUNK_EXTRACT_RUN_LENGTH( packetChunk );
+            numPacketsInChunk = RTCP_TWCC_PACKET_CHUNK_EXTRACT_RUN_LENGTH( packetChunk );
+
+            receiveDeltaLength += ( size_t ) twccReceiveDeltaSizeTable[ statusSymbol ] * numPacketsInChunk;
+            packetStatus = twccPacketStatusTable[ statusSymbol ];
 
-            for( i = 0; i < numPacketsInRunLengthChunk; i++ )
+            numArrivalInfosToWrite = GetNumArrivalInfosToWrite( pTwccPacket,
+                                                                numArrivalInfos,
+                                                                numPacketsInChunk );
+
+            if( pTwccPacket->pArrivalInfoList != NULL )
             {
-                switch( statusSymbol )
+                pArrivalInfo = &( pTwccPacket->pArrivalInfoList[ numArrivalInfos ] );
+
+                for( i = 0; i < numArrivalInfosToWrite; i++ )
                 {
-                    case RTCP_TWCC_PACKET_STATUS_NOT_RECEIVED:
-                    {
-                        remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
-                    }
-                    break;
+                    pArrivalInfo[ i ].seqNum = ( uint16_t ) ( remoteSeqNum + i );
+                    pArrivalInfo[ i ].remoteArrivalTime = packetStatus;
+                }
+            }
+        }
+        else
+        {
+            symbolSize = RTCP_TWCC_PACKET_CHUNK_EXTRACT_SYMBOL_SIZE( packetChunk );
+            numPacketsInChunk = RTCP_TWCC_PACKET_CHUNK_EXTRACT_SYMBOL_COUNT( packetChunk );
+            numPacketsInChunk = ( packetsRemaining < numPacketsInChunk ) ? packetsRemaining : numPacketsInChunk;
 
-                    case RTCP_TWCC_PACKET_STATUS_SMALL_DELTA:
-                    {
-                        if( currentReceiveDeltaIndex < pRtcpPacket->payloadLength )
-                        {
-                            recvDelta = ( uint16_t ) ( pRtcpPacket->pPayload[ currentReceiveDeltaIndex ] );
-                            currentReceiveDeltaIndex += 1;
+            /* Symbols are stored most significant first. Clear the ones past
+             * the packet status count. */
+            symbolList = RTCP_TWCC_PACKET_CHUNK_EXTRACT_SYMBOL_LIST( packetChunk );
+            symbolList &= ( uint16_t ) ~( ( 1U << ( 14U - ( numPacketsInChunk * symbolSize ) ) ) - 1U );
 
-                            referenceTime += RTCP_TWCC_US_TO_HUNDRED_OF_NANOS( recvDelta * 250 ); /* Deltas are represented as multiples of 250us. */
-                            remoteArrivalTime = referenceTime;
-                        }
-                        else
-                        {
-                            result = RTCP_RESULT_MALFORMED_PACKET;
-                        }
-                    }
-                    break;
+            receiveDeltaLength += GetStatusVectorReceiveDeltaLength( symbolList,
+                                                                     symbolSize );
 
-                    case RTCP_TWCC_PACKET_STATUS_LARGE_DELTA:
-                    {
-                        if( ( currentReceiveDeltaIndex + 1 ) < pRtcpPacket->payloadLength )
-                        {
-                            recvDelta = RTCP_READ_UINT16( &( pRtcpPacket->pPayload[ currentReceiveDeltaIndex ] ) );
-                            currentReceiveDeltaIndex += 2;
+            numArrivalInfosToWrite = GetNumArrivalInfosToWrite( pTwccPacket,
+                                                                numArrivalInfos,
+                                                                numPacketsInChunk );
 
-                            referenceTime += RTCP_TWCC_US_TO_HUNDRED_OF_NANOS( recvDelta * 250 ); /* Deltas are represented as multiples of 250us. */
-                            remoteArrivalTime = referenceTime;
-                        }
-                        else
-                        {
-                            result = RTCP_RESULT_MALFORMED_PACKET;
-                        }
-                    }
-                    break;
+            if( pTwccPacket->pArrivalInfoList != NULL )
+            {
+                pArrivalInfo = &( pTwccPacket->pArrivalInfoList[ numArrivalInfos ] );
+
+                for( i = 0; i < numArrivalInfosToWrite; i++ )
+                {
+                    statusSymbol = RTCP_TWCC_PACKET_CHUNK_EXTRACT_SYMBOL_FROM_LIST( symbolList, i, symbolSize );
+
+                    pArrivalInfo[ i ].seqNum = ( uint16_t ) ( remoteSeqNum + i );
+                    pArrivalInfo[ i ].remoteArrivalTime = twccPacketStatusTable[ statusSymbol ];
                 }
+            }
+        }
+
+        if( numArrivalInfosToWrite < numPacketsInChunk )
+        {
+            result = RTCP_RESULT_OUT_OF_MEMORY;
+        }
+
+        /* All the packets of a run are reported, even if the run is longer
+         * than the packet status count. */
+        numArrivalInfos += numArrivalInfosToWrite;
+        packetsRemaining -= ( packetsRemaining < numPacketsInChunk ) ? packetsRemaining : numPacketsInChunk;
+        remoteSeqNum += numPacketsInChunk;
+    }
+
+    /* The receive deltas follow the last packet chunk. The chunks after an
+     * out of memory are still read to find them. */
+    if( ( currentPacketChunkIndex + receiveDeltaLength ) > pRtcpPacket->payloadLength )
+    {
+        result = RTCP_RESULT_MALFORMED_PACKET;
+    }
+
+    pTwccPacket->arrivalInfoListLength = numArrivalInfos;
+    *pReceiveDeltaStartIndex = currentPacketChunkIndex;
+
+    return result;
+}
 
-                if( pTwccPacket->pArrivalInfoList != NULL )
+/*-----------------------------------------------------------*/
+
+/* Replaces the packet statuses stored by ParseTwccPacketChunks with the
+ * remote arrival times. The receive deltas are already bounds checked. */
+static void ParseTwccReceiveDeltas( RtcpContext_t * pCtx,
+                                    const RtcpPacket_t * pRtcpPacket,
+                                    size_t receiveDeltaStartIndex,
+                                    RtcpTwccPacket_t * pTwccPacket )
+{
+    size_t currentReceiveDeltaIndex = receiveDeltaStartIndex;
+    size_t i;
+    int64_t referenceTicks;
+    PacketArrivalInfo_t * pArrivalInfo;
+
+    referenceTicks = RTCP_TWCC_REFERENCE_TIME_TO_TICKS( pTwccPacket->referenceTime );
+
+    for( i = 0; i < pTwccPacket->arrivalInfoListLength; i++ )
+    {
+        pArrivalInfo = &( pTwccPacket->pArrivalInfoList[ i ] );
+
+        if( pArrivalInfo->remoteArrivalTime == RTCP_TWCC_PACKET_STATUS_SMALL_DELTA )
+        {
+            referenceTicks += pRtcpPacket->pPayload[ currentReceiveDeltaIndex ];
+            currentReceiveDeltaIndex += 1;
+
+            pArrivalInfo->remoteArrivalTime = RTCP_TWCC_TICKS_TO_HUNDRED_OF_NANOS( referenceTicks );
+        }
+        else if( pArrivalInfo->remoteArrivalTime == RTCP_TWCC_PACKET_STATUS_LARGE_DELTA )
+        {
+            referenceTicks += ( int16_t ) RTCP_READ_UINT16( &( pRtcpPacket->pPayload[ currentReceiveDeltaIndex ] ) );
+            currentReceiveDeltaIndex += 2;
+
+            pArrivalInfo->remoteArrivalTime = RTCP_TWCC_TICKS_TO_HUNDRED_OF_NANOS( referenceTicks );
+        }
+        else
+        {
+            /* Not received. */
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/* Reads the fixed fields of a TWCC packet, all but the arrival info list.
+ * Returns the index of the first packet chunk. */
+static size_t ReadTwccPacketHeader( RtcpContext_t * pCtx,
+                                    const RtcpPacket_t * pRtcpPacket,
+                                    RtcpTwccPacket_t * pTwccPacket )
+{
+    size_t currentIndex = 0;
+    uint32_t word;
+
+    pTwccPacket->senderSsrc = RTCP_READ_UINT32( &( pRtcpPacket->pPayload[ currentIndex ] ) );
+    currentIndex += 4;
+
+    pTwccPacket->mediaSourceSsrc = RTCP_READ_UINT32( &( pRtcpPacket->pPayload[ currentIndex ] ) );
+    currentIndex += 4;
+
+    pTwccPacket->baseSeqNum = RTCP_READ_UINT16( &( pRtcpPacket->pPayload[ currentIndex ] ) );
+    currentIndex += 2;
+
+    pTwccPacket->packetStatusCount = RTCP_READ_UINT16( &( pRtcpPacket->pPayload[ currentIndex ] ) );
+    currentIndex += 2;
+
+    word = RTCP_READ_UINT32( &( pRtcpPacket->pPayload[ currentIndex ] ) );
+    currentIndex += 4;
+    pTwccPacket->referenceTime = ( word & RTCP_TWCC_REFERENCE_TIME_BITMASK ) >>
+                                 RTCP_TWCC_REFERENCE_TIME_LOCATION;
+    pTwccPacket->feedbackPacketCount = ( word & RTCP_TWCC_FEEDBACK_PACKET_COUNT_BITMASK ) >>
+                                       RTCP_TWCC_FEEDBACK_PACKET_COUNT_LOCATION;
+
+    return currentIndex;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Appends packets to the last run if it has the same status, or starts a new
+ * run. The last run is also tracked in pLastRun, so that runs can be merged
+ * with no run list, when only counting them. A run is never longer than
+ * UINT16_MAX packets. */
+static RtcpResult_t AppendTwccPacketRun( RtcpTwccRunsPacket_t * pTwccRunsPacket,
+                                         size_t * pNumRuns,
+                                         TwccPacketRun_t * pLastRun,
+                                         uint16_t startSeqNum,
+                                         uint16_t length,
+                                         uint8_t received )
+{
+    RtcpResult_t result = RTCP_RESULT_OK;
+
+    if( length == 0 )
+    {
+        /* Nothing to append. */
+    }
+    else if( ( *pNumRuns > 0 ) &&
+             ( pLastRun->received == received ) &&
+             ( ( ( uint32_t ) pLastRun->length + length ) <= UINT16_MAX ) )
+    {
+        pLastRun->length += length;
+
+        if( pTwccRunsPacket->pRunList != NULL )
+        {
+            pTwccRunsPacket->pRunList[ *pNumRuns - 1 ].length = pLastRun->length;
+        }
+    }
+    else
+    {
+        pLastRun->startSeqNum = startSeqNum;
+        pLastRun->length = length;
+        pLastRun->received = received;
+
+        if( pTwccRunsPacket->pRunList != NULL )
+        {
+            if( *pNumRuns < pTwccRunsPacket->runListLength )
+            {
+                pTwccRunsPacket->pRunList[ *pNumRuns ] = *pLastRun;
+            }
+            else
+            {
+                result = RTCP_RESULT_OUT_OF_MEMORY;
+            }
+        }
+
+        *pNumRuns += 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Decodes the packet chunks into runs. When an arrival time list is given,
+ * the status of each received packet is stored in it for
+ * ParseTwccRunsReceiveDeltas to resolve, as in ParseTwccPacketChunks. */
+static RtcpResult_t ParseTwccPacketChunksToRuns( RtcpContext_t * pCtx,
+                                                 const RtcpPacket_t * pRtcpPacket,
+                                                 size_t packetChunkStartIndex,
+                                                 RtcpTwccRunsPacket_t * pTwccRunsPacket,
+                                                 size_t * pReceiveDeltaStartIndex )
+{
+    RtcpResult_t result = RTCP_RESULT_OK;
+    size_t currentPacketChunkIndex = packetChunkStartIndex;
+    size_t receiveDeltaLength = 0;
+    size_t numRuns = 0, numArrivalTimes = 0;
+    uint16_t packetsRemaining = pTwccRunsPacket->packetStatusCount;
+    uint16_t i, packetChunk, statusSymbol, numPacketsInChunk, runLength;
+    uint16_t remoteSeqNum, symbolSize, symbolList;
+    uint8_t received;
+    TwccPacketRun_t lastRun = { 0 };
+
+    remoteSeqNum = pTwccRunsPacket->baseSeqNum;
+
+    while( ( result == RTCP_RESULT_OK ) &&
+           ( packetsRemaining > 0 ) &&
+           ( ( currentPacketChunkIndex + 1 ) < pRtcpPacket->payloadLength ) ) /* +1 because we read 2 bytes at a time. */
+    {
+        packetChunk = RTCP_READ_UINT16( &( pRtcpPacket->pPayload[ currentPacketChunkIndex ] ) );
+        currentPacketChunkIndex += 2;
+
+        if( RTCP_TWCC_PACKET_CHUNK_EXTRACT_TYPE( packetChunk ) == RTCP_TWCC_PACKET_CHUNK_TYPE_RUN_LENGTH )
+        {
+            statusSymbol = RTCP_TWCC_PACKET_CHUNK_EXTRACT_STATUS( packetChunk );
+            numPacketsInChunk = RTCP_TWCC_PACKET_CHUNK_EXTRACT_RUN_LENGTH( packetChunk );
+            received = ( twccReceiveDeltaSizeTable[ statusSymbol ] != 0 ) ? 1 : 0;
+
+            result = AppendTwccPacketRun( pTwccRunsPacket,
+                                          &( numRuns ),
+                                          &( lastRun ),
+                                          remoteSeqNum,
+                                          numPacketsInChunk,
+                                          received );
+
+            if( ( result == RTCP_RESULT_OK ) && ( received != 0 ) )
+            {
+                receiveDeltaLength += ( size_t ) twccReceiveDeltaSizeTable[ statusSymbol ] * numPacketsInChunk;
+
+                if( pTwccRunsPacket->pArrivalTimeList != NULL )
                 {
-                    if( numArrivalInfos < pTwccPacket->arrivalInfoListLength )
+                    if( ( numArrivalTimes + numPacketsInChunk ) <= pTwccRunsPacket->arrivalTimeListLength )
                     {
-                        pTwccPacket->pArrivalInfoList[ numArrivalInfos ].seqNum = remoteSeqNum;
-                        pTwccPacket->pArrivalInfoList[ numArrivalInfos ].remoteArrivalTime = remoteArrivalTime;
-                        numArrivalInfos += 1;
+                        for( i = 0; i < numPacketsInChunk; i++ )
+                        {
+                            pTwccRunsPacket->pArrivalTimeList[ numArrivalTimes + i ] = statusSymbol;
+                        }
                     }
                     else
                     {
                         result = RTCP_RESULT_OUT_OF_MEMORY;
                     }
                 }
-                else
-                {
-                    numArrivalInfos += 1;
-                }
 
-                packetsRemaining -= 1;
-                remoteSeqNum += 1;
+                numArrivalTimes += numPacketsInChunk;
             }
         }
         else
         {
             symbolSize = RTCP_TWCC_PACKET_CHUNK_EXTRACT_SYMBOL_SIZE( packetChunk );
-            symbolCount = RTCP_TWCC_PACKET_CHUNK_EXTRACT_SYMBOL_COUNT( packetChunk );
-            symbolCount = ( packetsRemaining < symbolCount ) ? packetsRemaining : symbolCount;
+            numPacketsInChunk = RTCP_TWCC_PACKET_CHUNK_EXTRACT_SYMBOL_COUNT( packetChunk );
+            numPacketsInChunk = ( packetsRemaining < numPacketsInChunk ) ? packetsRemaining : numPacketsInChunk;
+
+            /* Symbols are stored most significant first. Clear the ones past
+             * the packet status count. */
             symbolList = RTCP_TWCC_PACKET_CHUNK_EXTRACT_SYMBOL_LIST( packetChunk );
+            symbolList &= ( uint16_t ) ~( ( 1U << ( 14U - ( numPacketsInChunk * symbolSize ) ) ) - 1U );
+
+            receiveDeltaLength += GetStatusVectorReceiveDeltaLength( symbolList,
+                                                                     symbolSize );
 
-            for( i = 0; i < symbolCount; i++ )
+            /* Group the symbols of the chunk into runs before appending them. */
+            for( i = 0; ( i < numPacketsInChunk ) && ( result == RTCP_RESULT_OK ); i += runLength )
             {
                 statusSymbol = RTCP_TWCC_PACKET_CHUNK_EXTRACT_SYMBOL_FROM_LIST( symbolList, i, symbolSize );
+                received = ( twccReceiveDeltaSizeTable[ statusSymbol ] != 0 ) ? 1 : 0;
 
-                switch( statusSymbol )
+                for( runLength = 0; ( ( i + runLength ) < numPacketsInChunk ) && ( result == RTCP_RESULT_OK ); runLength++ )
                 {
-                    case RTCP_TWCC_PACKET_STATUS_NOT_RECEIVED:
+                    statusSymbol = RTCP_TWCC_PACKET_CHUNK_EXTRACT_SYMBOL_FROM_LIST( symbolList, i + runLength, symbolSize );
+
+                    if( ( ( twccReceiveDeltaSizeTable[ statusSymbol ] != 0 ) ? 1 : 0 ) != received )
                     {
-                        remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+                        break;
                     }
-                    break;
 
-                    case RTCP_TWCC_PACKET_STATUS_SMALL_DELTA:
+                    if( received != 0 )
                     {
-                        if( currentReceiveDeltaIndex < pRtcpPacket->payloadLength )
-                        {
-                            recvDelta = ( uint16_t ) ( pRtcpPacket->pPayload[ currentReceiveDeltaIndex ] );
-                            currentReceiveDeltaIndex += 1;
-
-                            referenceTime += RTCP_TWCC_US_TO_HUNDRED_OF_NANOS( recvDelta * 250 ); /* Deltas are represented as multiples of 250us. */
-                            remoteArrivalTime = referenceTime;
-                        }
-                        else
+                        if( pTwccRunsPacket->pArrivalTimeList == NULL )
                         {
-                            result = RTCP_RESULT_MALFORMED_PACKET;
+                            /* Only counting. */
                         }
-                    }
-                    break;
-
-                    case RTCP_TWCC_PACKET_STATUS_LARGE_DELTA:
-                    {
-                        if( ( currentReceiveDeltaIndex + 1 ) < pRtcpPacket->payloadLength )
+                        else if( numArrivalTimes < pTwccRunsPacket->arrivalTimeListLength )
                         {
-                            recvDelta = RTCP_READ_UINT16( &( pRtcpPacket->pPayload[ currentReceiveDeltaIndex ] ) );
-                            currentReceiveDeltaIndex += 2;
-
-                            referenceTime += RTCP_TWCC_US_TO_HUNDRED_OF_NANOS( recvDelta * 250 ); /* Deltas are represented as multiples of 250us. */
-                            remoteArrivalTime = referenceTime;
+                            pTwccRunsPacket->pArrivalTimeList[ numArrivalTimes ] = statusSymbol;
                         }
                         else
                         {
-                            result = RTCP_RESULT_MALFORMED_PACKET;
+                            result = RTCP_RESULT_OUT_OF_MEMORY;
                         }
+
+                        numArrivalTimes += 1;
                     }
-                    break;
                 }
 
-                if( pTwccPacket->pArrivalInfoList != NULL )
+                if( result == RTCP_RESULT_OK )
                 {
-                    if( numArrivalInfos < pTwccPacket->arrivalInfoListLength )
-                    {
-                        pTwccPacket->pArrivalInfoList[ numArrivalInfos ].seqNum = remoteSeqNum;
-                        pTwccPacket->pArrivalInfoList[ numArrivalInfos ].remoteArrivalTime = remoteArrivalTime;
-                        numArrivalInfos += 1;
-                    }
-                    else
-                    {
-                        result = RTCP_RESULT_OUT_OF_MEMORY;
-                    }
+                    result = AppendTwccPacketRun( pTwccRunsPacket,
+                                                  &( numRuns ),
+                                                  &( lastRun ),
+                                                  ( uint16_t ) ( remoteSeqNum + i ),
+                                                  runLength,
+                                                  received );
                 }
-                else
+            }
+        }
+
+        /* As in ParseTwccPacketChunks, all the packets of a run are
+         * reported, even if the run is longer than the packet status count. */
+        packetsRemaining -= ( packetsRemaining < numPacketsInChunk ) ? packetsRemaining : numPacketsInChunk;
+        remoteSeqNum += numPacketsInChunk;
+    }
+
+    /* The receive deltas follow the last packet chunk. */
+    if( ( result == RTCP_RESULT_OK ) &&
+        ( ( currentPacketChunkIndex + receiveDeltaLength ) > pRtcpPacket->payloadLength ) )
+    {
+        result = RTCP_RESULT_MALFORMED_PACKET;
+    }
+
+    pTwccRunsPacket->runListLength = numRuns;
+    pTwccRunsPacket->arrivalTimeListLength = numArrivalTimes;
+    *pReceiveDeltaStartIndex = currentPacketChunkIndex;
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Replaces the packet statuses stored by ParseTwccPacketChunksToRuns with
+ * the remote arrival times. The receive deltas are already bounds checked. */
+static void ParseTwccRunsReceiveDeltas( RtcpContext_t * pCtx,
+                                        const RtcpPacket_t * pRtcpPacket,
+                                        size_t receiveDeltaStartIndex,
+                                        RtcpTwccRunsPacket_t * pTwccRunsPacket )
+{
+    size_t currentReceiveDeltaIndex = receiveDeltaStartIndex;
+    size_t i;
+    int64_t referenceTicks;
+
+    referenceTicks = RTCP_TWCC_REFERENCE_TIME_TO_TICKS( pTwccRunsPacket->referenceTime );
+
+    for( i = 0; i < pTwccRunsPacket->arrivalTimeListLength; i++ )
+    {
+        if( pTwccRunsPacket->pArrivalTimeList[ i ] == RTCP_TWCC_PACKET_STATUS_SMALL_DELTA )
+        {
+            referenceTicks += pRtcpPacket->pPayload[ currentReceiveDeltaIndex ];
+            currentReceiveDeltaIndex += 1;
+        }
+        else
+        {
+            referenceTicks += ( int16_t ) RTCP_READ_UINT16( &( pRtcpPacket->pPayload[ currentReceiveDeltaIndex ] ) );
+            currentReceiveDeltaIndex += 2;
+        }
+
+        pTwccRunsPacket->pArrivalTimeList[ i ] = RTCP_TWCC_TICKS_TO_HUNDRED_OF_NANOS( referenceTicks );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/* Decodes the packet chunks and the receive deltas together, in batches for
+ * the visitor. The packet must have been validated by ParseTwccPacketChunks,
+ * which also gives the receive delta start index. */
+static void VisitTwccPacketChunks( RtcpContext_t * pCtx,
+                                   const RtcpPacket_t * pRtcpPacket,
+                                   size_t packetChunkStartIndex,
+                                   size_t receiveDeltaStartIndex,
+                                   const RtcpTwccPacket_t * pTwccPacket,
+                                   RtcpTwccArrivalVisitor_t visitor,
+                                   void * pUserData )
+{
+    PacketArrivalInfo_t arrivalInfoBatch[ RTCP_TWCC_VISITOR_BATCH_LENGTH ];
+    size_t batchLength = 0;
+    size_t currentPacketChunkIndex = packetChunkStartIndex;
+    size_t currentReceiveDeltaIndex = receiveDeltaStartIndex;
+    uint16_t packetsRemaining = pTwccPacket->packetStatusCount;
+    uint16_t i, packetChunk, statusSymbol, numPacketsInChunk;
+    uint16_t remoteSeqNum, symbolSize, symbolList = 0;
+    int64_t referenceTicks;
+
+    remoteSeqNum = pTwccPacket->baseSeqNum;
+    referenceTicks = RTCP_TWCC_REFERENCE_TIME_TO_TICKS( pTwccPacket->referenceTime );
+
+    /* Same chunks as ParseTwccPacketChunks, which stopped at the receive
+     * deltas. */
+    while( currentPacketChunkIndex < receiveDeltaStartIndex )
+    {
+        packetChunk = RTCP_READ_UINT16( &( pRtcpPacket->pPayload[ currentPacketChunkIndex ] ) );
+        currentPacketChunkIndex += 2;
+
+        if( RTCP_TWCC_PACKET_CHUNK_EXTRACT_TYPE( packetChunk ) == RTCP_TWCC_PACKET_CHUNK_TYPE_RUN_LENGTH )
+        {
+            statusSymbol = RTCP_TWCC_PACKET_CHUNK_EXTRACT_STATUS( packetChunk );
+            numPacketsInChunk = RTCP_TWCC_PACKET_CHUNK_EXTRACT_RUN_LENGTH( packetChunk );
+            symbolSize = 0;
+        }
+        else
+        {
+            statusSymbol = RTCP_TWCC_PACKET_STATUS_NOT_RECEIVED;
+            symbolSize = RTCP_TWCC_PACKET_CHUNK_EXTRACT_SYMBOL_SIZE( packetChunk );
+            numPacketsInChunk = RTCP_TWCC_PACKET_CHUNK_EXTRACT_SYMBOL_COUNT( packetChunk );
+            numPacketsInChunk = ( packetsRemaining < numPacketsInChunk ) ? packetsRemaining : numPacketsInChunk;
+            symbolList = RTCP_TWCC_PACKET_CHUNK_EXTRACT_SYMBOL_LIST( packetChunk );
+        }
+
+        for( i = 0; i < numPacketsInChunk; i++ )
+        {
+            if( symbolSize != 0 )
+            {
+                statusSymbol = RTCP_TWCC_PACKET_CHUNK_EXTRACT_SYMBOL_FROM_LIST( symbolList, i, symbolSize );
+            }
+
+            arrivalInfoBatch[ batchLength ].seqNum = ( uint16_t ) ( remoteSeqNum + i );
+
+            if( twccReceiveDeltaSizeTable[ statusSymbol ] == 1 )
+            {
+                referenceTicks += pRtcpPacket->pPayload[ currentReceiveDeltaIndex ];
+                currentReceiveDeltaIndex += 1;
+
+                arrivalInfoBatch[ batchLength ].remoteArrivalTime = RTCP_TWCC_TICKS_TO_HUNDRED_OF_NANOS( referenceTicks );
+            }
+            else if( twccReceiveDeltaSizeTable[ statusSymbol ] == 2 )
+            {
+                referenceTicks += ( int16_t ) RTCP_READ_UINT16( &( pRtcpPacket->pPayload[ currentReceiveDeltaIndex ] ) );
+                currentReceiveDeltaIndex += 2;
+
+                arrivalInfoBatch[ batchLength ].remoteArrivalTime = RTCP_TWCC_TICKS_TO_HUNDRED_OF_NANOS( referenceTicks );
+            }
+            else
+            {
+                arrivalInfoBatch[ batchLength ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+            }
+
+            batchLength += 1;
+
+            if( batchLength == RTCP_TWCC_VISITOR_BATCH_LENGTH )
+            {
+                visitor( pUserData,
+                         &( arrivalInfoBatch[ 0 ] ),
+                         batchLength );
+                batchLength = 0;
+            }
+        }
+
+        packetsRemaining -= ( packetsRemaining < numPacketsInChunk ) ? packetsRemaining : numPacketsInChunk;
+        remoteSeqNum += numPacketsInChunk;
+    }
+
+    if( batchLength > 0 )
+    {
+        visitor( pUserData,
+                 &( arrivalInfoBatch[ 0 ] ),
+                 batchLength );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/* Multiplying the lowest set bit by this de Bruijn sequence puts a unique
+ * 5 bit pattern for each bit position in the top bits. */
+static const uint8_t deBruijnBitPositionTable[ 32 ] =
+{
+    0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+    31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+};
+
+/* Returns the position of the lowest set bit of a non zero value. */
+static uint16_t CountTrailingZeros( uint16_t value )
+{
+    uint32_t lowestBit = ( uint32_t ) value & ( ( uint32_t ) 0 - value );
+
+    return deBruijnBitPositionTable[ ( uint32_t ) ( lowestBit * 0x077CB531U ) >> 27 ];
+}
+
+/*-----------------------------------------------------------*/
+
+/* Packs the sequence numbers from *pSeqNumIndex into one NACK FCI entry: the
+ * first one is the PID, and the ones up to 16 after it are bits of the BLP.
+ * Starting each entry at the first sequence number not yet packed gives the
+ * fewest entries. Returns RTCP_RESULT_BAD_PARAM if the sequence numbers are
+ * not in order. */
+static RtcpResult_t GetNextNackFci( const RtcpNackPacket_t * pNackPacket,
+                                    size_t * pSeqNumIndex,
+                                    uint16_t * pPid,
+                                    uint16_t * pBlp )
+{
+    RtcpResult_t result = RTCP_RESULT_OK;
+    size_t seqNumIndex = *pSeqNumIndex;
+    uint16_t pid, blp = 0, distance;
+
+    pid = pNackPacket->pSeqNumList[ seqNumIndex ];
+    seqNumIndex++;
+
+    while( seqNumIndex < pNackPacket->seqNumListLength )
+    {
+        distance = ( uint16_t ) ( pNackPacket->pSeqNumList[ seqNumIndex ] - pid );
+
+        if( distance >= 0x8000 )
+        {
+            /* Before the PID. */
+            result = RTCP_RESULT_BAD_PARAM;
+            break;
+        }
+        else if( distance > 16 )
+        {
+            break;
+        }
+        else if( distance > 0 )
+        {
+            blp |= ( uint16_t ) ( 1U << ( distance - 1U ) );
+        }
+        else
+        {
+            /* Repeated PID. */
+        }
+
+        seqNumIndex++;
+    }
+
+    *pSeqNumIndex = seqNumIndex;
+    *pPid = pid;
+    *pBlp = blp;
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Returns the status of a packet of a TWCC packet being serialized, and its
+ * receive delta from the previous received packet, whose ticks are updated
+ * if this packet is received. Returns RTCP_TWCC_PACKET_STATUS_INVALID if the
+ * receive delta does not fit in a large delta. */
+static uint8_t GetTwccPacketStatus( const PacketArrivalInfo_t * pArrivalInfo,
+                                    uint32_t * pPreviousTicks,
+                                    int32_t * pReceiveDelta )
+{
+    uint8_t status = RTCP_TWCC_PACKET_STATUS_NOT_RECEIVED;
+    int32_t receiveDelta = 0;
+
+    if( pArrivalInfo->remoteArrivalTime != RTCP_TWCC_PACKET_LOST_TIME )
+    {
+        receiveDelta = ( int32_t ) ( RTCP_TWCC_HUNDRED_OF_NANOS_TO_TICKS( pArrivalInfo->remoteArrivalTime ) - *pPreviousTicks );
+
+        if( ( receiveDelta >= 0 ) && ( receiveDelta <= UINT8_MAX ) )
+        {
+            status = RTCP_TWCC_PACKET_STATUS_SMALL_DELTA;
+        }
+        else if( ( receiveDelta >= INT16_MIN ) && ( receiveDelta <= INT16_MAX ) )
+        {
+            status = RTCP_TWCC_PACKET_STATUS_LARGE_DELTA;
+        }
+        else
+        {
+            status = RTCP_TWCC_PACKET_STATUS_INVALID;
+        }
+
+        if( status != RTCP_TWCC_PACKET_STATUS_INVALID )
+        {
+            *pPreviousTicks += ( uint32_t ) receiveDelta;
+        }
+    }
+
+    *pReceiveDelta = receiveDelta;
+
+    return status;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Writes the packet chunks of a TWCC packet. Each chunk is the one of a run
+ * length chunk, a status vector chunk of 14 one bit symbols or one of 7 two
+ * bit symbols which covers the most of the next packets. A status vector
+ * chunk is always read in full, so it covers fewer packets only when it is
+ * the last chunk, padded after the last packet. */
+static RtcpResult_t WriteTwccPacketChunks( RtcpContext_t * pCtx,
+                                           const RtcpTwccPacket_t * pTwccPacket,
+                                           uint8_t * pBuffer,
+                                           size_t bufferLength,
+                                           size_t * pCurrentIndex )
+{
+    RtcpResult_t result = RTCP_RESULT_OK;
+    size_t currentIndex = *pCurrentIndex, packetIndex = 0;
+    size_t windowLength, runLength, oneBitLength, twoBitLength, i;
+    uint8_t statusWindow[ RTCP_TWCC_PACKET_CHUNK_ONE_BIT_SYMBOLS ], status;
+    uint32_t ticksWindow[ RTCP_TWCC_PACKET_CHUNK_ONE_BIT_SYMBOLS ];
+    uint32_t previousTicks, nextTicks;
+    int32_t receiveDelta;
+    uint16_t packetChunk;
+
+    previousTicks = ( uint32_t ) ( pTwccPacket->referenceTime << 8 );
+
+    /* Breaks out on the first error. */
+    while( packetIndex < pTwccPacket->arrivalInfoListLength )
+    {
+        /* The statuses of the next packets, up to a one bit status vector
+         * chunk, and the ticks after each of them. */
+        windowLength = pTwccPacket->arrivalInfoListLength - packetIndex;
+        windowLength = ( windowLength < RTCP_TWCC_PACKET_CHUNK_ONE_BIT_SYMBOLS ) ? windowLength :
+                                                                                   RTCP_TWCC_PACKET_CHUNK_ONE_BIT_SYMBOLS;
+        nextTicks = previousTicks;
+
+        for( i = 0; i < windowLength; i++ )
+        {
+            statusWindow[ i ] = GetTwccPacketStatus( &( pTwccPacket->pArrivalInfoList[ packetIndex + i ] ),
+                                                     &( nextTicks ),
+                                                     &( receiveDelta ) );
+            ticksWindow[ i ] = nextTicks;
+
+            if( statusWindow[ i ] == RTCP_TWCC_PACKET_STATUS_INVALID )
+            {
+                result = RTCP_RESULT_BAD_PARAM;
+                break;
+            }
+        }
+
+        if( ( result == RTCP_RESULT_OK ) &&
+            ( ( currentIndex + 2 ) > bufferLength ) )
+        {
+            result = RTCP_RESULT_OUT_OF_MEMORY;
+        }
+
+        if( result != RTCP_RESULT_OK )
+        {
+            break;
+        }
+
+        runLength = 1;
+        while( ( runLength < windowLength ) &&
+               ( statusWindow[ runLength ] == statusWindow[ 0 ] ) )
+        {
+            runLength++;
+        }
+
+        /* A one bit status vector chunk can not carry a large delta. The
+         * window is shorter than the chunk only for the last chunk. */
+        oneBitLength = windowLength;
+        for( i = 0; i < windowLength; i++ )
+        {
+            if( statusWindow[ i ] == RTCP_TWCC_PACKET_STATUS_LARGE_DELTA )
+            {
+                oneBitLength = 0;
+                break;
+            }
+        }
+
+        twoBitLength = ( windowLength < RTCP_TWCC_PACKET_CHUNK_TWO_BIT_SYMBOLS ) ? windowLength :
+                                                                                  RTCP_TWCC_PACKET_CHUNK_TWO_BIT_SYMBOLS;
+
+        if( ( runLength >= oneBitLength ) &&
+            ( runLength >= twoBitLength ) )
+        {
+            previousTicks = ticksWindow[ runLength - 1 ];
+
+            /* The run may go on past the window. */
+            if( runLength == windowLength )
+            {
+                while( ( ( packetIndex + runLength ) < pTwccPacket->arrivalInfoListLength ) &&
+                       ( runLength < RTCP_TWCC_PACKET_CHUNK_MAX_RUN_LENGTH ) )
                 {
-                    numArrivalInfos += 1;
+                    nextTicks = previousTicks;
+                    status = GetTwccPacketStatus( &( pTwccPacket->pArrivalInfoList[ packetIndex + runLength ] ),
+                                                  &( nextTicks ),
+                                                  &( receiveDelta ) );
+
+                    if( status != statusWindow[ 0 ] )
+                    {
+                        break;
+                    }
+
+                    previousTicks = nextTicks;
+                    runLength++;
                 }
+            }
+
+            packetChunk = ( uint16_t ) ( ( ( uint16_t ) statusWindow[ 0 ] << RTCP_TWCC_PACKET_CHUNK_STATUS_LOCATION ) |
+                                         runLength );
+            packetIndex += runLength;
+        }
+        else if( oneBitLength >= twoBitLength )
+        {
+            packetChunk = RTCP_TWCC_PACKET_CHUNK_TYPE_BITMASK;
+
+            for( i = 0; i < oneBitLength; i++ )
+            {
+                packetChunk |= ( uint16_t ) ( statusWindow[ i ] << ( 13 - i ) );
+            }
+
+            previousTicks = ticksWindow[ oneBitLength - 1 ];
+            packetIndex += oneBitLength;
+        }
+        else
+        {
+            packetChunk = RTCP_TWCC_PACKET_CHUNK_TYPE_BITMASK | RTCP_TWCC_PACKET_CHUNK_SYMBOL_SIZE_BITMASK;
+
+            for( i = 0; i < twoBitLength; i++ )
+            {
+                packetChunk |= ( uint16_t ) ( statusWindow[ i ] << ( 12 - ( 2 * i ) ) );
+            }
+
+            previousTicks = ticksWindow[ twoBitLength - 1 ];
+            packetIndex += twoBitLength;
+        }
+
+        RTCP_WRITE_UINT16( &( pBuffer[ currentIndex ] ),
+                           packetChunk );
+        currentIndex += 2;
+    }
+
+    *pCurrentIndex = currentIndex;
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Writes the receive deltas of a TWCC packet. The statuses are already
+ * validated by WriteTwccPacketChunks. */
+static RtcpResult_t WriteTwccReceiveDeltas( RtcpContext_t * pCtx,
+                                            const RtcpTwccPacket_t * pTwccPacket,
+                                            uint8_t * pBuffer,
+                                            size_t bufferLength,
+                                            size_t * pCurrentIndex )
+{
+    RtcpResult_t result = RTCP_RESULT_OK;
+    size_t currentIndex = *pCurrentIndex, i;
+    uint32_t previousTicks;
+    int32_t receiveDelta;
+    uint8_t status;
+
+    previousTicks = ( uint32_t ) ( pTwccPacket->referenceTime << 8 );
 
-                packetsRemaining -= 1;
-                remoteSeqNum += 1;
-            }
+    for( i = 0; i < pTwccPacket->arrivalInfoListLength; i++ )
+    {
+        status = GetTwccPacketStatus( &( pTwccPacket->pArrivalInfoList[ i ] ),
+                                      &( previousTicks ),
+                                      &( receiveDelta ) );
+
+        if( ( currentIndex + twccReceiveDeltaSizeTable[ status ] ) > bufferLength )
+        {
+            result = RTCP_RESULT_OUT_OF_MEMORY;
+            break;
+        }
+
+        if( status == RTCP_TWCC_PACKET_STATUS_SMALL_DELTA )
+        {
+            pBuffer[ currentIndex ] = ( uint8_t ) receiveDelta;
+            currentIndex += 1;
+        }
+        else if( status == RTCP_TWCC_PACKET_STATUS_LARGE_DELTA )
+        {
+            RTCP_WRITE_UINT16( &( pBuffer[ currentIndex ] ),
+                               ( uint16_t ) receiveDelta );
+            currentIndex += 2;
+        }
+        else
+        {
+            /* Not received. */
         }
     }
 
-    pTwccPacket->arrivalInfoListLength = numArrivalInfos;
+    *pCurrentIndex = currentIndex;
 
     return result;
 }
@@ -742,6 +1528,203 @@ RtcpResult_t Rtcp_SerializeReceiverReport( RtcpContext_t * pCtx,
 
 /*-----------------------------------------------------------*/
 
+RtcpResult_t Rtcp_SerializeNackPacket( RtcpContext_t * pCtx,
+                                       const RtcpNackPacket_t * pNackPacket,
+                                       uint8_t * pBuffer,
+                                       size_t * pBufferLength )
+{
+    uint32_t firstWord;
+    size_t serializedPacketLength = 0, currentIndex = 0, seqNumIndex = 0, numFcis = 0;
+    uint16_t pid, blp;
+    RtcpResult_t result = RTCP_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pNackPacket == NULL ) ||
+        ( pBuffer == NULL ) ||
+        ( pBufferLength == NULL ) ||
+        ( pNackPacket->pSeqNumList == NULL ) ||
+        ( pNackPacket->seqNumListLength == 0 ) )
+    {
+        result = RTCP_RESULT_BAD_PARAM;
+    }
+
+    /* Count the FCI entries, to check the buffer length before writing. */
+    while( ( result == RTCP_RESULT_OK ) &&
+           ( seqNumIndex < pNackPacket->seqNumListLength ) )
+    {
+        result = GetNextNackFci( pNackPacket,
+                                 &( seqNumIndex ),
+                                 &( pid ),
+                                 &( blp ) );
+        numFcis++;
+    }
+
+    if( result == RTCP_RESULT_OK )
+    {
+        serializedPacketLength = RTCP_HEADER_LENGTH +
+                                 RTCP_NACK_PACKET_MIN_PAYLOAD_LENGTH +
+                                 ( ( numFcis - 1 ) * 4 );
+
+        if( ( *pBufferLength < serializedPacketLength ) ||
+            ( ( RTCP_BYTES_TO_WORDS( serializedPacketLength ) - 1U ) > RTCP_HEADER_PACKET_LENGTH_BITMASK ) )
+        {
+            result = RTCP_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == RTCP_RESULT_OK )
+    {
+        firstWord = RTCP_HEADER_VERSION << RTCP_HEADER_VERSION_LOCATION;
+        firstWord |= ( RTCP_FMT_TRANSPORT_SPECIFIC_FEEDBACK_NACK << RTCP_HEADER_RC_LOCATION );
+        firstWord |= ( RTCP_PACKET_TYPE_TRANSPORT_SPECIFIC_FEEDBACK << RTCP_HEADER_PACKET_TYPE_LOCATION );
+        firstWord |= ( ( RTCP_BYTES_TO_WORDS( serializedPacketLength ) - 1U ) << RTCP_HEADER_PACKET_LENGTH_LOCATION );
+
+        /* Write RTCP Packet header. */
+        RTCP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
+                           firstWord );
+        currentIndex += 4;
+
+        RTCP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
+                           pNackPacket->senderSsrc );
+        currentIndex += 4;
+
+        RTCP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
+                           pNackPacket->mediaSourceSsrc );
+        currentIndex += 4;
+
+        /* The sequence numbers are already validated. */
+        seqNumIndex = 0;
+
+        while( seqNumIndex < pNackPacket->seqNumListLength )
+        {
+            ( void ) GetNextNackFci( pNackPacket,
+                                     &( seqNumIndex ),
+                                     &( pid ),
+                                     &( blp ) );
+
+            RTCP_WRITE_UINT16( &( pBuffer[ currentIndex ] ),
+                               pid );
+            currentIndex += 2;
+
+            RTCP_WRITE_UINT16( &( pBuffer[ currentIndex ] ),
+                               blp );
+            currentIndex += 2;
+        }
+
+        /* Update the output parameter to return the serialized packet length.
+         */
+        *pBufferLength = serializedPacketLength;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpResult_t Rtcp_SerializeTwccPacket( RtcpContext_t * pCtx,
+                                       const RtcpTwccPacket_t * pTwccPacket,
+                                       uint8_t * pBuffer,
+                                       size_t * pBufferLength )
+{
+    uint32_t firstWord;
+    size_t currentIndex = 0;
+    RtcpResult_t result = RTCP_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pTwccPacket == NULL ) ||
+        ( pBuffer == NULL ) ||
+        ( pBufferLength == NULL ) ||
+        ( pTwccPacket->pArrivalInfoList == NULL ) ||
+        ( pTwccPacket->arrivalInfoListLength == 0 ) ||
+        ( pTwccPacket->arrivalInfoListLength > UINT16_MAX ) )
+    {
+        result = RTCP_RESULT_BAD_PARAM;
+    }
+
+    if( ( result == RTCP_RESULT_OK ) &&
+        ( *pBufferLength < ( RTCP_HEADER_LENGTH + RTCP_TWCC_PACKET_MIN_PAYLOAD_LENGTH ) ) )
+    {
+        result = RTCP_RESULT_OUT_OF_MEMORY;
+    }
+
+    if( result == RTCP_RESULT_OK )
+    {
+        /* The RTCP header is written last, once the length is known. */
+        currentIndex += 4;
+
+        RTCP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
+                           pTwccPacket->senderSsrc );
+        currentIndex += 4;
+
+        RTCP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
+                           pTwccPacket->mediaSourceSsrc );
+        currentIndex += 4;
+
+        RTCP_WRITE_UINT16( &( pBuffer[ currentIndex ] ),
+                           pTwccPacket->baseSeqNum );
+        currentIndex += 2;
+
+        RTCP_WRITE_UINT16( &( pBuffer[ currentIndex ] ),
+                           ( uint16_t ) pTwccPacket->arrivalInfoListLength );
+        currentIndex += 2;
+
+        RTCP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
+                           ( ( pTwccPacket->referenceTime << RTCP_TWCC_REFERENCE_TIME_LOCATION ) & RTCP_TWCC_REFERENCE_TIME_BITMASK ) |
+                           ( ( ( uint32_t ) pTwccPacket->feedbackPacketCount << RTCP_TWCC_FEEDBACK_PACKET_COUNT_LOCATION ) & RTCP_TWCC_FEEDBACK_PACKET_COUNT_BITMASK ) );
+        currentIndex += 4;
+
+        result = WriteTwccPacketChunks( pCtx,
+                                        pTwccPacket,
+                                        pBuffer,
+                                        *pBufferLength,
+                                        &( currentIndex ) );
+    }
+
+    if( result == RTCP_RESULT_OK )
+    {
+        result = WriteTwccReceiveDeltas( pCtx,
+                                         pTwccPacket,
+                                         pBuffer,
+                                         *pBufferLength,
+                                         &( currentIndex ) );
+    }
+
+    /* Zero padding to a word boundary. */
+    while( ( result == RTCP_RESULT_OK ) &&
+           ( ( currentIndex % 4 ) != 0 ) )
+    {
+        if( currentIndex < *pBufferLength )
+        {
+            pBuffer[ currentIndex ] = 0;
+            currentIndex += 1;
+        }
+        else
+        {
+            result = RTCP_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == RTCP_RESULT_OK )
+    {
+        firstWord = RTCP_HEADER_VERSION << RTCP_HEADER_VERSION_LOCATION;
+        firstWord |= ( RTCP_FMT_TRANSPORT_SPECIFIC_FEEDBACK_TWCC << RTCP_HEADER_RC_LOCATION );
+        firstWord |= ( RTCP_PACKET_TYPE_TRANSPORT_SPECIFIC_FEEDBACK << RTCP_HEADER_PACKET_TYPE_LOCATION );
+        firstWord |= ( ( RTCP_BYTES_TO_WORDS( currentIndex ) - 1U ) << RTCP_HEADER_PACKET_LENGTH_LOCATION );
+
+        /* Write RTCP Packet header. */
+        RTCP_WRITE_UINT32( &( pBuffer[ 0 ] ),
+                           firstWord );
+
+        /* Update the output parameter to return the serialized packet length.
+         */
+        *pBufferLength = currentIndex;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
 RtcpResult_t Rtcp_DeserializePacket( RtcpContext_t * pCtx,
                                      const uint8_t * pSerializedPacket,
                                      size_t serializedPacketLength,
@@ -1176,26 +2159,26 @@ RtcpResult_t Rtcp_ParseNackPacket( RtcpContext_t * pCtx,
 
             seqNumCount += 1;
 
-            /* Iterate over 16 bits of bitmask. */
-            for( i = 0; i < 16; i++ )
+            /* Iterate over the set bits of bitmask only. */
+            while( bitmask != 0 )
             {
-                if( ( bitmask & ( 1 << i ) ) != 0 )
+                i = CountTrailingZeros( bitmask );
+                bitmask &= ( uint16_t ) ( bitmask - 1U );
+
+                if( pNackPacket->pSeqNumList != NULL )
                 {
-                    if( pNackPacket->pSeqNumList != NULL )
+                    if( seqNumCount < pNackPacket->seqNumListLength )
                     {
-                        if( seqNumCount < pNackPacket->seqNumListLength )
-                        {
-                            pNackPacket->pSeqNumList[ seqNumCount ] = startingSeqNum + i + 1;
-                        }
-                        else
-                        {
-                            result = RTCP_RESULT_OUT_OF_MEMORY;
-                            break;
-                        }
+                        pNackPacket->pSeqNumList[ seqNumCount ] = startingSeqNum + i + 1;
+                    }
+                    else
+                    {
+                        result = RTCP_RESULT_OUT_OF_MEMORY;
+                        break;
                     }
-
-                    seqNumCount += 1;
                 }
+
+                seqNumCount += 1;
             }
         }
 
@@ -1207,14 +2190,67 @@ RtcpResult_t Rtcp_ParseNackPacket( RtcpContext_t * pCtx,
 
 /*-----------------------------------------------------------*/
 
+RtcpResult_t Rtcp_ParseNackPacketFcis( RtcpContext_t * pCtx,
+                                       const RtcpPacket_t * pRtcpPacket,
+                                       RtcpNackFciPacket_t * pNackFciPacket )
+{
+    RtcpResult_t result = RTCP_RESULT_OK;
+    size_t currentIndex = 0, fciCount = 0, i;
+
+    if( ( pCtx == NULL ) ||
+        ( pRtcpPacket == NULL ) ||
+        ( pNackFciPacket == NULL ) ||
+        ( pRtcpPacket->pPayload == NULL ) ||
+        ( pRtcpPacket->payloadLength < RTCP_NACK_PACKET_MIN_PAYLOAD_LENGTH ) ||
+        ( ( pRtcpPacket->payloadLength % 4 ) != 0 ) ||
+        ( pRtcpPacket->header.packetType != RTCP_PACKET_TRANSPORT_FEEDBACK_NACK ) )
+    {
+        result = RTCP_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_RESULT_OK )
+    {
+        pNackFciPacket->senderSsrc = RTCP_READ_UINT32( &( pRtcpPacket->pPayload[ currentIndex ] ) );
+        currentIndex += 4;
+
+        pNackFciPacket->mediaSourceSsrc = RTCP_READ_UINT32( &( pRtcpPacket->pPayload[ currentIndex ] ) );
+        currentIndex += 4;
+
+        fciCount = ( pRtcpPacket->payloadLength - currentIndex ) / 4;
+
+        if( ( pNackFciPacket->pFciList != NULL ) &&
+            ( fciCount > pNackFciPacket->fciListLength ) )
+        {
+            result = RTCP_RESULT_OUT_OF_MEMORY;
+        }
+
+        pNackFciPacket->fciListLength = fciCount;
+    }
+
+    if( ( result == RTCP_RESULT_OK ) &&
+        ( pNackFciPacket->pFciList != NULL ) )
+    {
+        for( i = 0; i < fciCount; i++ )
+        {
+            pNackFciPacket->pFciList[ i ].pid = RTCP_READ_UINT16( &( pRtcpPacket->pPayload[ currentIndex ] ) );
+            currentIndex += 2;
+
+            pNackFciPacket->pFciList[ i ].blp = RTCP_READ_UINT16( &( pRtcpPacket->pPayload[ currentIndex ] ) );
+            currentIndex += 2;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
 RtcpResult_t Rtcp_ParseTwccPacket( RtcpContext_t * pCtx,
                                    const RtcpPacket_t * pRtcpPacket,
                                    RtcpTwccPacket_t * pTwccPacket )
 {
     RtcpResult_t result = RTCP_RESULT_OK;
-    uint32_t word;
-    uint16_t packetsToParse = 0, packetChunk, symbolCount;
-    size_t currentIndex = 0, packetChunkStartIndex, receiveDeltaStartIndex;
+    size_t currentIndex, receiveDeltaStartIndex;
 
     if( ( pCtx == NULL ) ||
         ( pRtcpPacket == NULL ) ||
@@ -1228,52 +2264,137 @@ RtcpResult_t Rtcp_ParseTwccPacket( RtcpContext_t * pCtx,
 
     if( result == RTCP_RESULT_OK )
     {
-        pTwccPacket->senderSsrc = RTCP_READ_UINT32( &( pRtcpPacket->pPayload[ currentIndex ] ) );
-        currentIndex += 4;
+        currentIndex = ReadTwccPacketHeader( pCtx,
+                                             pRtcpPacket,
+                                             pTwccPacket );
 
-        pTwccPacket->mediaSourceSsrc = RTCP_READ_UINT32( &( pRtcpPacket->pPayload[ currentIndex ] ) );
-        currentIndex += 4;
+        result = ParseTwccPacketChunks( pCtx,
+                                        pRtcpPacket,
+                                        currentIndex,
+                                        pTwccPacket,
+                                        &( receiveDeltaStartIndex ) );
+    }
 
-        pTwccPacket->baseSeqNum = RTCP_READ_UINT16( &( pRtcpPacket->pPayload[ currentIndex ] ) );
-        currentIndex += 2;
+    /* On out of memory, the arrival infos which fit are still resolved. */
+    if( ( ( result == RTCP_RESULT_OK ) ||
+          ( result == RTCP_RESULT_OUT_OF_MEMORY ) ) &&
+        ( pTwccPacket->pArrivalInfoList != NULL ) )
+    {
+        ParseTwccReceiveDeltas( pCtx,
+                                pRtcpPacket,
+                                receiveDeltaStartIndex,
+                                pTwccPacket );
+    }
 
-        pTwccPacket->packetStatusCount = RTCP_READ_UINT16( &( pRtcpPacket->pPayload[ currentIndex ] ) );
-        currentIndex += 2;
+    return result;
+}
 
-        word = RTCP_READ_UINT32( &( pRtcpPacket->pPayload[ currentIndex ] ) );
-        currentIndex += 4;
-        pTwccPacket->referenceTime = ( word & RTCP_TWCC_REFERENCE_TIME_BITMASK ) >>
-                                     RTCP_TWCC_REFERENCE_TIME_LOCATION;
-        pTwccPacket->feedbackPacketCount = ( word & RTCP_TWCC_FEEDBACK_PACKET_COUNT_BITMASK ) >>
-                                           RTCP_TWCC_FEEDBACK_PACKET_COUNT_LOCATION;
+/*-----------------------------------------------------------*/
 
-        packetChunkStartIndex = currentIndex;
-        packetsToParse = pTwccPacket->packetStatusCount;
+RtcpResult_t Rtcp_ParseTwccPacketRuns( RtcpContext_t * pCtx,
+                                       const RtcpPacket_t * pRtcpPacket,
+                                       RtcpTwccRunsPacket_t * pTwccRunsPacket )
+{
+    RtcpResult_t result = RTCP_RESULT_OK;
+    RtcpTwccPacket_t twccPacket;
+    size_t currentIndex, receiveDeltaStartIndex;
 
-        while( ( packetsToParse > 0 ) &&
-               ( ( currentIndex + 1 ) < pRtcpPacket->payloadLength ) ) /* +1 because we read 2 bytes at a time. */
-        {
-            packetChunk = RTCP_READ_UINT16( &( pRtcpPacket->pPayload[ currentIndex ] ) );
-            currentIndex += 2;
+    if( ( pCtx == NULL ) ||
+        ( pRtcpPacket == NULL ) ||
+        ( pTwccRunsPacket == NULL ) ||
+        ( pRtcpPacket->pPayload == NULL ) ||
+        ( pRtcpPacket->payloadLength < RTCP_TWCC_PACKET_MIN_PAYLOAD_LENGTH ) ||
+        ( pRtcpPacket->header.packetType != RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC ) )
+    {
+        result = RTCP_RESULT_BAD_PARAM;
+    }
 
-            if( RTCP_TWCC_PACKET_CHUNK_EXTRACT_TYPE( packetChunk ) == RTCP_TWCC_PACKET_CHUNK_TYPE_RUN_LENGTH )
-            {
-                packetsToParse -= RTCP_TWCC_PACKET_CHUNK_EXTRACT_RUN_LENGTH( packetChunk );
-            }
-            else
-            {
-                symbolCount = RTCP_TWCC_PACKET_CHUNK_EXTRACT_SYMBOL_COUNT( packetChunk );
-                packetsToParse -= ( packetsToParse < symbolCount ) ? packetsToParse : symbolCount;
-            }
-        }
+    if( result == RTCP_RESULT_OK )
+    {
+        currentIndex = ReadTwccPacketHeader( pCtx,
+                                             pRtcpPacket,
+                                             &( twccPacket ) );
+
+        pTwccRunsPacket->senderSsrc = twccPacket.senderSsrc;
+        pTwccRunsPacket->mediaSourceSsrc = twccPacket.mediaSourceSsrc;
+        pTwccRunsPacket->baseSeqNum = twccPacket.baseSeqNum;
+        pTwccRunsPacket->packetStatusCount = twccPacket.packetStatusCount;
+        pTwccRunsPacket->referenceTime = twccPacket.referenceTime;
+        pTwccRunsPacket->feedbackPacketCount = twccPacket.feedbackPacketCount;
+
+        result = ParseTwccPacketChunksToRuns( pCtx,
+                                              pRtcpPacket,
+                                              currentIndex,
+                                              pTwccRunsPacket,
+                                              &( receiveDeltaStartIndex ) );
+    }
+
+    if( ( result == RTCP_RESULT_OK ) &&
+        ( pTwccRunsPacket->pArrivalTimeList != NULL ) )
+    {
+        ParseTwccRunsReceiveDeltas( pCtx,
+                                    pRtcpPacket,
+                                    receiveDeltaStartIndex,
+                                    pTwccRunsPacket );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpResult_t Rtcp_VisitTwccPacket( RtcpContext_t * pCtx,
+                                   const RtcpPacket_t * pRtcpPacket,
+                                   RtcpTwccPacket_t * pTwccPacket,
+                                   RtcpTwccArrivalVisitor_t visitor,
+                                   void * pUserData )
+{
+    RtcpResult_t result = RTCP_RESULT_OK;
+    RtcpTwccPacket_t twccPacket;
+    size_t packetChunkStartIndex, receiveDeltaStartIndex;
+
+    if( ( pCtx == NULL ) ||
+        ( pRtcpPacket == NULL ) ||
+        ( pTwccPacket == NULL ) ||
+        ( visitor == NULL ) ||
+        ( pRtcpPacket->pPayload == NULL ) ||
+        ( pRtcpPacket->payloadLength < RTCP_TWCC_PACKET_MIN_PAYLOAD_LENGTH ) ||
+        ( pRtcpPacket->header.packetType != RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC ) )
+    {
+        result = RTCP_RESULT_BAD_PARAM;
+    }
 
-        receiveDeltaStartIndex = currentIndex;
+    if( result == RTCP_RESULT_OK )
+    {
+        packetChunkStartIndex = ReadTwccPacketHeader( pCtx,
+                                                      pRtcpPacket,
+                                                      pTwccPacket );
+
+        /* Only counts the arrival infos and validates the receive deltas,
+         * reading the packet chunks but not the receive deltas. The caller's
+         * arrival info list is left alone. */
+        twccPacket = *pTwccPacket;
+        twccPacket.pArrivalInfoList = NULL;
+        twccPacket.arrivalInfoListLength = 0;
 
         result = ParseTwccPacketChunks( pCtx,
                                         pRtcpPacket,
                                         packetChunkStartIndex,
-                                        receiveDeltaStartIndex,
-                                        pTwccPacket );
+                                        &( twccPacket ),
+                                        &( receiveDeltaStartIndex ) );
+
+        pTwccPacket->arrivalInfoListLength = twccPacket.arrivalInfoListLength;
+    }
+
+    if( result == RTCP_RESULT_OK )
+    {
+        VisitTwccPacketChunks( pCtx,
+                               pRtcpPacket,
+                               packetChunkStartIndex,
+                               receiveDeltaStartIndex,
+                               pTwccPacket,
+                               visitor,
+                               pUserData );
     }
 
     return result;
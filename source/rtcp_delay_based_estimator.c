@@ -0,0 +1,527 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "rtcp_delay_based_estimator.h"
+
+/*-----------------------------------------------------------*/
+
+#define HUNDREDS_OF_NANOS_IN_A_MS                   10000
+#define HUNDREDS_OF_NANOS_IN_A_SECOND               10000000
+
+/* Q16 fixed point, i.e. 1/65536 units. */
+#define Q16_SHIFT                                   16
+#define Q16( value )                                ( ( int64_t ) ( value ) << Q16_SHIFT )
+
+#define TIME_DELTA_TO_Q16_MS( delta ) \
+    ( ( ( int64_t ) ( delta ) * Q16( 1 ) ) / HUNDREDS_OF_NANOS_IN_A_MS )
+
+/* The trendline arrival times are in 1/16 ms, so that the sums of squares
+ * of the window do not overflow even with pauses of minutes. */
+#define TIME_DELTA_TO_ARRIVAL_TIME( delta ) \
+    ( ( int64_t ) ( delta ) / ( HUNDREDS_OF_NANOS_IN_A_MS / 16 ) )
+#define ARRIVAL_TIME_SCALE                          16
+
+/* Trendline filter parameters. The smoothing coefficient is 0.9. */
+#define TRENDLINE_SMOOTHING_NUMERATOR               9
+#define TRENDLINE_SMOOTHING_DENOMINATOR             10
+#define TRENDLINE_THRESHOLD_GAIN                    4
+#define TRENDLINE_MAX_NUM_DELTAS                    60
+
+/* Overuse detector parameters. The threshold gains are per ms. */
+#define OVERUSE_TIME_THRESHOLD                      ( 10 * HUNDREDS_OF_NANOS_IN_A_MS )
+#define OVERUSE_INITIAL_THRESHOLD                   ( Q16( 25 ) / 2 )
+#define OVERUSE_MIN_THRESHOLD                       Q16( 6 )
+#define OVERUSE_MAX_THRESHOLD                       Q16( 600 )
+#define OVERUSE_THRESHOLD_GAIN_UP_NUMERATOR         87
+#define OVERUSE_THRESHOLD_GAIN_DOWN_NUMERATOR       390
+#define OVERUSE_THRESHOLD_GAIN_DENOMINATOR          10000
+#define OVERUSE_MAX_THRESHOLD_UPDATE_INTERVAL       ( 100 * HUNDREDS_OF_NANOS_IN_A_MS )
+#define OVERUSE_MAX_THRESHOLD_DEVIATION             Q16( 15 )
+
+/* AIMD rate controller parameters. Decrease to 85%, increase by 8% per
+ * second. */
+#define RATE_CONTROL_DECREASE_NUMERATOR             85
+#define RATE_CONTROL_DECREASE_DENOMINATOR           100
+#define RATE_CONTROL_INCREASE_NUMERATOR             8
+#define RATE_CONTROL_INCREASE_DENOMINATOR           100
+#define RATE_CONTROL_MIN_INCREASE_BPS_PER_SECOND    1000
+#define RATE_CONTROL_MAX_ACKED_BITRATE_NUMERATOR    3
+#define RATE_CONTROL_MAX_ACKED_BITRATE_DENOMINATOR  2
+#define RATE_CONTROL_MAX_ACKED_BITRATE_MARGIN_BPS   10000
+#define RATE_CONTROL_MAX_UPDATE_INTERVAL            HUNDREDS_OF_NANOS_IN_A_SECOND
+
+/*-----------------------------------------------------------*/
+
+static int64_t AbsoluteValue( int64_t value )
+{
+    return ( value < 0 ) ? -value : value;
+}
+
+/*-----------------------------------------------------------*/
+
+static void StartPacketGroup( RtcpPacketGroup_t * pPacketGroup,
+                              uint64_t localSentTime,
+                              uint64_t remoteArrivalTime,
+                              size_t packetSize )
+{
+    pPacketGroup->firstSentTime = localSentTime;
+    pPacketGroup->lastSentTime = localSentTime;
+    pPacketGroup->lastArrivalTime = remoteArrivalTime;
+    pPacketGroup->size = packetSize;
+}
+
+/*-----------------------------------------------------------*/
+
+static int64_t CalculateTrendlineSlope( const RtcpDelayBasedEstimator_t * pEstimator )
+{
+    size_t i;
+    int64_t sumX = 0, sumY = 0, averageX, averageY, deviationX;
+    int64_t numerator = 0, denominator = 0;
+    int64_t slope = pEstimator->trend;
+
+    for( i = 0; i < pEstimator->windowCount; i++ )
+    {
+        sumX += pEstimator->arrivalTimeWindow[ i ];
+        sumY += pEstimator->smoothedDelayWindow[ i ];
+    }
+
+    averageX = sumX / ( int64_t ) pEstimator->windowCount;
+    averageY = sumY / ( int64_t ) pEstimator->windowCount;
+
+    for( i = 0; i < pEstimator->windowCount; i++ )
+    {
+        deviationX = pEstimator->arrivalTimeWindow[ i ] - averageX;
+        numerator += deviationX * ( pEstimator->smoothedDelayWindow[ i ] - averageY );
+        denominator += deviationX * deviationX;
+    }
+
+    /* All the samples arrived at the same time - keep the previous trend.
+     * The Q16 delays over the arrival times in 1/16 ms are scaled back to
+     * ms, without overflowing the intermediate product. */
+    if( denominator != 0 )
+    {
+        slope = ( ( numerator / denominator ) * ARRIVAL_TIME_SCALE ) +
+                ( ( ( numerator % denominator ) * ARRIVAL_TIME_SCALE ) / denominator );
+    }
+
+    return slope;
+}
+
+/*-----------------------------------------------------------*/
+
+static void UpdateThreshold( RtcpDelayBasedEstimator_t * pEstimator,
+                             int64_t modifiedTrend,
+                             uint64_t arrivalTime )
+{
+    int64_t absoluteTrend, gainNumerator, timeDelta = 0;
+
+    if( ( pEstimator->lastThresholdUpdateTime != 0 ) &&
+        ( arrivalTime > pEstimator->lastThresholdUpdateTime ) )
+    {
+        timeDelta = ( int64_t ) ( arrivalTime - pEstimator->lastThresholdUpdateTime );
+
+        if( timeDelta > OVERUSE_MAX_THRESHOLD_UPDATE_INTERVAL )
+        {
+            timeDelta = OVERUSE_MAX_THRESHOLD_UPDATE_INTERVAL;
+        }
+    }
+
+    absoluteTrend = AbsoluteValue( modifiedTrend );
+
+    /* Do not let sudden spikes (e.g. a route change) move the threshold. */
+    if( absoluteTrend <= ( pEstimator->threshold + OVERUSE_MAX_THRESHOLD_DEVIATION ) )
+    {
+        gainNumerator = ( absoluteTrend < pEstimator->threshold ) ? OVERUSE_THRESHOLD_GAIN_DOWN_NUMERATOR :
+                        OVERUSE_THRESHOLD_GAIN_UP_NUMERATOR;
+        pEstimator->threshold += ( ( absoluteTrend - pEstimator->threshold ) * gainNumerator * timeDelta ) /
+                                 ( ( int64_t ) OVERUSE_THRESHOLD_GAIN_DENOMINATOR * HUNDREDS_OF_NANOS_IN_A_MS );
+
+        if( pEstimator->threshold < OVERUSE_MIN_THRESHOLD )
+        {
+            pEstimator->threshold = OVERUSE_MIN_THRESHOLD;
+        }
+        else if( pEstimator->threshold > OVERUSE_MAX_THRESHOLD )
+        {
+            pEstimator->threshold = OVERUSE_MAX_THRESHOLD;
+        }
+        else
+        {
+            /* Threshold is within bounds. */
+        }
+    }
+
+    pEstimator->lastThresholdUpdateTime = arrivalTime;
+}
+
+/*-----------------------------------------------------------*/
+
+static void DetectOveruse( RtcpDelayBasedEstimator_t * pEstimator,
+                           uint64_t sendDelta,
+                           uint64_t arrivalTime )
+{
+    int64_t modifiedTrend;
+    uint32_t numDeltas;
+
+    numDeltas = ( pEstimator->numDeltas < TRENDLINE_MAX_NUM_DELTAS ) ? pEstimator->numDeltas :
+                TRENDLINE_MAX_NUM_DELTAS;
+    modifiedTrend = ( int64_t ) numDeltas * pEstimator->trend * TRENDLINE_THRESHOLD_GAIN;
+
+    if( modifiedTrend > pEstimator->threshold )
+    {
+        if( pEstimator->timeOverUsing < 0 )
+        {
+            /* Assume that we have been overusing for half of the time since
+             * the previous sample. */
+            pEstimator->timeOverUsing = ( int64_t ) ( sendDelta / 2 );
+        }
+        else
+        {
+            pEstimator->timeOverUsing += ( int64_t ) sendDelta;
+        }
+
+        pEstimator->overuseCounter += 1;
+
+        if( ( pEstimator->timeOverUsing > OVERUSE_TIME_THRESHOLD ) &&
+            ( pEstimator->overuseCounter > 1 ) &&
+            ( pEstimator->trend >= pEstimator->previousTrend ) )
+        {
+            pEstimator->timeOverUsing = 0;
+            pEstimator->overuseCounter = 0;
+            pEstimator->bandwidthUsage = RTCP_BANDWIDTH_USAGE_OVERUSING;
+        }
+    }
+    else if( modifiedTrend < -pEstimator->threshold )
+    {
+        pEstimator->timeOverUsing = -1;
+        pEstimator->overuseCounter = 0;
+        pEstimator->bandwidthUsage = RTCP_BANDWIDTH_USAGE_UNDERUSING;
+    }
+    else
+    {
+        pEstimator->timeOverUsing = -1;
+        pEstimator->overuseCounter = 0;
+        pEstimator->bandwidthUsage = RTCP_BANDWIDTH_USAGE_NORMAL;
+    }
+
+    pEstimator->previousTrend = pEstimator->trend;
+
+    UpdateThreshold( pEstimator,
+                     modifiedTrend,
+                     arrivalTime );
+}
+
+/*-----------------------------------------------------------*/
+
+static void UpdateTrendline( RtcpDelayBasedEstimator_t * pEstimator,
+                             uint64_t sendDelta,
+                             int64_t arrivalDelta,
+                             uint64_t arrivalTime )
+{
+    if( pEstimator->numDeltas == 0 )
+    {
+        pEstimator->firstArrivalTime = arrivalTime;
+    }
+
+    if( pEstimator->numDeltas < TRENDLINE_MAX_NUM_DELTAS )
+    {
+        pEstimator->numDeltas += 1;
+    }
+
+    /* The accumulated delay is kept in 100s of nanoseconds so that the
+     * conversion to ms does not accumulate rounding errors. */
+    pEstimator->accumulatedDelay += arrivalDelta - ( int64_t ) sendDelta;
+    pEstimator->smoothedDelay = ( ( TRENDLINE_SMOOTHING_NUMERATOR * pEstimator->smoothedDelay ) +
+                                  ( ( TRENDLINE_SMOOTHING_DENOMINATOR - TRENDLINE_SMOOTHING_NUMERATOR ) *
+                                    TIME_DELTA_TO_Q16_MS( pEstimator->accumulatedDelay ) ) ) /
+                                TRENDLINE_SMOOTHING_DENOMINATOR;
+
+    pEstimator->arrivalTimeWindow[ pEstimator->windowIndex ] = TIME_DELTA_TO_ARRIVAL_TIME( arrivalTime - pEstimator->firstArrivalTime );
+    pEstimator->smoothedDelayWindow[ pEstimator->windowIndex ] = pEstimator->smoothedDelay;
+    pEstimator->windowIndex = ( pEstimator->windowIndex + 1 ) % RTCP_DELAY_BASED_ESTIMATOR_TRENDLINE_WINDOW_LENGTH;
+
+    if( pEstimator->windowCount < RTCP_DELAY_BASED_ESTIMATOR_TRENDLINE_WINDOW_LENGTH )
+    {
+        pEstimator->windowCount += 1;
+    }
+
+    /* The trend is only estimated once the window is full. */
+    if( pEstimator->windowCount == RTCP_DELAY_BASED_ESTIMATOR_TRENDLINE_WINDOW_LENGTH )
+    {
+        pEstimator->trend = CalculateTrendlineSlope( pEstimator );
+    }
+
+    DetectOveruse( pEstimator,
+                   sendDelta,
+                   arrivalTime );
+}
+
+/*-----------------------------------------------------------*/
+
+static void UpdateAckedBitrate( RtcpDelayBasedEstimator_t * pEstimator,
+                                uint64_t arrivalTime,
+                                size_t packetSize )
+{
+    uint64_t windowDuration;
+
+    if( pEstimator->ackedWindowStarted == 0 )
+    {
+        pEstimator->ackedWindowStartTime = arrivalTime;
+        pEstimator->ackedWindowBytes = 0;
+        pEstimator->ackedWindowStarted = 1;
+    }
+
+    pEstimator->ackedWindowBytes += packetSize;
+
+    if( arrivalTime > pEstimator->ackedWindowStartTime )
+    {
+        windowDuration = arrivalTime - pEstimator->ackedWindowStartTime;
+
+        if( windowDuration >= RTCP_DELAY_BASED_ESTIMATOR_ACKED_BITRATE_WINDOW )
+        {
+            pEstimator->ackedBitrateBps = ( uint32_t ) ( ( ( uint64_t ) pEstimator->ackedWindowBytes * 8 * HUNDREDS_OF_NANOS_IN_A_SECOND ) /
+                                                         windowDuration );
+            pEstimator->ackedWindowStartTime = arrivalTime;
+            pEstimator->ackedWindowBytes = 0;
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void UpdateRateControl( RtcpDelayBasedEstimator_t * pEstimator,
+                               uint64_t arrivalTime )
+{
+    uint64_t bitrateBps, increaseBps, maxBitrateBps;
+    uint64_t timeDelta = 0;
+
+    if( ( pEstimator->lastRateUpdateTime != 0 ) &&
+        ( arrivalTime > pEstimator->lastRateUpdateTime ) )
+    {
+        timeDelta = arrivalTime - pEstimator->lastRateUpdateTime;
+
+        if( timeDelta > RATE_CONTROL_MAX_UPDATE_INTERVAL )
+        {
+            timeDelta = RATE_CONTROL_MAX_UPDATE_INTERVAL;
+        }
+    }
+
+    pEstimator->lastRateUpdateTime = arrivalTime;
+
+    /* State transitions of the AIMD rate controller. */
+    if( pEstimator->bandwidthUsage == RTCP_BANDWIDTH_USAGE_OVERUSING )
+    {
+        pEstimator->rateControlState = RTCP_RATE_CONTROL_STATE_DECREASE;
+    }
+    else if( pEstimator->bandwidthUsage == RTCP_BANDWIDTH_USAGE_UNDERUSING )
+    {
+        pEstimator->rateControlState = RTCP_RATE_CONTROL_STATE_HOLD;
+    }
+    else if( pEstimator->rateControlState == RTCP_RATE_CONTROL_STATE_HOLD )
+    {
+        pEstimator->rateControlState = RTCP_RATE_CONTROL_STATE_INCREASE;
+    }
+    else
+    {
+        /* Keep increasing, or decrease once more. */
+    }
+
+    bitrateBps = pEstimator->targetBitrateBps;
+
+    if( pEstimator->rateControlState == RTCP_RATE_CONTROL_STATE_INCREASE )
+    {
+        increaseBps = ( bitrateBps * RATE_CONTROL_INCREASE_NUMERATOR * timeDelta ) /
+                      ( ( uint64_t ) RATE_CONTROL_INCREASE_DENOMINATOR * HUNDREDS_OF_NANOS_IN_A_SECOND );
+
+        if( increaseBps < ( ( RATE_CONTROL_MIN_INCREASE_BPS_PER_SECOND * timeDelta ) / HUNDREDS_OF_NANOS_IN_A_SECOND ) )
+        {
+            increaseBps = ( RATE_CONTROL_MIN_INCREASE_BPS_PER_SECOND * timeDelta ) / HUNDREDS_OF_NANOS_IN_A_SECOND;
+        }
+
+        bitrateBps += increaseBps;
+
+        /* Do not run too far ahead of what the network delivers. */
+        if( pEstimator->ackedBitrateBps != 0 )
+        {
+            maxBitrateBps = ( ( ( uint64_t ) pEstimator->ackedBitrateBps * RATE_CONTROL_MAX_ACKED_BITRATE_NUMERATOR ) /
+                              RATE_CONTROL_MAX_ACKED_BITRATE_DENOMINATOR ) +
+                            RATE_CONTROL_MAX_ACKED_BITRATE_MARGIN_BPS;
+
+            if( bitrateBps > maxBitrateBps )
+            {
+                bitrateBps = ( maxBitrateBps > pEstimator->targetBitrateBps ) ? maxBitrateBps :
+                             pEstimator->targetBitrateBps;
+            }
+        }
+    }
+    else if( pEstimator->rateControlState == RTCP_RATE_CONTROL_STATE_DECREASE )
+    {
+        if( pEstimator->ackedBitrateBps != 0 )
+        {
+            bitrateBps = pEstimator->ackedBitrateBps;
+        }
+
+        bitrateBps = ( bitrateBps * RATE_CONTROL_DECREASE_NUMERATOR ) / RATE_CONTROL_DECREASE_DENOMINATOR;
+
+        /* Never increase on overuse. */
+        if( bitrateBps > pEstimator->targetBitrateBps )
+        {
+            bitrateBps = pEstimator->targetBitrateBps;
+        }
+
+        pEstimator->rateControlState = RTCP_RATE_CONTROL_STATE_HOLD;
+    }
+    else
+    {
+        /* Hold the current bitrate. */
+    }
+
+    if( bitrateBps < pEstimator->minBitrateBps )
+    {
+        bitrateBps = pEstimator->minBitrateBps;
+    }
+    else if( bitrateBps > pEstimator->maxBitrateBps )
+    {
+        bitrateBps = pEstimator->maxBitrateBps;
+    }
+    else
+    {
+        /* Bitrate is within bounds. */
+    }
+
+    pEstimator->targetBitrateBps = ( uint32_t ) bitrateBps;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpDelayBasedEstimatorResult_t RtcpDelayBasedEstimator_Init( RtcpDelayBasedEstimator_t * pEstimator,
+                                                              uint32_t initialBitrateBps,
+                                                              uint32_t minBitrateBps,
+                                                              uint32_t maxBitrateBps )
+{
+    RtcpDelayBasedEstimatorResult_t result = RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK;
+
+    if( ( pEstimator == NULL ) ||
+        ( minBitrateBps > maxBitrateBps ) ||
+        ( initialBitrateBps < minBitrateBps ) ||
+        ( initialBitrateBps > maxBitrateBps ) )
+    {
+        result = RTCP_DELAY_BASED_ESTIMATOR_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK )
+    {
+        memset( pEstimator,
+                0,
+                sizeof( RtcpDelayBasedEstimator_t ) );
+
+        pEstimator->threshold = OVERUSE_INITIAL_THRESHOLD;
+        pEstimator->timeOverUsing = -1;
+        pEstimator->bandwidthUsage = RTCP_BANDWIDTH_USAGE_NORMAL;
+        pEstimator->rateControlState = RTCP_RATE_CONTROL_STATE_HOLD;
+        pEstimator->targetBitrateBps = initialBitrateBps;
+        pEstimator->minBitrateBps = minBitrateBps;
+        pEstimator->maxBitrateBps = maxBitrateBps;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpDelayBasedEstimatorResult_t RtcpDelayBasedEstimator_AddPacketFeedback( RtcpDelayBasedEstimator_t * pEstimator,
+                                                                           uint64_t localSentTime,
+                                                                           uint64_t remoteArrivalTime,
+                                                                           size_t packetSize )
+{
+    RtcpDelayBasedEstimatorResult_t result = RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK;
+    uint64_t sendDelta;
+    int64_t arrivalDelta;
+
+    if( pEstimator == NULL )
+    {
+        result = RTCP_DELAY_BASED_ESTIMATOR_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK )
+    {
+        UpdateAckedBitrate( pEstimator,
+                            remoteArrivalTime,
+                            packetSize );
+
+        if( pEstimator->currentGroupValid == 0 )
+        {
+            StartPacketGroup( &( pEstimator->currentGroup ),
+                              localSentTime,
+                              remoteArrivalTime,
+                              packetSize );
+            pEstimator->currentGroupValid = 1;
+        }
+        else if( localSentTime < pEstimator->currentGroup.firstSentTime )
+        {
+            /* Reordered packet from an older group, ignore it. */
+        }
+        else if( ( localSentTime - pEstimator->currentGroup.firstSentTime ) <= RTCP_DELAY_BASED_ESTIMATOR_BURST_TIME )
+        {
+            if( localSentTime > pEstimator->currentGroup.lastSentTime )
+            {
+                pEstimator->currentGroup.lastSentTime = localSentTime;
+            }
+
+            pEstimator->currentGroup.lastArrivalTime = remoteArrivalTime;
+            pEstimator->currentGroup.size += packetSize;
+        }
+        else
+        {
+            /* The current group is complete. Compare it with the previous
+             * one and start a new group with this packet. */
+            if( pEstimator->previousGroupValid != 0 )
+            {
+                sendDelta = pEstimator->currentGroup.lastSentTime -
+                            pEstimator->previousGroup.lastSentTime;
+                arrivalDelta = ( int64_t ) ( pEstimator->currentGroup.lastArrivalTime -
+                                             pEstimator->previousGroup.lastArrivalTime );
+
+                UpdateTrendline( pEstimator,
+                                 sendDelta,
+                                 arrivalDelta,
+                                 pEstimator->currentGroup.lastArrivalTime );
+                UpdateRateControl( pEstimator,
+                                   pEstimator->currentGroup.lastArrivalTime );
+            }
+
+            pEstimator->previousGroup = pEstimator->currentGroup;
+            pEstimator->previousGroupValid = 1;
+
+            StartPacketGroup( &( pEstimator->currentGroup ),
+                              localSentTime,
+                              remoteArrivalTime,
+                              packetSize );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpDelayBasedEstimatorResult_t RtcpDelayBasedEstimator_GetTargetBitrate( const RtcpDelayBasedEstimator_t * pEstimator,
+                                                                          uint32_t * pTargetBitrateBps )
+{
+    RtcpDelayBasedEstimatorResult_t result = RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK;
+
+    if( ( pEstimator == NULL ) ||
+        ( pTargetBitrateBps == NULL ) )
+    {
+        result = RTCP_DELAY_BASED_ESTIMATOR_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK )
+    {
+        *pTargetBitrateBps = pEstimator->targetBitrateBps;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
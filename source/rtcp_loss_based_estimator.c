@@ -0,0 +1,229 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "rtcp_loss_based_estimator.h"
+
+/*-----------------------------------------------------------*/
+
+#define FRACTION_LOST_DENOMINATOR                 256
+
+/* Increase by 8% plus 1 kbps, so that very low bitrates can recover. */
+#define INCREASE_NUMERATOR                        108
+#define INCREASE_DENOMINATOR                      100
+#define INCREASE_MIN_BPS                          1000
+
+/*-----------------------------------------------------------*/
+
+static uint8_t IsIntervalElapsed( uint64_t lastTime,
+                                  uint64_t currentTime,
+                                  uint64_t interval )
+{
+    uint8_t isElapsed = 0;
+
+    if( ( lastTime == 0 ) ||
+        ( ( currentTime >= lastTime ) &&
+          ( ( currentTime - lastTime ) >= interval ) ) )
+    {
+        isElapsed = 1;
+    }
+
+    return isElapsed;
+}
+
+/*-----------------------------------------------------------*/
+
+static void UpdateTargetBitrate( RtcpLossBasedEstimator_t * pEstimator,
+                                 uint8_t fractionLost,
+                                 uint8_t burstLossSeen,
+                                 uint64_t currentTime )
+{
+    uint64_t bitrateBps = pEstimator->targetBitrateBps;
+
+    pEstimator->fractionLost = fractionLost;
+
+    if( fractionLost < RTCP_LOSS_BASED_ESTIMATOR_LOW_LOSS_THRESHOLD )
+    {
+        if( ( burstLossSeen == 0 ) &&
+            ( IsIntervalElapsed( pEstimator->lastIncreaseTime,
+                                 currentTime,
+                                 RTCP_LOSS_BASED_ESTIMATOR_INCREASE_INTERVAL ) != 0 ) )
+        {
+            bitrateBps = ( ( bitrateBps * INCREASE_NUMERATOR ) / INCREASE_DENOMINATOR ) + INCREASE_MIN_BPS;
+            pEstimator->lastIncreaseTime = currentTime;
+        }
+    }
+    else if( fractionLost > RTCP_LOSS_BASED_ESTIMATOR_HIGH_LOSS_THRESHOLD )
+    {
+        if( IsIntervalElapsed( pEstimator->lastDecreaseTime,
+                               currentTime,
+                               RTCP_LOSS_BASED_ESTIMATOR_DECREASE_INTERVAL ) != 0 )
+        {
+            /* bitrate * ( 1 - ( 0.5 * loss ) ). */
+            bitrateBps = ( bitrateBps * ( ( 2 * FRACTION_LOST_DENOMINATOR ) - fractionLost ) ) /
+                         ( 2 * FRACTION_LOST_DENOMINATOR );
+            pEstimator->lastDecreaseTime = currentTime;
+        }
+    }
+    else
+    {
+        /* Hold the target bitrate. */
+    }
+
+    if( bitrateBps < pEstimator->minBitrateBps )
+    {
+        bitrateBps = pEstimator->minBitrateBps;
+    }
+    else if( bitrateBps > pEstimator->maxBitrateBps )
+    {
+        bitrateBps = pEstimator->maxBitrateBps;
+    }
+    else
+    {
+        /* Bitrate is within bounds. */
+    }
+
+    pEstimator->targetBitrateBps = ( uint32_t ) bitrateBps;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpLossBasedEstimatorResult_t RtcpLossBasedEstimator_Init( RtcpLossBasedEstimator_t * pEstimator,
+                                                            uint32_t initialBitrateBps,
+                                                            uint32_t minBitrateBps,
+                                                            uint32_t maxBitrateBps )
+{
+    RtcpLossBasedEstimatorResult_t result = RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK;
+
+    if( ( pEstimator == NULL ) ||
+        ( minBitrateBps > maxBitrateBps ) ||
+        ( initialBitrateBps < minBitrateBps ) ||
+        ( initialBitrateBps > maxBitrateBps ) )
+    {
+        result = RTCP_LOSS_BASED_ESTIMATOR_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK )
+    {
+        memset( pEstimator,
+                0,
+                sizeof( RtcpLossBasedEstimator_t ) );
+
+        pEstimator->targetBitrateBps = initialBitrateBps;
+        pEstimator->minBitrateBps = minBitrateBps;
+        pEstimator->maxBitrateBps = maxBitrateBps;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpLossBasedEstimatorResult_t RtcpLossBasedEstimator_AddTwccPacket( RtcpLossBasedEstimator_t * pEstimator,
+                                                                     const RtcpTwccPacket_t * pTwccPacket,
+                                                                     uint64_t currentTime )
+{
+    RtcpLossBasedEstimatorResult_t result = RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK;
+    size_t i, lostPackets = 0, lostRun = 0, longestLostRun = 0;
+    uint8_t fractionLost;
+
+    if( ( pEstimator == NULL ) ||
+        ( pTwccPacket == NULL ) ||
+        ( ( pTwccPacket->pArrivalInfoList == NULL ) &&
+          ( pTwccPacket->arrivalInfoListLength != 0 ) ) )
+    {
+        result = RTCP_LOSS_BASED_ESTIMATOR_RESULT_BAD_PARAM;
+    }
+
+    /* No loss sample in an empty TWCC packet. */
+    if( ( result == RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK ) &&
+        ( pTwccPacket->arrivalInfoListLength != 0 ) )
+    {
+        for( i = 0; i < pTwccPacket->arrivalInfoListLength; i++ )
+        {
+            if( pTwccPacket->pArrivalInfoList[ i ].remoteArrivalTime == RTCP_TWCC_PACKET_LOST_TIME )
+            {
+                lostPackets += 1;
+                lostRun += 1;
+
+                if( lostRun > longestLostRun )
+                {
+                    longestLostRun = lostRun;
+                }
+            }
+            else
+            {
+                lostRun = 0;
+            }
+        }
+
+        /* Same representation as the fraction lost of a reception report,
+         * which saturates at 255 when all packets are lost. */
+        if( lostPackets == pTwccPacket->arrivalInfoListLength )
+        {
+            fractionLost = FRACTION_LOST_DENOMINATOR - 1;
+        }
+        else
+        {
+            fractionLost = ( uint8_t ) ( ( lostPackets * FRACTION_LOST_DENOMINATOR ) /
+                                         pTwccPacket->arrivalInfoListLength );
+        }
+
+        pEstimator->longestLostRun = longestLostRun;
+
+        UpdateTargetBitrate( pEstimator,
+                             fractionLost,
+                             ( longestLostRun >= RTCP_LOSS_BASED_ESTIMATOR_BURST_LOSS_RUN_LENGTH ) ? 1 : 0,
+                             currentTime );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpLossBasedEstimatorResult_t RtcpLossBasedEstimator_AddReceptionReport( RtcpLossBasedEstimator_t * pEstimator,
+                                                                          const RtcpReceptionReport_t * pReceptionReport,
+                                                                          uint64_t currentTime )
+{
+    RtcpLossBasedEstimatorResult_t result = RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK;
+
+    if( ( pEstimator == NULL ) ||
+        ( pReceptionReport == NULL ) )
+    {
+        result = RTCP_LOSS_BASED_ESTIMATOR_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK )
+    {
+        UpdateTargetBitrate( pEstimator,
+                             pReceptionReport->fractionLost,
+                             0,
+                             currentTime );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpLossBasedEstimatorResult_t RtcpLossBasedEstimator_GetTargetBitrate( const RtcpLossBasedEstimator_t * pEstimator,
+                                                                        uint32_t * pTargetBitrateBps )
+{
+    RtcpLossBasedEstimatorResult_t result = RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK;
+
+    if( ( pEstimator == NULL ) ||
+        ( pTargetBitrateBps == NULL ) )
+    {
+        result = RTCP_LOSS_BASED_ESTIMATOR_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK )
+    {
+        *pTargetBitrateBps = pEstimator->targetBitrateBps;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
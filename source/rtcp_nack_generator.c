@@ -0,0 +1,356 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "rtcp_nack_generator.h"
+
+/*-----------------------------------------------------------*/
+
+#define MAX_RECEIVED_BITMAP_LENGTH    1024
+
+#define DEFAULT_ROUND_TRIP_TIME       ( RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND / 10 )
+#define DEFAULT_MIN_NACK_INTERVAL     ( RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND / 100 )
+#define DEFAULT_MAX_NACK_COUNT        10
+
+#define IS_POWER_OF_TWO( x ) \
+    ( ( ( x ) & ( ( x ) - 1 ) ) == 0 )
+
+#define RECEIVED_WORD( pNackGenerator, seqNum ) \
+    ( ( pNackGenerator )->pReceivedBitmap[ ( ( seqNum ) >> 5 ) & ( ( pNackGenerator )->receivedBitmapLength - 1 ) ] )
+
+#define RECEIVED_BIT( seqNum ) \
+    ( ( uint32_t ) 1 << ( ( seqNum ) & 31 ) )
+
+/*-----------------------------------------------------------*/
+
+static RtcpNackGeneratorLostPacket_t * GetLostPacket( RtcpNackGenerator_t * pNackGenerator,
+                                                      size_t lostPacketIndex )
+{
+    size_t arrayIndex = pNackGenerator->lostPacketHead + lostPacketIndex;
+
+    if( arrayIndex >= pNackGenerator->lostPacketArrayLength )
+    {
+        arrayIndex -= pNackGenerator->lostPacketArrayLength;
+    }
+
+    return &( pNackGenerator->pLostPacketArray[ arrayIndex ] );
+}
+
+/*-----------------------------------------------------------*/
+
+static void RemoveOldestLostPacket( RtcpNackGenerator_t * pNackGenerator )
+{
+    pNackGenerator->lostPacketHead += 1;
+
+    if( pNackGenerator->lostPacketHead == pNackGenerator->lostPacketArrayLength )
+    {
+        pNackGenerator->lostPacketHead = 0;
+    }
+
+    pNackGenerator->lostPacketCount -= 1;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Adds the packets from firstSeqNum up to, but not including, endSeqNum to
+ * the lost packet list, giving up the oldest ones if it is full. */
+static RtcpNackGeneratorResult_t AddLostPackets( RtcpNackGenerator_t * pNackGenerator,
+                                                 uint16_t firstSeqNum,
+                                                 uint16_t endSeqNum )
+{
+    RtcpNackGeneratorResult_t result = RTCP_NACK_GENERATOR_RESULT_OK;
+    RtcpNackGeneratorLostPacket_t * pLostPacket;
+    size_t lostPacketCount = ( uint16_t ) ( endSeqNum - firstSeqNum );
+    uint16_t seqNum;
+
+    if( lostPacketCount > pNackGenerator->lostPacketArrayLength )
+    {
+        pNackGenerator->lostPacketHead = 0;
+        pNackGenerator->lostPacketCount = 0;
+        firstSeqNum = ( uint16_t ) ( endSeqNum - pNackGenerator->lostPacketArrayLength );
+        result = RTCP_NACK_GENERATOR_RESULT_FULL;
+    }
+
+    for( seqNum = firstSeqNum; seqNum != endSeqNum; seqNum++ )
+    {
+        if( pNackGenerator->lostPacketCount == pNackGenerator->lostPacketArrayLength )
+        {
+            RemoveOldestLostPacket( pNackGenerator );
+            result = RTCP_NACK_GENERATOR_RESULT_FULL;
+        }
+
+        pLostPacket = GetLostPacket( pNackGenerator,
+                                     pNackGenerator->lostPacketCount );
+        pLostPacket->seqNum = seqNum;
+        pLostPacket->nackCount = 0;
+        pLostPacket->lastNackTime = 0;
+
+        pNackGenerator->lostPacketCount += 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpNackGeneratorResult_t RtcpNackGenerator_Init( RtcpNackGenerator_t * pNackGenerator,
+                                                  uint32_t * pReceivedBitmap,
+                                                  size_t receivedBitmapLength,
+                                                  RtcpNackGeneratorLostPacket_t * pLostPacketArray,
+                                                  size_t lostPacketArrayLength )
+{
+    RtcpNackGeneratorResult_t result = RTCP_NACK_GENERATOR_RESULT_OK;
+
+    if( ( pNackGenerator == NULL ) ||
+        ( pReceivedBitmap == NULL ) ||
+        ( receivedBitmapLength == 0 ) ||
+        ( receivedBitmapLength > MAX_RECEIVED_BITMAP_LENGTH ) ||
+        ( !IS_POWER_OF_TWO( receivedBitmapLength ) ) ||
+        ( pLostPacketArray == NULL ) ||
+        ( lostPacketArrayLength == 0 ) )
+    {
+        result = RTCP_NACK_GENERATOR_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_NACK_GENERATOR_RESULT_OK )
+    {
+        pNackGenerator->pReceivedBitmap = pReceivedBitmap;
+        pNackGenerator->receivedBitmapLength = receivedBitmapLength;
+        pNackGenerator->pLostPacketArray = pLostPacketArray;
+        pNackGenerator->lostPacketArrayLength = lostPacketArrayLength;
+        pNackGenerator->lostPacketHead = 0;
+        pNackGenerator->lostPacketCount = 0;
+        pNackGenerator->highestSeqNum = 0;
+        pNackGenerator->highestSeqNumValid = 0;
+        pNackGenerator->roundTripTime = DEFAULT_ROUND_TRIP_TIME;
+        pNackGenerator->minNackInterval = DEFAULT_MIN_NACK_INTERVAL;
+        pNackGenerator->maxNackCount = DEFAULT_MAX_NACK_COUNT;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpNackGeneratorResult_t RtcpNackGenerator_SetRetryLimit( RtcpNackGenerator_t * pNackGenerator,
+                                                           uint64_t minNackInterval,
+                                                           uint8_t maxNackCount )
+{
+    RtcpNackGeneratorResult_t result = RTCP_NACK_GENERATOR_RESULT_OK;
+
+    if( ( pNackGenerator == NULL ) ||
+        ( maxNackCount == 0 ) )
+    {
+        result = RTCP_NACK_GENERATOR_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_NACK_GENERATOR_RESULT_OK )
+    {
+        pNackGenerator->minNackInterval = minNackInterval;
+        pNackGenerator->maxNackCount = maxNackCount;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpNackGeneratorResult_t RtcpNackGenerator_UpdateRoundTripTime( RtcpNackGenerator_t * pNackGenerator,
+                                                                 uint64_t roundTripTime )
+{
+    RtcpNackGeneratorResult_t result = RTCP_NACK_GENERATOR_RESULT_OK;
+
+    if( pNackGenerator == NULL )
+    {
+        result = RTCP_NACK_GENERATOR_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_NACK_GENERATOR_RESULT_OK )
+    {
+        pNackGenerator->roundTripTime = roundTripTime;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpNackGeneratorResult_t RtcpNackGenerator_RecordPacket( RtcpNackGenerator_t * pNackGenerator,
+                                                          uint16_t seqNum )
+{
+    RtcpNackGeneratorResult_t result = RTCP_NACK_GENERATOR_RESULT_OK;
+    size_t windowLength, offset;
+    uint16_t firstLostSeqNum, i;
+
+    if( pNackGenerator == NULL )
+    {
+        result = RTCP_NACK_GENERATOR_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_NACK_GENERATOR_RESULT_OK )
+    {
+        windowLength = pNackGenerator->receivedBitmapLength * 32;
+
+        if( pNackGenerator->highestSeqNumValid == 0 )
+        {
+            memset( pNackGenerator->pReceivedBitmap,
+                    0,
+                    sizeof( uint32_t ) * pNackGenerator->receivedBitmapLength );
+
+            pNackGenerator->highestSeqNum = seqNum;
+            pNackGenerator->highestSeqNumValid = 1;
+        }
+
+        offset = ( uint16_t ) ( seqNum - pNackGenerator->highestSeqNum );
+
+        if( offset == 0 )
+        {
+            /* The first packet, or a duplicate of the highest one. */
+            RECEIVED_WORD( pNackGenerator, seqNum ) |= RECEIVED_BIT( seqNum );
+        }
+        else if( offset < 0x8000 )
+        {
+            /* The packets skipped over are lost until they arrive. Only those
+             * in the window are tracked. */
+            if( offset >= windowLength )
+            {
+                memset( pNackGenerator->pReceivedBitmap,
+                        0,
+                        sizeof( uint32_t ) * pNackGenerator->receivedBitmapLength );
+
+                firstLostSeqNum = ( uint16_t ) ( seqNum - windowLength + 1 );
+            }
+            else
+            {
+                firstLostSeqNum = ( uint16_t ) ( pNackGenerator->highestSeqNum + 1 );
+
+                for( i = firstLostSeqNum; i != seqNum; i++ )
+                {
+                    RECEIVED_WORD( pNackGenerator, i ) &= ~RECEIVED_BIT( i );
+                }
+            }
+
+            pNackGenerator->highestSeqNum = seqNum;
+
+            /* The lost packets are in sequence number order, so those which
+             * left the window are at the head. */
+            while( ( pNackGenerator->lostPacketCount > 0 ) &&
+                   ( ( uint16_t ) ( seqNum - GetLostPacket( pNackGenerator, 0 )->seqNum ) >= windowLength ) )
+            {
+                RemoveOldestLostPacket( pNackGenerator );
+            }
+
+            result = AddLostPackets( pNackGenerator,
+                                     firstLostSeqNum,
+                                     seqNum );
+
+            RECEIVED_WORD( pNackGenerator, seqNum ) |= RECEIVED_BIT( seqNum );
+        }
+        else if( ( size_t ) ( uint16_t ) ( pNackGenerator->highestSeqNum - seqNum ) >= windowLength )
+        {
+            /* Too old to be tracked. */
+        }
+        else
+        {
+            /* A reordered or retransmitted packet. Its lost packet entry is
+             * removed when the next NACK packet is generated. */
+            RECEIVED_WORD( pNackGenerator, seqNum ) |= RECEIVED_BIT( seqNum );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpNackGeneratorResult_t RtcpNackGenerator_GetNackPacket( RtcpNackGenerator_t * pNackGenerator,
+                                                           uint64_t currentTime,
+                                                           uint16_t * pSeqNumList,
+                                                           size_t seqNumListLength,
+                                                           RtcpNackPacket_t * pNackPacket )
+{
+    RtcpNackGeneratorResult_t result = RTCP_NACK_GENERATOR_RESULT_OK;
+    RtcpNackGeneratorLostPacket_t * pLostPacket;
+    uint64_t nackInterval = 0;
+    size_t i, lostPacketCount = 0, seqNumCount = 0;
+    uint8_t due, keep;
+
+    if( ( pNackGenerator == NULL ) ||
+        ( pSeqNumList == NULL ) ||
+        ( seqNumListLength == 0 ) ||
+        ( pNackPacket == NULL ) )
+    {
+        result = RTCP_NACK_GENERATOR_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_NACK_GENERATOR_RESULT_OK )
+    {
+        nackInterval = pNackGenerator->roundTripTime;
+
+        if( nackInterval < pNackGenerator->minNackInterval )
+        {
+            nackInterval = pNackGenerator->minNackInterval;
+        }
+
+        /* Lost packets which were received or given up are removed, and the
+         * remaining ones are moved towards the head. */
+        for( i = 0; i < pNackGenerator->lostPacketCount; i++ )
+        {
+            pLostPacket = GetLostPacket( pNackGenerator,
+                                         i );
+
+            due = ( pLostPacket->nackCount == 0 ) ||
+                  ( ( currentTime >= pLostPacket->lastNackTime ) &&
+                    ( ( currentTime - pLostPacket->lastNackTime ) >= nackInterval ) );
+            keep = 1;
+
+            if( ( RECEIVED_WORD( pNackGenerator, pLostPacket->seqNum ) & RECEIVED_BIT( pLostPacket->seqNum ) ) != 0 )
+            {
+                keep = 0;
+            }
+            else if( due == 0 )
+            {
+                /* NACKed less than a round trip time ago. */
+            }
+            else if( pLostPacket->nackCount >= pNackGenerator->maxNackCount )
+            {
+                keep = 0;
+            }
+            else if( seqNumCount < seqNumListLength )
+            {
+                pSeqNumList[ seqNumCount ] = pLostPacket->seqNum;
+                seqNumCount++;
+
+                pLostPacket->nackCount += 1;
+                pLostPacket->lastNackTime = currentTime;
+            }
+            else
+            {
+                /* NACKed in the next NACK packet. */
+            }
+
+            if( keep != 0 )
+            {
+                *GetLostPacket( pNackGenerator, lostPacketCount ) = *pLostPacket;
+                lostPacketCount++;
+            }
+        }
+
+        pNackGenerator->lostPacketCount = lostPacketCount;
+
+        if( seqNumCount == 0 )
+        {
+            result = RTCP_NACK_GENERATOR_RESULT_EMPTY;
+        }
+    }
+
+    if( result == RTCP_NACK_GENERATOR_RESULT_OK )
+    {
+        pNackPacket->pSeqNumList = pSeqNumList;
+        pNackPacket->seqNumListLength = seqNumCount;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,272 @@
+/* API includes. */
+#include "rtcp_receiver_statistics.h"
+
+/*-----------------------------------------------------------*/
+
+#define RTP_SEQ_MOD                   ( ( uint32_t ) 1 << 16 )
+#define MAX_DROPOUT                   3000
+#define MAX_MISORDER                  100
+#define MIN_SEQUENTIAL                2
+
+/* The cumulative number of packets lost is a signed 24 bit value. */
+#define MAX_CUMULATIVE_PACKETS_LOST    0x7FFFFF
+#define MIN_CUMULATIVE_PACKETS_LOST    ( -0x800000 )
+
+/*-----------------------------------------------------------*/
+
+static void InitSeq( RtcpReceiverStatistics_t * pReceiverStatistics,
+                     uint16_t seqNum )
+{
+    pReceiverStatistics->baseSeq = seqNum;
+    pReceiverStatistics->maxSeq = seqNum;
+    pReceiverStatistics->badSeq = RTP_SEQ_MOD + 1;
+    pReceiverStatistics->cycles = 0;
+    pReceiverStatistics->received = 0;
+    pReceiverStatistics->receivedPrior = 0;
+    pReceiverStatistics->expectedPrior = 0;
+}
+
+/*-----------------------------------------------------------*/
+
+/* RFC 3550 Appendix A.1. Returns 0 if the packet is not valid. */
+static uint8_t UpdateSeq( RtcpReceiverStatistics_t * pReceiverStatistics,
+                          uint16_t seqNum )
+{
+    uint8_t valid = 1;
+    uint16_t delta = ( uint16_t ) ( seqNum - pReceiverStatistics->maxSeq );
+
+    if( pReceiverStatistics->probation != 0 )
+    {
+        /* Packets must be in sequence. */
+        if( seqNum == ( uint16_t ) ( pReceiverStatistics->maxSeq + 1 ) )
+        {
+            pReceiverStatistics->probation -= 1;
+            pReceiverStatistics->maxSeq = seqNum;
+
+            if( pReceiverStatistics->probation == 0 )
+            {
+                InitSeq( pReceiverStatistics,
+                         seqNum );
+            }
+            else
+            {
+                valid = 0;
+            }
+        }
+        else
+        {
+            pReceiverStatistics->probation = MIN_SEQUENTIAL - 1;
+            pReceiverStatistics->maxSeq = seqNum;
+            valid = 0;
+        }
+    }
+    else if( delta < MAX_DROPOUT )
+    {
+        /* In order, with permissible gap. */
+        if( seqNum < pReceiverStatistics->maxSeq )
+        {
+            pReceiverStatistics->cycles += RTP_SEQ_MOD;
+        }
+
+        pReceiverStatistics->maxSeq = seqNum;
+    }
+    else if( delta <= ( RTP_SEQ_MOD - MAX_MISORDER ) )
+    {
+        /* The sequence number made a very large jump. Two sequential packets
+         * are taken as a restart of the source. */
+        if( seqNum == pReceiverStatistics->badSeq )
+        {
+            InitSeq( pReceiverStatistics,
+                     seqNum );
+        }
+        else
+        {
+            pReceiverStatistics->badSeq = ( seqNum + 1 ) & ( RTP_SEQ_MOD - 1 );
+            valid = 0;
+        }
+    }
+    else
+    {
+        /* A duplicate or reordered packet. */
+    }
+
+    if( valid != 0 )
+    {
+        pReceiverStatistics->received += 1;
+    }
+
+    return valid;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Converts the arrival time to RTP timestamp units, from the first arrival
+ * time, without overflowing the intermediate product. */
+static uint32_t GetArrivalRtpTime( const RtcpReceiverStatistics_t * pReceiverStatistics,
+                                   uint64_t arrivalTime )
+{
+    uint64_t elapsedTime = arrivalTime - pReceiverStatistics->firstArrivalTime;
+
+    return ( uint32_t ) ( ( ( elapsedTime / RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND ) * pReceiverStatistics->clockRate ) +
+                          ( ( ( elapsedTime % RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND ) * pReceiverStatistics->clockRate ) /
+                            RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND ) );
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpReceiverStatisticsResult_t RtcpReceiverStatistics_Init( RtcpReceiverStatistics_t * pReceiverStatistics,
+                                                            uint32_t sourceSsrc,
+                                                            uint32_t clockRate )
+{
+    RtcpReceiverStatisticsResult_t result = RTCP_RECEIVER_STATISTICS_RESULT_OK;
+
+    if( ( pReceiverStatistics == NULL ) ||
+        ( clockRate == 0 ) )
+    {
+        result = RTCP_RECEIVER_STATISTICS_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_RECEIVER_STATISTICS_RESULT_OK )
+    {
+        InitSeq( pReceiverStatistics,
+                 0 );
+
+        pReceiverStatistics->sourceSsrc = sourceSsrc;
+        pReceiverStatistics->clockRate = clockRate;
+        pReceiverStatistics->firstArrivalTime = 0;
+        pReceiverStatistics->probation = MIN_SEQUENTIAL;
+        pReceiverStatistics->firstPacketReceived = 0;
+        pReceiverStatistics->transit = 0;
+        pReceiverStatistics->transitValid = 0;
+        pReceiverStatistics->jitter = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpReceiverStatisticsResult_t RtcpReceiverStatistics_UpdatePacket( RtcpReceiverStatistics_t * pReceiverStatistics,
+                                                                    uint16_t seqNum,
+                                                                    uint32_t rtpTimestamp,
+                                                                    uint64_t arrivalTime )
+{
+    RtcpReceiverStatisticsResult_t result = RTCP_RECEIVER_STATISTICS_RESULT_OK;
+    uint32_t transit, delta;
+
+    if( pReceiverStatistics == NULL )
+    {
+        result = RTCP_RECEIVER_STATISTICS_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_RECEIVER_STATISTICS_RESULT_OK )
+    {
+        if( pReceiverStatistics->firstPacketReceived == 0 )
+        {
+            pReceiverStatistics->maxSeq = ( uint16_t ) ( seqNum - 1 );
+            pReceiverStatistics->firstArrivalTime = arrivalTime;
+            pReceiverStatistics->firstPacketReceived = 1;
+        }
+
+        if( UpdateSeq( pReceiverStatistics,
+                       seqNum ) == 0 )
+        {
+            result = RTCP_RECEIVER_STATISTICS_RESULT_INVALID_PACKET;
+        }
+    }
+
+    if( result == RTCP_RECEIVER_STATISTICS_RESULT_OK )
+    {
+        /* RFC 3550 Appendix A.8. The transit times are modulo 2^32, only their
+         * difference matters. */
+        transit = GetArrivalRtpTime( pReceiverStatistics,
+                                     arrivalTime ) - rtpTimestamp;
+
+        if( pReceiverStatistics->transitValid != 0 )
+        {
+            delta = transit - pReceiverStatistics->transit;
+
+            if( ( int32_t ) delta < 0 )
+            {
+                delta = ( uint32_t ) 0 - delta;
+            }
+
+            pReceiverStatistics->jitter += delta - ( ( pReceiverStatistics->jitter + 8 ) >> 4 );
+        }
+
+        pReceiverStatistics->transit = transit;
+        pReceiverStatistics->transitValid = 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpReceiverStatisticsResult_t RtcpReceiverStatistics_GetReceptionReport( RtcpReceiverStatistics_t * pReceiverStatistics,
+                                                                          RtcpReceptionReport_t * pReceptionReport )
+{
+    RtcpReceiverStatisticsResult_t result = RTCP_RECEIVER_STATISTICS_RESULT_OK;
+    uint32_t extendedMax, expected, expectedInterval, receivedInterval;
+    int64_t lost, lostInterval;
+
+    if( ( pReceiverStatistics == NULL ) ||
+        ( pReceptionReport == NULL ) )
+    {
+        result = RTCP_RECEIVER_STATISTICS_RESULT_BAD_PARAM;
+    }
+
+    if( ( result == RTCP_RECEIVER_STATISTICS_RESULT_OK ) &&
+        ( pReceiverStatistics->received == 0 ) )
+    {
+        result = RTCP_RECEIVER_STATISTICS_RESULT_EMPTY;
+    }
+
+    if( result == RTCP_RECEIVER_STATISTICS_RESULT_OK )
+    {
+        /* RFC 3550 Appendix A.3. */
+        extendedMax = pReceiverStatistics->cycles + pReceiverStatistics->maxSeq;
+        expected = extendedMax - pReceiverStatistics->baseSeq + 1;
+        lost = ( int64_t ) expected - ( int64_t ) pReceiverStatistics->received;
+
+        if( lost > MAX_CUMULATIVE_PACKETS_LOST )
+        {
+            lost = MAX_CUMULATIVE_PACKETS_LOST;
+        }
+        else if( lost < MIN_CUMULATIVE_PACKETS_LOST )
+        {
+            lost = MIN_CUMULATIVE_PACKETS_LOST;
+        }
+
+        expectedInterval = expected - pReceiverStatistics->expectedPrior;
+        pReceiverStatistics->expectedPrior = expected;
+        receivedInterval = pReceiverStatistics->received - pReceiverStatistics->receivedPrior;
+        pReceiverStatistics->receivedPrior = pReceiverStatistics->received;
+        lostInterval = ( int64_t ) expectedInterval - ( int64_t ) receivedInterval;
+
+        pReceptionReport->sourceSsrc = pReceiverStatistics->sourceSsrc;
+
+        /* The highest sequence number only moves with a received packet, so
+         * at least one of the expected packets of the interval was received,
+         * and the fraction is at most 255/256. */
+        if( ( expectedInterval == 0 ) ||
+            ( lostInterval <= 0 ) )
+        {
+            pReceptionReport->fractionLost = 0;
+        }
+        else
+        {
+            pReceptionReport->fractionLost = ( uint8_t ) ( ( lostInterval << 8 ) / expectedInterval );
+        }
+
+        /* Negative values are in two's complement, masked to 24 bits on
+         * serialization. */
+        pReceptionReport->cumulativePacketsLost = ( uint32_t ) lost & 0xFFFFFF;
+        pReceptionReport->extendedHighestSeqNumReceived = extendedMax;
+        pReceptionReport->interArrivalJitter = pReceiverStatistics->jitter >> 4;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,291 @@
+/* API includes. */
+#include "rtcp_report_scheduler.h"
+
+/*-----------------------------------------------------------*/
+
+/* RTCP gets 5% of the session bandwidth, i.e. 1/160 of it in bytes. */
+#define SESSION_BANDWIDTH_BPS_TO_RTCP_BANDWIDTH( sessionBandwidthBps ) \
+    ( ( sessionBandwidthBps ) / 160 )
+
+#define RTCP_MIN_TIME                   ( ( uint64_t ) 5 * RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND )
+
+/* Bounds the interval of huge sessions, so that it is randomized without
+ * overflow. */
+#define RTCP_MAX_TIME                   ( ( uint64_t ) 24 * 60 * 60 * RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND )
+
+/* The probable size of the first RTCP packet, with the UDP and IP headers. */
+#define INITIAL_AVERAGE_PACKET_SIZE     100
+
+/* Dividing the randomized interval by e - 3/2 compensates for the timer
+ * reconsideration converging to a lower value than intended. */
+#define COMPENSATION_NUMERATOR          100000
+#define COMPENSATION_DENOMINATOR        121828
+
+/*-----------------------------------------------------------*/
+
+/* RFC 3550 Appendix A.7. */
+static uint64_t GetReportInterval( const RtcpReportScheduler_t * pReportScheduler,
+                                   uint32_t randomValue )
+{
+    /* In 1/4 bytes per second, so that the shares of the senders and the
+     * receivers are exact, and never 0 since Init rejects a bandwidth of
+     * 0. */
+    uint64_t rtcpBandwidth = pReportScheduler->rtcpBandwidth * 4;
+    uint64_t minTime = RTCP_MIN_TIME, interval, totalPacketSize;
+    uint32_t members = pReportScheduler->members;
+    uint8_t weSent = ( pReportScheduler->rtpSentSinceReport | pReportScheduler->rtpSentBeforeReport );
+
+    if( pReportScheduler->initial != 0 )
+    {
+        minTime /= 2;
+    }
+
+    /* The senders share 1/4 of the bandwidth if they are at most 1/4 of the
+     * members. */
+    if( ( ( uint64_t ) pReportScheduler->senders * 4 ) <= members )
+    {
+        if( weSent != 0 )
+        {
+            rtcpBandwidth = pReportScheduler->rtcpBandwidth;
+            members = pReportScheduler->senders;
+        }
+        else
+        {
+            rtcpBandwidth = pReportScheduler->rtcpBandwidth * 3;
+            members -= pReportScheduler->senders;
+        }
+    }
+
+    /* The 1/4 bytes of a round of reports from all the members, over the
+     * bandwidth, without overflowing the intermediate product. */
+    totalPacketSize = ( ( uint64_t ) pReportScheduler->averagePacketSize * members ) >> 2;
+    interval = ( ( totalPacketSize / rtcpBandwidth ) * RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND ) +
+               ( ( ( totalPacketSize % rtcpBandwidth ) * RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND ) / rtcpBandwidth );
+
+    if( interval < minTime )
+    {
+        interval = minTime;
+    }
+    else if( interval > RTCP_MAX_TIME )
+    {
+        interval = RTCP_MAX_TIME;
+    }
+
+    /* Between 0.5 and 1.5 times the interval. */
+    interval = ( interval / 2 ) + ( ( interval * ( randomValue >> 16 ) ) >> 16 );
+
+    return ( interval * COMPENSATION_NUMERATOR ) / COMPENSATION_DENOMINATOR;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Returns time * members / previousMembers, for members less than
+ * previousMembers, without overflowing the intermediate product. */
+static uint64_t ScaleTime( uint64_t time,
+                           uint32_t members,
+                           uint32_t previousMembers )
+{
+    return ( ( time / previousMembers ) * members ) +
+           ( ( ( time % previousMembers ) * members ) / previousMembers );
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpReportSchedulerResult_t RtcpReportScheduler_Init( RtcpReportScheduler_t * pReportScheduler,
+                                                      uint64_t sessionBandwidthBps,
+                                                      uint64_t currentTime,
+                                                      uint32_t randomValue )
+{
+    RtcpReportSchedulerResult_t result = RTCP_REPORT_SCHEDULER_RESULT_OK;
+
+    if( ( pReportScheduler == NULL ) ||
+        ( SESSION_BANDWIDTH_BPS_TO_RTCP_BANDWIDTH( sessionBandwidthBps ) == 0 ) )
+    {
+        result = RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_REPORT_SCHEDULER_RESULT_OK )
+    {
+        pReportScheduler->rtcpBandwidth = SESSION_BANDWIDTH_BPS_TO_RTCP_BANDWIDTH( sessionBandwidthBps );
+        pReportScheduler->previousReportTime = currentTime;
+        pReportScheduler->members = 1;
+        pReportScheduler->previousMembers = 1;
+        pReportScheduler->senders = 0;
+        pReportScheduler->averagePacketSize = INITIAL_AVERAGE_PACKET_SIZE << 4;
+        pReportScheduler->initial = 1;
+        pReportScheduler->rtpSentSinceReport = 0;
+        pReportScheduler->rtpSentBeforeReport = 0;
+
+        pReportScheduler->nextReportTime = currentTime + GetReportInterval( pReportScheduler,
+                                                                            randomValue );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpReportSchedulerResult_t RtcpReportScheduler_RecordRtpPacketSent( RtcpReportScheduler_t * pReportScheduler )
+{
+    RtcpReportSchedulerResult_t result = RTCP_REPORT_SCHEDULER_RESULT_OK;
+
+    if( pReportScheduler == NULL )
+    {
+        result = RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_REPORT_SCHEDULER_RESULT_OK )
+    {
+        pReportScheduler->rtpSentSinceReport = 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpReportSchedulerResult_t RtcpReportScheduler_RecordRtcpPacket( RtcpReportScheduler_t * pReportScheduler,
+                                                                  size_t packetSize )
+{
+    RtcpReportSchedulerResult_t result = RTCP_REPORT_SCHEDULER_RESULT_OK;
+
+    if( ( pReportScheduler == NULL ) ||
+        ( packetSize == 0 ) ||
+        ( packetSize > UINT16_MAX ) )
+    {
+        result = RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_REPORT_SCHEDULER_RESULT_OK )
+    {
+        /* avg = avg + ( size - avg ) / 16, in 1/16 bytes. */
+        pReportScheduler->averagePacketSize = pReportScheduler->averagePacketSize +
+                                              ( uint32_t ) packetSize -
+                                              ( pReportScheduler->averagePacketSize >> 4 );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpReportSchedulerResult_t RtcpReportScheduler_UpdateMembers( RtcpReportScheduler_t * pReportScheduler,
+                                                               uint32_t members,
+                                                               uint32_t senders,
+                                                               uint64_t currentTime )
+{
+    RtcpReportSchedulerResult_t result = RTCP_REPORT_SCHEDULER_RESULT_OK;
+
+    if( ( pReportScheduler == NULL ) ||
+        ( members == 0 ) ||
+        ( senders > members ) )
+    {
+        result = RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_REPORT_SCHEDULER_RESULT_OK )
+    {
+        /* RFC 3550 Section 6.3.4, reverse reconsideration. */
+        if( ( members < pReportScheduler->previousMembers ) &&
+            ( pReportScheduler->nextReportTime > currentTime ) &&
+            ( pReportScheduler->previousReportTime <= currentTime ) )
+        {
+            pReportScheduler->nextReportTime = currentTime +
+                                               ScaleTime( pReportScheduler->nextReportTime - currentTime,
+                                                          members,
+                                                          pReportScheduler->previousMembers );
+            pReportScheduler->previousReportTime = currentTime -
+                                                   ScaleTime( currentTime - pReportScheduler->previousReportTime,
+                                                              members,
+                                                              pReportScheduler->previousMembers );
+            pReportScheduler->previousMembers = members;
+        }
+
+        pReportScheduler->members = members;
+        pReportScheduler->senders = senders;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpReportSchedulerResult_t RtcpReportScheduler_CheckReport( RtcpReportScheduler_t * pReportScheduler,
+                                                             uint64_t currentTime,
+                                                             uint32_t randomValue,
+                                                             RtcpScheduledReport_t * pScheduledReport )
+{
+    RtcpReportSchedulerResult_t result = RTCP_REPORT_SCHEDULER_RESULT_OK;
+    uint64_t interval;
+
+    if( ( pReportScheduler == NULL ) ||
+        ( pScheduledReport == NULL ) )
+    {
+        result = RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_REPORT_SCHEDULER_RESULT_OK )
+    {
+        *pScheduledReport = RTCP_SCHEDULED_REPORT_NONE;
+
+        if( currentTime >= pReportScheduler->nextReportTime )
+        {
+            /* RFC 3550 Section 6.3.6, timer reconsideration. */
+            interval = GetReportInterval( pReportScheduler,
+                                          randomValue );
+
+            if( ( pReportScheduler->previousReportTime + interval ) <= currentTime )
+            {
+                if( ( pReportScheduler->rtpSentSinceReport | pReportScheduler->rtpSentBeforeReport ) != 0 )
+                {
+                    *pScheduledReport = RTCP_SCHEDULED_REPORT_SENDER_REPORT;
+                }
+                else
+                {
+                    *pScheduledReport = RTCP_SCHEDULED_REPORT_RECEIVER_REPORT;
+                }
+
+                pReportScheduler->initial = 0;
+                pReportScheduler->previousReportTime = currentTime;
+                pReportScheduler->previousMembers = pReportScheduler->members;
+
+                /* The next interval is computed after this report, so that
+                 * the sender state is that of the next report. */
+                pReportScheduler->rtpSentBeforeReport = pReportScheduler->rtpSentSinceReport;
+                pReportScheduler->rtpSentSinceReport = 0;
+
+                pReportScheduler->nextReportTime = currentTime + GetReportInterval( pReportScheduler,
+                                                                                    randomValue );
+            }
+            else
+            {
+                pReportScheduler->nextReportTime = pReportScheduler->previousReportTime + interval;
+            }
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpReportSchedulerResult_t RtcpReportScheduler_GetNextReportTime( const RtcpReportScheduler_t * pReportScheduler,
+                                                                   uint64_t * pNextReportTime )
+{
+    RtcpReportSchedulerResult_t result = RTCP_REPORT_SCHEDULER_RESULT_OK;
+
+    if( ( pReportScheduler == NULL ) ||
+        ( pNextReportTime == NULL ) )
+    {
+        result = RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_REPORT_SCHEDULER_RESULT_OK )
+    {
+        *pNextReportTime = pReportScheduler->nextReportTime;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
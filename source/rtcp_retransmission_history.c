@@ -0,0 +1,303 @@
+/* API includes. */
+#include "rtcp_retransmission_history.h"
+
+/*-----------------------------------------------------------*/
+
+#define MAX_PACKET_ARRAY_LENGTH        32768
+
+#define DEFAULT_MIN_RESEND_INTERVAL    ( RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND / 100 )
+#define DEFAULT_MAX_RESEND_COUNT       10
+
+#define IS_POWER_OF_TWO( x ) \
+    ( ( ( x ) & ( ( x ) - 1 ) ) == 0 )
+
+/*-----------------------------------------------------------*/
+
+/* Refills the resend bytes budget for the time elapsed since the last
+ * update, up to one second of resends. */
+static void UpdateResendBytesBudget( RtcpRetransmissionHistory_t * pHistory,
+                                     uint64_t currentTime )
+{
+    uint64_t elapsedTime = 0;
+
+    if( currentTime > pHistory->lastBudgetUpdateTime )
+    {
+        elapsedTime = currentTime - pHistory->lastBudgetUpdateTime;
+    }
+
+    if( elapsedTime >= RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND )
+    {
+        pHistory->resendBytesBudget = pHistory->maxResendBytesPerSecond;
+    }
+    else
+    {
+        pHistory->resendBytesBudget += ( elapsedTime * pHistory->maxResendBytesPerSecond ) / RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND;
+
+        if( pHistory->resendBytesBudget > pHistory->maxResendBytesPerSecond )
+        {
+            pHistory->resendBytesBudget = pHistory->maxResendBytesPerSecond;
+        }
+    }
+
+    pHistory->lastBudgetUpdateTime = currentTime;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Appends the packet of a sequence number to the resend list if it is in the
+ * history and the rate limit allows it. */
+static RtcpRetransmissionHistoryResult_t ResendPacket( RtcpRetransmissionHistory_t * pHistory,
+                                                       uint16_t seqNum,
+                                                       uint64_t currentTime,
+                                                       RtcpRetransmissionPacket_t ** ppResendList,
+                                                       size_t resendListLength,
+                                                       size_t * pResendCount )
+{
+    RtcpRetransmissionHistoryResult_t result = RTCP_RETRANSMISSION_HISTORY_RESULT_OK;
+    RtcpRetransmissionPacket_t * pPacket;
+
+    pPacket = &( pHistory->pPacketArray[ seqNum & ( pHistory->packetArrayLength - 1 ) ] );
+
+    if( ( pPacket->pPacket != NULL ) &&
+        ( pPacket->seqNum == seqNum ) &&
+        ( pPacket->resendCount < pHistory->maxResendCount ) &&
+        ( currentTime >= pPacket->lastSentTime ) &&
+        ( ( currentTime - pPacket->lastSentTime ) >= pHistory->minResendInterval ) &&
+        ( ( pHistory->maxResendBytesPerSecond == 0 ) ||
+          ( pPacket->packetLength <= pHistory->resendBytesBudget ) ) )
+    {
+        if( *pResendCount == resendListLength )
+        {
+            result = RTCP_RETRANSMISSION_HISTORY_RESULT_FULL;
+        }
+        else
+        {
+            ppResendList[ *pResendCount ] = pPacket;
+            *pResendCount += 1;
+
+            pPacket->resendCount += 1;
+            pPacket->lastSentTime = currentTime;
+
+            if( pHistory->maxResendBytesPerSecond != 0 )
+            {
+                pHistory->resendBytesBudget -= pPacket->packetLength;
+            }
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpRetransmissionHistoryResult_t RtcpRetransmissionHistory_Init( RtcpRetransmissionHistory_t * pHistory,
+                                                                  RtcpRetransmissionPacket_t * pPacketArray,
+                                                                  size_t packetArrayLength )
+{
+    RtcpRetransmissionHistoryResult_t result = RTCP_RETRANSMISSION_HISTORY_RESULT_OK;
+    size_t i;
+
+    if( ( pHistory == NULL ) ||
+        ( pPacketArray == NULL ) ||
+        ( packetArrayLength == 0 ) ||
+        ( packetArrayLength > MAX_PACKET_ARRAY_LENGTH ) ||
+        ( !IS_POWER_OF_TWO( packetArrayLength ) ) )
+    {
+        result = RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_RETRANSMISSION_HISTORY_RESULT_OK )
+    {
+        pHistory->pPacketArray = pPacketArray;
+        pHistory->packetArrayLength = packetArrayLength;
+        pHistory->minResendInterval = DEFAULT_MIN_RESEND_INTERVAL;
+        pHistory->maxResendCount = DEFAULT_MAX_RESEND_COUNT;
+        pHistory->maxResendBytesPerSecond = 0;
+        pHistory->resendBytesBudget = 0;
+        pHistory->lastBudgetUpdateTime = 0;
+
+        for( i = 0; i < packetArrayLength; i++ )
+        {
+            pPacketArray[ i ].pPacket = NULL;
+            pPacketArray[ i ].packetLength = 0;
+            pPacketArray[ i ].lastSentTime = 0;
+            pPacketArray[ i ].seqNum = 0;
+            pPacketArray[ i ].resendCount = 0;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpRetransmissionHistoryResult_t RtcpRetransmissionHistory_SetRateLimit( RtcpRetransmissionHistory_t * pHistory,
+                                                                          uint64_t minResendInterval,
+                                                                          uint8_t maxResendCount,
+                                                                          uint64_t maxResendBytesPerSecond )
+{
+    RtcpRetransmissionHistoryResult_t result = RTCP_RETRANSMISSION_HISTORY_RESULT_OK;
+
+    if( ( pHistory == NULL ) ||
+        ( maxResendCount == 0 ) )
+    {
+        result = RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_RETRANSMISSION_HISTORY_RESULT_OK )
+    {
+        pHistory->minResendInterval = minResendInterval;
+        pHistory->maxResendCount = maxResendCount;
+        pHistory->maxResendBytesPerSecond = maxResendBytesPerSecond;
+
+        /* Start with a full budget. */
+        pHistory->resendBytesBudget = maxResendBytesPerSecond;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpRetransmissionHistoryResult_t RtcpRetransmissionHistory_AddPacket( RtcpRetransmissionHistory_t * pHistory,
+                                                                       uint16_t seqNum,
+                                                                       const uint8_t * pPacket,
+                                                                       size_t packetLength,
+                                                                       uint64_t sentTime,
+                                                                       RtcpRetransmissionPacket_t * pEvictedPacket )
+{
+    RtcpRetransmissionHistoryResult_t result = RTCP_RETRANSMISSION_HISTORY_RESULT_OK;
+    RtcpRetransmissionPacket_t * pSlot;
+
+    if( ( pHistory == NULL ) ||
+        ( pPacket == NULL ) ||
+        ( packetLength == 0 ) )
+    {
+        result = RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_RETRANSMISSION_HISTORY_RESULT_OK )
+    {
+        pSlot = &( pHistory->pPacketArray[ seqNum & ( pHistory->packetArrayLength - 1 ) ] );
+
+        if( pEvictedPacket != NULL )
+        {
+            *pEvictedPacket = *pSlot;
+        }
+
+        pSlot->pPacket = pPacket;
+        pSlot->packetLength = packetLength;
+        pSlot->lastSentTime = sentTime;
+        pSlot->seqNum = seqNum;
+        pSlot->resendCount = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpRetransmissionHistoryResult_t RtcpRetransmissionHistory_HandleNackPacket( RtcpRetransmissionHistory_t * pHistory,
+                                                                              const RtcpNackPacket_t * pNackPacket,
+                                                                              uint64_t currentTime,
+                                                                              RtcpRetransmissionPacket_t ** ppResendList,
+                                                                              size_t * pResendListLength )
+{
+    RtcpRetransmissionHistoryResult_t result = RTCP_RETRANSMISSION_HISTORY_RESULT_OK;
+    size_t resendCount = 0, i;
+
+    if( ( pHistory == NULL ) ||
+        ( pNackPacket == NULL ) ||
+        ( ( pNackPacket->pSeqNumList == NULL ) && ( pNackPacket->seqNumListLength != 0 ) ) ||
+        ( ppResendList == NULL ) ||
+        ( pResendListLength == NULL ) )
+    {
+        result = RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_RETRANSMISSION_HISTORY_RESULT_OK )
+    {
+        UpdateResendBytesBudget( pHistory,
+                                 currentTime );
+
+        for( i = 0; ( i < pNackPacket->seqNumListLength ) && ( result == RTCP_RETRANSMISSION_HISTORY_RESULT_OK ); i++ )
+        {
+            result = ResendPacket( pHistory,
+                                   pNackPacket->pSeqNumList[ i ],
+                                   currentTime,
+                                   ppResendList,
+                                   *pResendListLength,
+                                   &( resendCount ) );
+        }
+
+        *pResendListLength = resendCount;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpRetransmissionHistoryResult_t RtcpRetransmissionHistory_HandleNackFciPacket( RtcpRetransmissionHistory_t * pHistory,
+                                                                                 const RtcpNackFciPacket_t * pNackFciPacket,
+                                                                                 uint64_t currentTime,
+                                                                                 RtcpRetransmissionPacket_t ** ppResendList,
+                                                                                 size_t * pResendListLength )
+{
+    RtcpRetransmissionHistoryResult_t result = RTCP_RETRANSMISSION_HISTORY_RESULT_OK;
+    size_t resendCount = 0, i;
+    uint16_t seqNum, blp;
+
+    if( ( pHistory == NULL ) ||
+        ( pNackFciPacket == NULL ) ||
+        ( ( pNackFciPacket->pFciList == NULL ) && ( pNackFciPacket->fciListLength != 0 ) ) ||
+        ( ppResendList == NULL ) ||
+        ( pResendListLength == NULL ) )
+    {
+        result = RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_RETRANSMISSION_HISTORY_RESULT_OK )
+    {
+        UpdateResendBytesBudget( pHistory,
+                                 currentTime );
+
+        for( i = 0; ( i < pNackFciPacket->fciListLength ) && ( result == RTCP_RETRANSMISSION_HISTORY_RESULT_OK ); i++ )
+        {
+            seqNum = pNackFciPacket->pFciList[ i ].pid;
+            blp = pNackFciPacket->pFciList[ i ].blp;
+
+            result = ResendPacket( pHistory,
+                                   seqNum,
+                                   currentTime,
+                                   ppResendList,
+                                   *pResendListLength,
+                                   &( resendCount ) );
+
+            /* Stops after the highest bit set. */
+            while( ( blp != 0 ) &&
+                   ( result == RTCP_RETRANSMISSION_HISTORY_RESULT_OK ) )
+            {
+                seqNum++;
+
+                if( ( blp & 1U ) != 0 )
+                {
+                    result = ResendPacket( pHistory,
+                                           seqNum,
+                                           currentTime,
+                                           ppResendList,
+                                           *pResendListLength,
+                                           &( resendCount ) );
+                }
+
+                blp >>= 1;
+            }
+        }
+
+        *pResendListLength = resendCount;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,252 @@
+/* API includes. */
+#include "rtcp_rtt_estimator.h"
+
+/*-----------------------------------------------------------*/
+
+/* The compact NTP time is the middle 32 bits of the 64 bit NTP time, in
+ * 1/65536 seconds. */
+#define NTP_TIME_TO_COMPACT_NTP_TIME( ntpTime ) \
+    ( ( uint32_t ) ( ( ntpTime ) >> 16 ) )
+
+#define COMPACT_NTP_TIME_TO_HUNDREDS_OF_NANOS( compactNtpTime ) \
+    ( ( ( uint64_t ) ( compactNtpTime ) * RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND ) >> 16 )
+
+/* The weight of a new sample in the smoothed round trip time is
+ * 1 / 2^RTT_SMOOTHING_SHIFT. */
+#define RTT_SMOOTHING_SHIFT    3
+
+/*-----------------------------------------------------------*/
+
+static const RtcpRttEstimatorSenderReport_t * FindSenderReport( const RtcpRttEstimator_t * pRttEstimator,
+                                                                uint32_t compactNtpTime )
+{
+    const RtcpRttEstimatorSenderReport_t * pSenderReport = NULL;
+    size_t i;
+
+    for( i = 0; i < pRttEstimator->senderReportCount; i++ )
+    {
+        if( pRttEstimator->pSenderReportArray[ i ].compactNtpTime == compactNtpTime )
+        {
+            pSenderReport = &( pRttEstimator->pSenderReportArray[ i ] );
+            break;
+        }
+    }
+
+    return pSenderReport;
+}
+
+/*-----------------------------------------------------------*/
+
+static RtcpRttEstimatorResult_t HandleReceptionReports( RtcpRttEstimator_t * pRttEstimator,
+                                                        const RtcpReceptionReport_t * pReceptionReports,
+                                                        uint8_t numReceptionReports,
+                                                        uint64_t arrivalTime,
+                                                        uint64_t * pRttSample )
+{
+    RtcpRttEstimatorResult_t result = RTCP_RTT_ESTIMATOR_RESULT_EMPTY;
+    const RtcpRttEstimatorSenderReport_t * pSenderReport;
+    uint64_t delaySinceLastSR, rttSample = 0;
+    uint8_t i;
+
+    for( i = 0; i < numReceptionReports; i++ )
+    {
+        pSenderReport = NULL;
+
+        /* A zero LSR means that no SR was received yet. */
+        if( ( pReceptionReports[ i ].sourceSsrc == pRttEstimator->localSsrc ) &&
+            ( pReceptionReports[ i ].lastSR != 0 ) )
+        {
+            pSenderReport = FindSenderReport( pRttEstimator,
+                                              pReceptionReports[ i ].lastSR );
+        }
+
+        if( pSenderReport != NULL )
+        {
+            delaySinceLastSR = COMPACT_NTP_TIME_TO_HUNDREDS_OF_NANOS( pReceptionReports[ i ].delaySinceLastSR );
+
+            /* The remote clock may run slightly faster than ours. */
+            if( arrivalTime >= pSenderReport->sentTime + delaySinceLastSR )
+            {
+                rttSample = arrivalTime - pSenderReport->sentTime - delaySinceLastSR;
+            }
+            else
+            {
+                rttSample = 0;
+            }
+
+            if( pRttEstimator->rttValid == 0 )
+            {
+                pRttEstimator->smoothedRtt = rttSample;
+                pRttEstimator->rttValid = 1;
+            }
+            else
+            {
+                pRttEstimator->smoothedRtt = pRttEstimator->smoothedRtt -
+                                             ( pRttEstimator->smoothedRtt >> RTT_SMOOTHING_SHIFT ) +
+                                             ( rttSample >> RTT_SMOOTHING_SHIFT );
+            }
+
+            result = RTCP_RTT_ESTIMATOR_RESULT_OK;
+        }
+    }
+
+    if( ( result == RTCP_RTT_ESTIMATOR_RESULT_OK ) &&
+        ( pRttSample != NULL ) )
+    {
+        *pRttSample = rttSample;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpRttEstimatorResult_t RtcpRttEstimator_Init( RtcpRttEstimator_t * pRttEstimator,
+                                                uint32_t localSsrc,
+                                                RtcpRttEstimatorSenderReport_t * pSenderReportArray,
+                                                size_t senderReportArrayLength )
+{
+    RtcpRttEstimatorResult_t result = RTCP_RTT_ESTIMATOR_RESULT_OK;
+
+    if( ( pRttEstimator == NULL ) ||
+        ( pSenderReportArray == NULL ) ||
+        ( senderReportArrayLength == 0 ) )
+    {
+        result = RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_RTT_ESTIMATOR_RESULT_OK )
+    {
+        pRttEstimator->localSsrc = localSsrc;
+        pRttEstimator->pSenderReportArray = pSenderReportArray;
+        pRttEstimator->senderReportArrayLength = senderReportArrayLength;
+        pRttEstimator->senderReportCount = 0;
+        pRttEstimator->nextSenderReportIndex = 0;
+        pRttEstimator->smoothedRtt = 0;
+        pRttEstimator->rttValid = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpRttEstimatorResult_t RtcpRttEstimator_AddSenderReport( RtcpRttEstimator_t * pRttEstimator,
+                                                           const RtcpSenderReport_t * pSenderReport,
+                                                           uint64_t sentTime )
+{
+    RtcpRttEstimatorResult_t result = RTCP_RTT_ESTIMATOR_RESULT_OK;
+    RtcpRttEstimatorSenderReport_t * pSentSenderReport;
+
+    if( ( pRttEstimator == NULL ) ||
+        ( pSenderReport == NULL ) )
+    {
+        result = RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_RTT_ESTIMATOR_RESULT_OK )
+    {
+        pSentSenderReport = &( pRttEstimator->pSenderReportArray[ pRttEstimator->nextSenderReportIndex ] );
+        pSentSenderReport->sentTime = sentTime;
+        pSentSenderReport->compactNtpTime = NTP_TIME_TO_COMPACT_NTP_TIME( pSenderReport->senderInfo.ntpTime );
+
+        pRttEstimator->nextSenderReportIndex += 1;
+
+        if( pRttEstimator->nextSenderReportIndex == pRttEstimator->senderReportArrayLength )
+        {
+            pRttEstimator->nextSenderReportIndex = 0;
+        }
+
+        if( pRttEstimator->senderReportCount < pRttEstimator->senderReportArrayLength )
+        {
+            pRttEstimator->senderReportCount += 1;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpRttEstimatorResult_t RtcpRttEstimator_HandleReceiverReport( RtcpRttEstimator_t * pRttEstimator,
+                                                                const RtcpReceiverReport_t * pReceiverReport,
+                                                                uint64_t arrivalTime,
+                                                                uint64_t * pRttSample )
+{
+    RtcpRttEstimatorResult_t result = RTCP_RTT_ESTIMATOR_RESULT_OK;
+
+    if( ( pRttEstimator == NULL ) ||
+        ( pReceiverReport == NULL ) ||
+        ( ( pReceiverReport->pReceptionReports == NULL ) && ( pReceiverReport->numReceptionReports != 0 ) ) )
+    {
+        result = RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_RTT_ESTIMATOR_RESULT_OK )
+    {
+        result = HandleReceptionReports( pRttEstimator,
+                                         pReceiverReport->pReceptionReports,
+                                         pReceiverReport->numReceptionReports,
+                                         arrivalTime,
+                                         pRttSample );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpRttEstimatorResult_t RtcpRttEstimator_HandleSenderReport( RtcpRttEstimator_t * pRttEstimator,
+                                                              const RtcpSenderReport_t * pSenderReport,
+                                                              uint64_t arrivalTime,
+                                                              uint64_t * pRttSample )
+{
+    RtcpRttEstimatorResult_t result = RTCP_RTT_ESTIMATOR_RESULT_OK;
+
+    if( ( pRttEstimator == NULL ) ||
+        ( pSenderReport == NULL ) ||
+        ( ( pSenderReport->pReceptionReports == NULL ) && ( pSenderReport->numReceptionReports != 0 ) ) )
+    {
+        result = RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_RTT_ESTIMATOR_RESULT_OK )
+    {
+        result = HandleReceptionReports( pRttEstimator,
+                                         pSenderReport->pReceptionReports,
+                                         pSenderReport->numReceptionReports,
+                                         arrivalTime,
+                                         pRttSample );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpRttEstimatorResult_t RtcpRttEstimator_GetRoundTripTime( const RtcpRttEstimator_t * pRttEstimator,
+                                                            uint64_t * pSmoothedRtt )
+{
+    RtcpRttEstimatorResult_t result = RTCP_RTT_ESTIMATOR_RESULT_OK;
+
+    if( ( pRttEstimator == NULL ) ||
+        ( pSmoothedRtt == NULL ) )
+    {
+        result = RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM;
+    }
+
+    if( ( result == RTCP_RTT_ESTIMATOR_RESULT_OK ) &&
+        ( pRttEstimator->rttValid == 0 ) )
+    {
+        result = RTCP_RTT_ESTIMATOR_RESULT_EMPTY;
+    }
+
+    if( result == RTCP_RTT_ESTIMATOR_RESULT_OK )
+    {
+        *pSmoothedRtt = pRttEstimator->smoothedRtt;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -7,16 +7,14 @@
 
 /*-----------------------------------------------------------*/
 
-#define WRAP( x, n ) \
-    ( ( x ) % ( n ) )
+#define WRAP( pTwccManager, x ) \
+    WrapIndex( ( pTwccManager ), ( x ) )
 
-#define INC_READ_INDEX( pTwccManager )      \
-    WRAP( ( pTwccManager )->readIndex + 1,  \
-          ( pTwccManager )->twccPacketInfoArrayLength )
+#define INC_READ_INDEX( pTwccManager ) \
+    WRAP( ( pTwccManager ), ( pTwccManager )->readIndex + 1 )
 
-#define INC_WRITE_INDEX( pTwccManager )     \
-    WRAP( ( pTwccManager )->writeIndex + 1, \
-          ( pTwccManager )->twccPacketInfoArrayLength )
+#define INC_WRITE_INDEX( pTwccManager ) \
+    WRAP( ( pTwccManager ), ( pTwccManager )->writeIndex + 1 )
 
 #define IS_TWCC_MANAGER_FULL( pTwccManager ) \
     ( ( pTwccManager )->count == ( pTwccManager )->twccPacketInfoArrayLength )
@@ -24,79 +22,973 @@
 #define IS_TWCC_MANAGER_EMPTY( pTwccManager ) \
     ( ( pTwccManager )->count == 0 )
 
+#define IS_POWER_OF_TWO( x ) \
+    ( ( ( x ) & ( ( x ) - 1 ) ) == 0 )
+
+#define IS_SEQ_NUM_INDEXED( pTwccManager ) \
+    ( ( ( pTwccManager )->flags & RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED ) != 0 )
+
+#define NEWEST_INDEX( pTwccManager )                   \
+    WRAP( ( pTwccManager ),                            \
+          ( pTwccManager )->writeIndex +               \
+          ( pTwccManager )->twccPacketInfoArrayLength - 1 )
+
+/* In the sequence number indexed mode, slots for sequence numbers which were
+ * never added are kept zeroed. The sent time is used as the validity tag to
+ * tell such a slot apart from a real packet with the same sequence number. */
+#define IS_PACKET_INFO_MATCHING( pTwccManager, index, seqNum )                      \
+    ( ( GetSeqNum( ( pTwccManager ), ( index ) ) == ( seqNum ) ) &&                 \
+      ( GetSentTime( ( pTwccManager ), ( index ) ) != RTCP_TWCC_PACKET_UNINITIALIZED_TIME ) )
+
+#define IS_LAZY_EVICTION( pTwccManager ) \
+    ( ( ( pTwccManager )->flags & RTCP_TWCC_MANAGER_FLAG_LAZY_EVICTION ) != 0 )
+
+#define IS_COMPACT_STORAGE( pTwccManager ) \
+    ( ( ( pTwccManager )->flags & RTCP_TWCC_MANAGER_INTERNAL_FLAG_COMPACT_STORAGE ) != 0 )
+
+/* Set internally by RtcpTwccManager_InitCompact. Not accepted as an init
+ * flag. */
+#define RTCP_TWCC_MANAGER_INTERNAL_FLAG_COMPACT_STORAGE    0x80000000
+
+#define RTCP_TWCC_SEQ_NUM_HALF_RANGE    32768
+#define RTCP_TWCC_SEQ_NUM_RANGE         65536
+
+/* Index accesses shared between the producer and the consumer of
+ * RtcpTwccSpscManager_t. The default implementation uses the GCC/Clang atomic
+ * builtins, which follow the C11 memory model and work on plain size_t
+ * members. Define these before compiling this file to port to other
+ * compilers. */
+#ifndef RTCP_TWCC_ATOMIC_LOAD_ACQUIRE
+    #define RTCP_TWCC_ATOMIC_LOAD_ACQUIRE( pIndex ) \
+    __atomic_load_n( ( pIndex ), __ATOMIC_ACQUIRE )
+#endif
+
+#ifndef RTCP_TWCC_ATOMIC_STORE_RELEASE
+    #define RTCP_TWCC_ATOMIC_STORE_RELEASE( pIndex, value ) \
+    __atomic_store_n( ( pIndex ), ( value ), __ATOMIC_RELEASE )
+#endif
+
+#define RTCP_TWCC_MANAGER_SUPPORTED_FLAGS       \
+    ( RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED |  \
+      RTCP_TWCC_MANAGER_FLAG_POWER_OF_TWO_LENGTH | \
+      RTCP_TWCC_MANAGER_FLAG_LAZY_EVICTION )
+
+/*-----------------------------------------------------------*/
+
+static size_t WrapIndex( const RtcpTwccManager_t * pTwccManager,
+                         size_t index )
+{
+    size_t wrappedIndex;
+
+    /* Mask is set only when the array length is a power of two, and saves an
+     * integer division on every index update. */
+    if( pTwccManager->indexMask != 0 )
+    {
+        wrappedIndex = index & pTwccManager->indexMask;
+    }
+    else
+    {
+        wrappedIndex = index % pTwccManager->twccPacketInfoArrayLength;
+    }
+
+    return wrappedIndex;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint64_t UnwrapSeqNum( uint64_t referenceExtendedSeqNum,
+                              uint16_t seqNum )
+{
+    uint64_t extendedSeqNum;
+    uint16_t forwardDistance;
+
+    forwardDistance = ( uint16_t ) ( seqNum - ( uint16_t ) referenceExtendedSeqNum );
+
+    /* Extended sequence numbers never go below zero, so a sequence number
+     * behind a reference close to zero is taken to be ahead of it. */
+    if( ( forwardDistance < RTCP_TWCC_SEQ_NUM_HALF_RANGE ) ||
+        ( ( uint64_t ) ( RTCP_TWCC_SEQ_NUM_RANGE - forwardDistance ) > referenceExtendedSeqNum ) )
+    {
+        extendedSeqNum = referenceExtendedSeqNum + forwardDistance;
+    }
+    else
+    {
+        extendedSeqNum = referenceExtendedSeqNum - ( RTCP_TWCC_SEQ_NUM_RANGE - forwardDistance );
+    }
+
+    return extendedSeqNum;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint16_t GetSeqNum( const RtcpTwccManager_t * pTwccManager,
+                           size_t index )
+{
+    uint16_t seqNum;
+
+    if( IS_COMPACT_STORAGE( pTwccManager ) )
+    {
+        seqNum = pTwccManager->compactArrays.pSeqNumArray[ index ];
+    }
+    else
+    {
+        seqNum = pTwccManager->pTwccPacketInfoArray[ index ].packetSeqNum;
+    }
+
+    return seqNum;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint64_t GetSentTime( const RtcpTwccManager_t * pTwccManager,
+                             size_t index )
+{
+    uint64_t sentTime;
+    uint32_t relativeSentTime;
+
+    if( IS_COMPACT_STORAGE( pTwccManager ) )
+    {
+        relativeSentTime = pTwccManager->compactArrays.pRelativeSentTimeArray[ index ];
+
+        /* The base sent time is always older than the sent times being
+         * tracked, so zero relative sent time marks an empty slot. */
+        if( relativeSentTime == 0 )
+        {
+            sentTime = RTCP_TWCC_PACKET_UNINITIALIZED_TIME;
+        }
+        else
+        {
+            sentTime = pTwccManager->baseSentTime + relativeSentTime;
+        }
+    }
+    else
+    {
+        sentTime = pTwccManager->pTwccPacketInfoArray[ index ].localSentTime;
+    }
+
+    return sentTime;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t GetPacketSize( const RtcpTwccManager_t * pTwccManager,
+                             size_t index )
+{
+    size_t packetSize;
+
+    if( IS_COMPACT_STORAGE( pTwccManager ) )
+    {
+        packetSize = pTwccManager->compactArrays.pPacketSizeArray[ index ];
+    }
+    else
+    {
+        packetSize = pTwccManager->pTwccPacketInfoArray[ index ].packetSize;
+    }
+
+    return packetSize;
+}
+
+/*-----------------------------------------------------------*/
+
+static void CopyPacketInfo( TwccPacketInfo_t * pTwccPacketInfo,
+                            const TwccPacketInfo_t * pTwccPacketInfoToWrite )
+{
+    pTwccPacketInfo->packetSize = pTwccPacketInfoToWrite->packetSize;
+    pTwccPacketInfo->localSentTime = pTwccPacketInfoToWrite->localSentTime;
+    pTwccPacketInfo->packetSeqNum = pTwccPacketInfoToWrite->packetSeqNum;
+}
+
+/*-----------------------------------------------------------*/
+
+static void WritePacketInfo( RtcpTwccManager_t * pTwccManager,
+                             size_t index,
+                             const TwccPacketInfo_t * pTwccPacketInfoToWrite )
+{
+    if( IS_COMPACT_STORAGE( pTwccManager ) )
+    {
+        pTwccManager->compactArrays.pSeqNumArray[ index ] = pTwccPacketInfoToWrite->packetSeqNum;
+        pTwccManager->compactArrays.pPacketSizeArray[ index ] = ( uint16_t ) pTwccPacketInfoToWrite->packetSize;
+
+        if( pTwccPacketInfoToWrite->localSentTime == RTCP_TWCC_PACKET_UNINITIALIZED_TIME )
+        {
+            pTwccManager->compactArrays.pRelativeSentTimeArray[ index ] = 0;
+        }
+        else
+        {
+            pTwccManager->compactArrays.pRelativeSentTimeArray[ index ] = ( uint32_t ) ( pTwccPacketInfoToWrite->localSentTime -
+                                                                                          pTwccManager->baseSentTime );
+        }
+    }
+    else
+    {
+        CopyPacketInfo( &( pTwccManager->pTwccPacketInfoArray[ index ] ),
+                        pTwccPacketInfoToWrite );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void ClearPacketInfo( RtcpTwccManager_t * pTwccManager,
+                             size_t index )
+{
+    const TwccPacketInfo_t emptyTwccPacketInfo = { 0 };
+
+    WritePacketInfo( pTwccManager,
+                     index,
+                     &( emptyTwccPacketInfo ) );
+}
+
+/*-----------------------------------------------------------*/
+
+static void ResetPacketInfos( RtcpTwccManager_t * pTwccManager )
+{
+    if( IS_COMPACT_STORAGE( pTwccManager ) )
+    {
+        memset( pTwccManager->compactArrays.pSeqNumArray,
+                0,
+                sizeof( uint16_t ) * pTwccManager->twccPacketInfoArrayLength );
+        memset( pTwccManager->compactArrays.pRelativeSentTimeArray,
+                0,
+                sizeof( uint32_t ) * pTwccManager->twccPacketInfoArrayLength );
+        memset( pTwccManager->compactArrays.pPacketSizeArray,
+                0,
+                sizeof( uint16_t ) * pTwccManager->twccPacketInfoArrayLength );
+    }
+    else
+    {
+        memset( pTwccManager->pTwccPacketInfoArray,
+                0,
+                sizeof( TwccPacketInfo_t ) * pTwccManager->twccPacketInfoArrayLength );
+    }
+
+    pTwccManager->readIndex = 0;
+    pTwccManager->writeIndex = 0;
+    pTwccManager->count = 0;
+}
+
+/*-----------------------------------------------------------*/
+
+static void RebaseSentTimes( RtcpTwccManager_t * pTwccManager,
+                             uint64_t sentTime )
+{
+    size_t i, index;
+    uint64_t packetSentTime, minSentTime = sentTime, maxSentTime = sentTime;
+    uint32_t * pRelativeSentTime;
+
+    for( i = 0; i < pTwccManager->count; i++ )
+    {
+        packetSentTime = GetSentTime( pTwccManager,
+                                      WRAP( pTwccManager, pTwccManager->readIndex + i ) );
+
+        if( packetSentTime != RTCP_TWCC_PACKET_UNINITIALIZED_TIME )
+        {
+            if( packetSentTime < minSentTime )
+            {
+                minSentTime = packetSentTime;
+            }
+
+            if( packetSentTime > maxSentTime )
+            {
+                maxSentTime = packetSentTime;
+            }
+        }
+    }
+
+    if( ( maxSentTime - minSentTime ) < UINT32_MAX )
+    {
+        /* Move the base right before the oldest sent time so that all the
+         * packet infos being tracked remain representable. */
+        for( i = 0; i < pTwccManager->count; i++ )
+        {
+            index = WRAP( pTwccManager, pTwccManager->readIndex + i );
+            pRelativeSentTime = &( pTwccManager->compactArrays.pRelativeSentTimeArray[ index ] );
+
+            if( *pRelativeSentTime != 0 )
+            {
+                *pRelativeSentTime = ( uint32_t ) ( ( pTwccManager->baseSentTime + *pRelativeSentTime ) -
+                                                    ( minSentTime - 1 ) );
+            }
+        }
+
+        pTwccManager->baseSentTime = minSentTime - 1;
+    }
+    else
+    {
+        /* The sent times are too far apart (i.e. the clock jumped), so start
+         * afresh. */
+        ResetPacketInfos( pTwccManager );
+        pTwccManager->baseSentTime = sentTime - 1;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static uint8_t IsPacketInfoExpired( const RtcpTwccManager_t * pTwccManager,
+                                    uint64_t packetSentTime,
+                                    uint64_t currentPacketSentTime )
+{
+    return ( ( currentPacketSentTime >= packetSentTime ) &&
+             ( ( currentPacketSentTime - packetSentTime ) > pTwccManager->timeWindow ) ) ? 1 : 0;
+}
+
+/*-----------------------------------------------------------*/
+
+static void DeleteOlderPacketInfos( RtcpTwccManager_t * pTwccManager,
+                                    uint64_t currentPacketSentTime )
+{
+    size_t i, readIndex, count;
+    uint64_t packetSentTime;
+
+    /* Make local copies as these values may get modified in the loop below. */
+    count = pTwccManager->count;
+    readIndex = pTwccManager->readIndex;
+
+    /* If i == count - 1 then the newly added packet is the one to be deleted,
+     * which is never the case. Hence i < count - 1. */
+    for( i = 0; i < count - 1 ; i++ )
+    {
+        packetSentTime = GetSentTime( pTwccManager,
+                                      WRAP( pTwccManager, readIndex + i ) );
+
+        if( IsPacketInfoExpired( pTwccManager,
+                                 packetSentTime,
+                                 currentPacketSentTime ) != 0 )
+        {
+            ClearPacketInfo( pTwccManager,
+                             WRAP( pTwccManager, readIndex + i ) );
+
+            /* We can modify these because we have already stored the
+             * values at the beginning which we use for iterating. */
+            pTwccManager->readIndex = INC_READ_INDEX( pTwccManager );
+            pTwccManager->count -= 1;
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/* Packet infos are ordered by sent time. A slot reserved for a skipped
+ * sequence number has no sent time and takes the sent time of the next packet
+ * info which has one, up to the given limit which is known not to be
+ * expired. */
+static uint8_t IsPacketInfoAtOffsetExpired( const RtcpTwccManager_t * pTwccManager,
+                                            size_t offset,
+                                            size_t limitOffset,
+                                            uint64_t currentPacketSentTime )
+{
+    uint8_t isExpired = 0;
+    uint64_t packetSentTime = RTCP_TWCC_PACKET_UNINITIALIZED_TIME;
+
+    while( offset < limitOffset )
+    {
+        packetSentTime = GetSentTime( pTwccManager,
+                                      WRAP( pTwccManager, pTwccManager->readIndex + offset ) );
+
+        if( packetSentTime != RTCP_TWCC_PACKET_UNINITIALIZED_TIME )
+        {
+            break;
+        }
+
+        offset++;
+    }
+
+    if( offset < limitOffset )
+    {
+        isExpired = IsPacketInfoExpired( pTwccManager,
+                                         packetSentTime,
+                                         currentPacketSentTime );
+    }
+
+    return isExpired;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t CountExpiredPacketInfos( const RtcpTwccManager_t * pTwccManager,
+                                       uint64_t currentPacketSentTime )
+{
+    size_t low = 0, high, middle, probe = 0, step = 1;
+
+    /* The newest packet info is never deleted, so the answer lies in
+     * [ 0, count - 1 ]. */
+    high = pTwccManager->count - 1;
+
+    /* Usually none or only a few of the oldest packet infos have expired, so
+     * probe exponentially growing offsets from the oldest packet info to
+     * bound the search before bisecting. */
+    while( probe < high )
+    {
+        if( IsPacketInfoAtOffsetExpired( pTwccManager,
+                                         probe,
+                                         high,
+                                         currentPacketSentTime ) != 0 )
+        {
+            low = probe + 1;
+            probe += step;
+            step *= 2;
+        }
+        else
+        {
+            high = probe;
+        }
+    }
+
+    /* The packet info before low is expired and the one at high is not. */
+    while( low < high )
+    {
+        middle = low + ( ( high - low ) / 2 );
+
+        if( IsPacketInfoAtOffsetExpired( pTwccManager,
+                                         middle,
+                                         high,
+                                         currentPacketSentTime ) != 0 )
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+/*-----------------------------------------------------------*/
+
+static void EvictOlderPacketInfos( RtcpTwccManager_t * pTwccManager,
+                                   uint64_t currentPacketSentTime )
+{
+    size_t expiredCount;
+
+    expiredCount = CountExpiredPacketInfos( pTwccManager,
+                                            currentPacketSentTime );
+
+    /* Evicted slots are not cleared. They are outside of the tracked range
+     * and get overwritten when the write index reaches them. */
+    pTwccManager->readIndex = WRAP( pTwccManager, pTwccManager->readIndex + expiredCount );
+    pTwccManager->count -= expiredCount;
+}
+
+/*-----------------------------------------------------------*/
+
+static void PushPacketInfo( RtcpTwccManager_t * pTwccManager,
+                            const TwccPacketInfo_t * pTwccPacketInfoToAdd )
+{
+    /* When full, the oldest packet info is at the write index and gets
+     * overwritten below, so there is no need to clear it. */
+    if( IS_TWCC_MANAGER_FULL( pTwccManager ) )
+    {
+        pTwccManager->readIndex = INC_READ_INDEX( pTwccManager );
+        pTwccManager->count -= 1;
+    }
+
+    WritePacketInfo( pTwccManager,
+                     pTwccManager->writeIndex,
+                     pTwccPacketInfoToAdd );
+
+    pTwccManager->writeIndex = INC_WRITE_INDEX( pTwccManager );
+    pTwccManager->count += 1;
+}
+
+/*-----------------------------------------------------------*/
+
+static void AddPacketInfoSeqNumIndexed( RtcpTwccManager_t * pTwccManager,
+                                        const TwccPacketInfo_t * pTwccPacketInfoToAdd )
+{
+    const TwccPacketInfo_t emptyTwccPacketInfo = { 0 };
+    size_t i, newestIndex;
+    uint64_t extendedSeqNum, seqNumDistance;
+
+    /* Unwrapping against the newest sequence number, even after the history
+     * is reset, keeps the extended sequence numbers continuous. */
+    extendedSeqNum = UnwrapSeqNum( pTwccManager->newestExtendedSeqNum,
+                                   pTwccPacketInfoToAdd->packetSeqNum );
+
+    if( IS_TWCC_MANAGER_EMPTY( pTwccManager ) )
+    {
+        PushPacketInfo( pTwccManager,
+                        pTwccPacketInfoToAdd );
+        pTwccManager->newestExtendedSeqNum = extendedSeqNum;
+    }
+    else
+    {
+        newestIndex = NEWEST_INDEX( pTwccManager );
+
+        if( extendedSeqNum == pTwccManager->newestExtendedSeqNum )
+        {
+            WritePacketInfo( pTwccManager,
+                             newestIndex,
+                             pTwccPacketInfoToAdd );
+        }
+        else if( extendedSeqNum > pTwccManager->newestExtendedSeqNum )
+        {
+            seqNumDistance = extendedSeqNum - pTwccManager->newestExtendedSeqNum;
+
+            if( seqNumDistance >= pTwccManager->twccPacketInfoArrayLength )
+            {
+                /* All the tracked packets would be pushed out of the array by
+                 * the gap, so start afresh. */
+                ResetPacketInfos( pTwccManager );
+            }
+            else
+            {
+                /* Reserve empty slots for the sequence numbers skipped by the
+                 * sender so that every slot stays at a fixed distance from
+                 * the newest packet. */
+                for( i = 1; i < seqNumDistance; i++ )
+                {
+                    PushPacketInfo( pTwccManager,
+                                    &( emptyTwccPacketInfo ) );
+                }
+            }
+
+            PushPacketInfo( pTwccManager,
+                            pTwccPacketInfoToAdd );
+            pTwccManager->newestExtendedSeqNum = extendedSeqNum;
+        }
+        else
+        {
+            /* The packet is older than the newest packet. Fill its slot if it
+             * is still within the tracked range, otherwise it would be the
+             * first one to be deleted anyway. */
+            seqNumDistance = pTwccManager->newestExtendedSeqNum - extendedSeqNum;
+
+            if( seqNumDistance < pTwccManager->count )
+            {
+                WritePacketInfo( pTwccManager,
+                                 WRAP( pTwccManager, newestIndex + pTwccManager->twccPacketInfoArrayLength - ( size_t ) seqNumDistance ),
+                                 pTwccPacketInfoToAdd );
+            }
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static RtcpTwccManagerResult_t FindPacketInfoLinear( const RtcpTwccManager_t * pTwccManager,
+                                                     uint16_t seqNum,
+                                                     size_t * pOutIndex )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND;
+    size_t i, index;
+
+    for( i = 0; i < pTwccManager->count; i++ )
+    {
+        index = WRAP( pTwccManager, pTwccManager->readIndex + i );
+
+        if( GetSeqNum( pTwccManager, index ) == seqNum )
+        {
+            *pOutIndex = index;
+            result = RTCP_TWCC_MANAGER_RESULT_OK;
+            break;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static RtcpTwccManagerResult_t FindPacketInfoExtendedSeqNumIndexed( const RtcpTwccManager_t * pTwccManager,
+                                                                    uint64_t extendedSeqNum,
+                                                                    size_t * pOutIndex )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND;
+    size_t index;
+    uint64_t seqNumDistance;
+
+    if( extendedSeqNum <= pTwccManager->newestExtendedSeqNum )
+    {
+        seqNumDistance = pTwccManager->newestExtendedSeqNum - extendedSeqNum;
+
+        if( seqNumDistance < pTwccManager->count )
+        {
+            index = WRAP( pTwccManager, NEWEST_INDEX( pTwccManager ) + pTwccManager->twccPacketInfoArrayLength - ( size_t ) seqNumDistance );
+
+            if( IS_PACKET_INFO_MATCHING( pTwccManager, index, ( uint16_t ) extendedSeqNum ) )
+            {
+                *pOutIndex = index;
+                result = RTCP_TWCC_MANAGER_RESULT_OK;
+            }
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static RtcpTwccManagerResult_t FindPacketInfoSeqNumIndexed( const RtcpTwccManager_t * pTwccManager,
+                                                            uint16_t seqNum,
+                                                            size_t * pOutIndex )
+{
+    return FindPacketInfoExtendedSeqNumIndexed( pTwccManager,
+                                                UnwrapSeqNum( pTwccManager->newestExtendedSeqNum,
+                                                              seqNum ),
+                                                pOutIndex );
+}
+
+/*-----------------------------------------------------------*/
+
+static RtcpTwccManagerResult_t FindPacketInfoIndex( const RtcpTwccManager_t * pTwccManager,
+                                                    uint16_t seqNum,
+                                                    size_t * pOutIndex )
+{
+    RtcpTwccManagerResult_t result;
+
+    if( IS_TWCC_MANAGER_EMPTY( pTwccManager ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_EMPTY;
+    }
+    else if( IS_SEQ_NUM_INDEXED( pTwccManager ) )
+    {
+        result = FindPacketInfoSeqNumIndexed( pTwccManager,
+                                              seqNum,
+                                              pOutIndex );
+    }
+    else
+    {
+        result = FindPacketInfoLinear( pTwccManager,
+                                       seqNum,
+                                       pOutIndex );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static RtcpTwccManagerResult_t FindPacketInfoIndexFromCursor( const RtcpTwccManager_t * pTwccManager,
+                                                              size_t cursorIndex,
+                                                              uint16_t seqNum,
+                                                              size_t * pOutIndex )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND;
+    size_t cursorOffset, seqNumDistance, index;
+
+    if( !IS_TWCC_MANAGER_EMPTY( pTwccManager ) )
+    {
+        cursorOffset = WRAP( pTwccManager,
+                             cursorIndex + pTwccManager->twccPacketInfoArrayLength - pTwccManager->readIndex );
+        seqNumDistance = ( uint16_t ) ( seqNum - GetSeqNum( pTwccManager, cursorIndex ) );
+
+        /* Packet infos are added in the order they are sent. Therefore, the
+         * packet info for a sequence number is usually as many slots after
+         * the cursor as the sequence number is after the cursor's one. */
+        if( seqNumDistance < ( pTwccManager->count - cursorOffset ) )
+        {
+            index = WRAP( pTwccManager, cursorIndex + seqNumDistance );
+
+            if( IS_PACKET_INFO_MATCHING( pTwccManager, index, seqNum ) )
+            {
+                *pOutIndex = index;
+                result = RTCP_TWCC_MANAGER_RESULT_OK;
+            }
+        }
+    }
+
+    /* Packet infos which were not added in sequence number order. */
+    if( result != RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        result = FindPacketInfoIndex( pTwccManager,
+                                      seqNum,
+                                      pOutIndex );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static TwccPacketInfo_t * GetPacketInfo( RtcpTwccManager_t * pTwccManager,
+                                         size_t index )
+{
+    TwccPacketInfo_t * pTwccPacketInfo;
+
+    if( IS_COMPACT_STORAGE( pTwccManager ) )
+    {
+        pTwccManager->foundTwccPacketInfo.packetSeqNum = GetSeqNum( pTwccManager, index );
+        pTwccManager->foundTwccPacketInfo.localSentTime = GetSentTime( pTwccManager, index );
+        pTwccManager->foundTwccPacketInfo.packetSize = GetPacketSize( pTwccManager, index );
+
+        pTwccPacketInfo = &( pTwccManager->foundTwccPacketInfo );
+    }
+    else
+    {
+        pTwccPacketInfo = &( pTwccManager->pTwccPacketInfoArray[ index ] );
+    }
+
+    return pTwccPacketInfo;
+}
+
+/*-----------------------------------------------------------*/
+
+static RtcpTwccManagerResult_t InitManager( RtcpTwccManager_t * pTwccManager,
+                                            size_t twccPacketInfoArrayLength,
+                                            uint32_t flags )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+
+    if( ( twccPacketInfoArrayLength == 0 ) ||
+        ( ( flags & ~( ( uint32_t ) RTCP_TWCC_MANAGER_SUPPORTED_FLAGS ) ) != 0 ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    if( ( result == RTCP_TWCC_MANAGER_RESULT_OK ) &&
+        ( ( flags & RTCP_TWCC_MANAGER_FLAG_POWER_OF_TWO_LENGTH ) != 0 ) &&
+        ( !IS_POWER_OF_TWO( twccPacketInfoArrayLength ) ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    if( ( result == RTCP_TWCC_MANAGER_RESULT_OK ) &&
+        ( ( flags & RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED ) == 0 ) &&
+        ( twccPacketInfoArrayLength > RTCP_TWCC_MANAGER_MAX_LINEAR_LENGTH ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        pTwccManager->twccPacketInfoArrayLength = twccPacketInfoArrayLength;
+        pTwccManager->flags = flags;
+        pTwccManager->baseSentTime = 0;
+        pTwccManager->newestExtendedSeqNum = 0;
+        pTwccManager->pDelayBasedEstimator = NULL;
+        pTwccManager->timeWindow = RTCP_TWCC_ESTIMATOR_TIME_WINDOW;
+
+        if( ( flags & RTCP_TWCC_MANAGER_FLAG_POWER_OF_TWO_LENGTH ) != 0 )
+        {
+            pTwccManager->indexMask = twccPacketInfoArrayLength - 1;
+        }
+        else
+        {
+            pTwccManager->indexMask = 0;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccManagerResult_t RtcpTwccManager_Init( RtcpTwccManager_t * pTwccManager,
+                                              TwccPacketInfo_t * pTwccPacketInfoArray,
+                                              size_t twccPacketInfoArrayLength )
+{
+    return RtcpTwccManager_InitWithFlags( pTwccManager,
+                                          pTwccPacketInfoArray,
+                                          twccPacketInfoArrayLength,
+                                          RTCP_TWCC_MANAGER_FLAG_NONE );
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccManagerResult_t RtcpTwccManager_InitWithFlags( RtcpTwccManager_t * pTwccManager,
+                                                       TwccPacketInfo_t * pTwccPacketInfoArray,
+                                                       size_t twccPacketInfoArrayLength,
+                                                       uint32_t flags )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+
+    if( ( pTwccManager == NULL ) ||
+        ( pTwccPacketInfoArray == NULL ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        result = InitManager( pTwccManager,
+                              twccPacketInfoArrayLength,
+                              flags );
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        pTwccManager->pTwccPacketInfoArray = pTwccPacketInfoArray;
+        memset( &( pTwccManager->compactArrays ),
+                0,
+                sizeof( TwccCompactPacketInfoArrays_t ) );
+
+        ResetPacketInfos( pTwccManager );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccManagerResult_t RtcpTwccManager_InitCompact( RtcpTwccManager_t * pTwccManager,
+                                                     const TwccCompactPacketInfoArrays_t * pCompactArrays,
+                                                     size_t twccPacketInfoArrayLength,
+                                                     uint32_t flags )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+
+    if( ( pTwccManager == NULL ) ||
+        ( pCompactArrays == NULL ) ||
+        ( pCompactArrays->pSeqNumArray == NULL ) ||
+        ( pCompactArrays->pRelativeSentTimeArray == NULL ) ||
+        ( pCompactArrays->pPacketSizeArray == NULL ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        result = InitManager( pTwccManager,
+                              twccPacketInfoArrayLength,
+                              flags );
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        pTwccManager->pTwccPacketInfoArray = NULL;
+        pTwccManager->compactArrays = *pCompactArrays;
+        pTwccManager->flags |= RTCP_TWCC_MANAGER_INTERNAL_FLAG_COMPACT_STORAGE;
+
+        ResetPacketInfos( pTwccManager );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccManagerResult_t RtcpTwccManager_SetDelayBasedEstimator( RtcpTwccManager_t * pTwccManager,
+                                                                RtcpDelayBasedEstimator_t * pDelayBasedEstimator )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+
+    if( pTwccManager == NULL )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        pTwccManager->pDelayBasedEstimator = pDelayBasedEstimator;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccManagerResult_t RtcpTwccManager_SetTimeWindow( RtcpTwccManager_t * pTwccManager,
+                                                       uint64_t timeWindow )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+
+    if( ( pTwccManager == NULL ) ||
+        ( timeWindow == 0 ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        pTwccManager->timeWindow = timeWindow;
+    }
+
+    return result;
+}
+
 /*-----------------------------------------------------------*/
 
-static void DeleteOlderPacketInfos( RtcpTwccManager_t * pTwccManager,
-                                    uint64_t currentPacketSentTime )
+RtcpTwccManagerResult_t RtcpTwccManager_AddPacketInfo( RtcpTwccManager_t * pTwccManager,
+                                                       const TwccPacketInfo_t * pTwccPacketInfoToAdd )
 {
-    size_t i, readIndex, count;
-    TwccPacketInfo_t * pTwccPacketInfo;
-    uint64_t packetAge;
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+    uint64_t sentTime;
 
-    /* Make local copies as these values may get modified in the loop below. */
-    count = pTwccManager->count;
-    readIndex = pTwccManager->readIndex;
+    if( ( pTwccManager == NULL ) ||
+        ( pTwccPacketInfoToAdd == NULL ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
 
-    /* If i == count - 1 then the newly added packet is the one to be deleted,
-     * which is never the case. Hence i < count - 1. */
-    for( i = 0; i < count - 1 ; i++ )
+    if( ( result == RTCP_TWCC_MANAGER_RESULT_OK ) &&
+        IS_COMPACT_STORAGE( pTwccManager ) )
     {
-        pTwccPacketInfo = &( pTwccManager->pTwccPacketInfoArray[ WRAP( readIndex + i,
-                                                                       pTwccManager->twccPacketInfoArrayLength ) ] );
+        sentTime = pTwccPacketInfoToAdd->localSentTime;
 
-        if( currentPacketSentTime >= pTwccPacketInfo->localSentTime )
+        if( pTwccPacketInfoToAdd->packetSize > UINT16_MAX )
+        {
+            result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+        }
+        else if( ( sentTime != RTCP_TWCC_PACKET_UNINITIALIZED_TIME ) &&
+                 ( ( sentTime <= pTwccManager->baseSentTime ) ||
+                   ( ( sentTime - pTwccManager->baseSentTime ) > UINT32_MAX ) ) )
+        {
+            RebaseSentTimes( pTwccManager,
+                             sentTime );
+        }
+        else
         {
-            packetAge = currentPacketSentTime - pTwccPacketInfo->localSentTime;
+            /* Sent time fits in the relative sent time array. */
+        }
+    }
 
-            if( packetAge > RTCP_TWCC_ESTIMATOR_TIME_WINDOW )
-            {
-                memset( pTwccPacketInfo,
-                        0,
-                        sizeof( TwccPacketInfo_t ) );
-
-                /* We can modify these because we have already stored the
-                 * values at the beginning which we use for iterating. */
-                pTwccManager->readIndex = INC_READ_INDEX( pTwccManager );
-                pTwccManager->count -= 1;
-            }
-            else
-            {
-                break;
-            }
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        if( IS_SEQ_NUM_INDEXED( pTwccManager ) )
+        {
+            AddPacketInfoSeqNumIndexed( pTwccManager,
+                                        pTwccPacketInfoToAdd );
         }
         else
         {
-            break;
+            PushPacketInfo( pTwccManager,
+                            pTwccPacketInfoToAdd );
+        }
+
+        if( IS_LAZY_EVICTION( pTwccManager ) )
+        {
+            EvictOlderPacketInfos( pTwccManager, pTwccPacketInfoToAdd->localSentTime );
+        }
+        else
+        {
+            DeleteOlderPacketInfos( pTwccManager, pTwccPacketInfoToAdd->localSentTime );
         }
     }
+
+    return result;
 }
 
 /*-----------------------------------------------------------*/
 
-RtcpTwccManagerResult_t RtcpTwccManager_Init( RtcpTwccManager_t * pTwccManager,
-                                              TwccPacketInfo_t * pTwccPacketInfoArray,
-                                              size_t twccPacketInfoArrayLength )
+RtcpTwccManagerResult_t RtcpTwccManager_FindPacketInfo( RtcpTwccManager_t * pTwccManager,
+                                                        uint16_t seqNum,
+                                                        TwccPacketInfo_t ** ppOutTwccPacketInfo )
 {
     RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+    size_t index;
 
     if( ( pTwccManager == NULL ) ||
-        ( pTwccPacketInfoArray == NULL ) ||
-        ( twccPacketInfoArrayLength == 0 ) )
+        ( ppOutTwccPacketInfo == NULL ) )
     {
         result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
     }
 
     if( result == RTCP_TWCC_MANAGER_RESULT_OK )
     {
-        pTwccManager->pTwccPacketInfoArray = pTwccPacketInfoArray;
-        pTwccManager->twccPacketInfoArrayLength = twccPacketInfoArrayLength;
+        result = FindPacketInfoIndex( pTwccManager,
+                                      seqNum,
+                                      &( index ) );
+    }
 
-        memset( pTwccManager->pTwccPacketInfoArray,
-                0,
-                sizeof( TwccPacketInfo_t ) * twccPacketInfoArrayLength );
-        pTwccManager->readIndex = 0;
-        pTwccManager->writeIndex = 0;
-        pTwccManager->count = 0;
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        *ppOutTwccPacketInfo = GetPacketInfo( pTwccManager,
+                                              index );
     }
 
     return result;
@@ -104,40 +996,158 @@ RtcpTwccManagerResult_t RtcpTwccManager_Init( RtcpTwccManager_t * pTwccManager,
 
 /*-----------------------------------------------------------*/
 
-RtcpTwccManagerResult_t RtcpTwccManager_AddPacketInfo( RtcpTwccManager_t * pTwccManager,
-                                                       const TwccPacketInfo_t * pTwccPacketInfoToAdd )
+RtcpTwccManagerResult_t RtcpTwccManager_FindPacketInfoExtended( RtcpTwccManager_t * pTwccManager,
+                                                                uint64_t extendedSeqNum,
+                                                                TwccPacketInfo_t ** ppOutTwccPacketInfo )
 {
     RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
-    TwccPacketInfo_t * pTwccPacketInfo;
+    size_t index;
 
     if( ( pTwccManager == NULL ) ||
-        ( pTwccPacketInfoToAdd == NULL ) )
+        ( ppOutTwccPacketInfo == NULL ) ||
+        ( !IS_SEQ_NUM_INDEXED( pTwccManager ) ) )
     {
         result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
     }
 
+    if( ( result == RTCP_TWCC_MANAGER_RESULT_OK ) &&
+        IS_TWCC_MANAGER_EMPTY( pTwccManager ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_EMPTY;
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        result = FindPacketInfoExtendedSeqNumIndexed( pTwccManager,
+                                                      extendedSeqNum,
+                                                      &( index ) );
+    }
+
     if( result == RTCP_TWCC_MANAGER_RESULT_OK )
     {
-        if( IS_TWCC_MANAGER_FULL( pTwccManager ) )
+        *ppOutTwccPacketInfo = GetPacketInfo( pTwccManager,
+                                              index );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void HandleTwccPacket( RtcpTwccManager_t * pTwccManager,
+                              const RtcpTwccPacket_t * pTwccPacket,
+                              TwccBandwidthInfo_t * pBandwidthInfo,
+                              TwccPacketFeedback_t * pPacketFeedbackArray,
+                              size_t * pPacketFeedbackCount )
+{
+    RtcpTwccManagerResult_t findPacketResult;
+    size_t packetFeedbackCount = 0;
+    size_t i, packetSize, packetInfoIndex, previousPacketInfoIndex;
+    size_t cursorPacketInfoIndex = pTwccManager->readIndex;
+    uint8_t localStartTimeRecorded = 0;
+    uint64_t localStartTime = RTCP_TWCC_PACKET_UNINITIALIZED_TIME, localEndTime;
+    PacketArrivalInfo_t * pArrivalInfo;
+    TwccPacketFeedback_t * pPacketFeedback;
+
+    memset( pBandwidthInfo,
+            0,
+            sizeof( TwccBandwidthInfo_t ) );
+
+    for( i = 0; i < pTwccPacket->arrivalInfoListLength; i++ )
+    {
+        pArrivalInfo = &( pTwccPacket->pArrivalInfoList[ i ] );
+
+        /* Arrival infos are sorted by sequence number. The cursor starts at
+         * the oldest packet info and follows the last matched one, so that
+         * the packet info for each arrival is found from the sequence number
+         * distance to the cursor instead of searching the history. */
+        findPacketResult = FindPacketInfoIndexFromCursor( pTwccManager,
+                                                          cursorPacketInfoIndex,
+                                                          pArrivalInfo->seqNum,
+                                                          &( packetInfoIndex ) );
+
+        if( localStartTimeRecorded == 0 )
         {
-            pTwccPacketInfo = &( pTwccManager->pTwccPacketInfoArray[ pTwccManager->readIndex ] );
-            memset( pTwccPacketInfo,
-                    0,
-                    sizeof( TwccPacketInfo_t ) );
-            pTwccManager->readIndex = INC_READ_INDEX( pTwccManager );
-            pTwccManager->count -= 1;
+            if( ( FindPacketInfoIndexFromCursor( pTwccManager,
+                                                 cursorPacketInfoIndex,
+                                                 pArrivalInfo->seqNum - 1,
+                                                 &( previousPacketInfoIndex ) ) == RTCP_TWCC_MANAGER_RESULT_OK ) &&
+                ( GetSentTime( pTwccManager, previousPacketInfoIndex ) != RTCP_TWCC_PACKET_UNINITIALIZED_TIME ) )
+            {
+                localStartTime = GetSentTime( pTwccManager, previousPacketInfoIndex );
+                localStartTimeRecorded = 1;
+            }
+            else if( findPacketResult == RTCP_TWCC_MANAGER_RESULT_OK )
+            {
+                localStartTime = GetSentTime( pTwccManager, packetInfoIndex );
+                localStartTimeRecorded = 1;
+            }
+        }
+
+        if( findPacketResult == RTCP_TWCC_MANAGER_RESULT_OK )
+        {
+            cursorPacketInfoIndex = packetInfoIndex;
+
+            localEndTime = GetSentTime( pTwccManager, packetInfoIndex );
+            packetSize = GetPacketSize( pTwccManager, packetInfoIndex );
+            pBandwidthInfo->duration = localEndTime - localStartTime;
+            pBandwidthInfo->sentBytes += packetSize;
+            pBandwidthInfo->sentPackets += 1;
+
+            if( pPacketFeedbackArray != NULL )
+            {
+                pPacketFeedback = &( pPacketFeedbackArray[ packetFeedbackCount ] );
+                pPacketFeedback->packetSeqNum = pArrivalInfo->seqNum;
+                pPacketFeedback->localSentTime = localEndTime;
+                pPacketFeedback->remoteArrivalTime = pArrivalInfo->remoteArrivalTime;
+                pPacketFeedback->packetSize = packetSize;
+                packetFeedbackCount += 1;
+            }
+
+            if( pArrivalInfo->remoteArrivalTime != RTCP_TWCC_PACKET_LOST_TIME )
+            {
+                pBandwidthInfo->receivedBytes += packetSize;
+                pBandwidthInfo->receivedPackets += 1;
+
+                if( pTwccManager->pDelayBasedEstimator != NULL )
+                {
+                    ( void ) RtcpDelayBasedEstimator_AddPacketFeedback( pTwccManager->pDelayBasedEstimator,
+                                                                        localEndTime,
+                                                                        pArrivalInfo->remoteArrivalTime,
+                                                                        packetSize );
+                }
+            }
         }
+    }
+
+    if( pPacketFeedbackCount != NULL )
+    {
+        *pPacketFeedbackCount = packetFeedbackCount;
+    }
+}
 
-        pTwccPacketInfo = &( pTwccManager->pTwccPacketInfoArray[ pTwccManager->writeIndex ] );
+/*-----------------------------------------------------------*/
 
-        pTwccPacketInfo->packetSize = pTwccPacketInfoToAdd->packetSize;
-        pTwccPacketInfo->localSentTime = pTwccPacketInfoToAdd->localSentTime;
-        pTwccPacketInfo->packetSeqNum = pTwccPacketInfoToAdd->packetSeqNum;
+RtcpTwccManagerResult_t RtcpTwccManager_HandleTwccPacket( RtcpTwccManager_t * pTwccManager,
+                                                          const RtcpTwccPacket_t * pTwccPacket,
+                                                          TwccBandwidthInfo_t * pBandwidthInfo )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
 
-        pTwccManager->writeIndex = INC_WRITE_INDEX( pTwccManager );
-        pTwccManager->count += 1;
+    if( ( pTwccManager == NULL ) ||
+        ( pTwccPacket == NULL ) ||
+        ( pBandwidthInfo == NULL ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
 
-        DeleteOlderPacketInfos( pTwccManager, pTwccPacketInfoToAdd->localSentTime );
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        HandleTwccPacket( pTwccManager,
+                          pTwccPacket,
+                          pBandwidthInfo,
+                          NULL,
+                          NULL );
     }
 
     return result;
@@ -145,63 +1155,200 @@ RtcpTwccManagerResult_t RtcpTwccManager_AddPacketInfo( RtcpTwccManager_t * pTwcc
 
 /*-----------------------------------------------------------*/
 
-RtcpTwccManagerResult_t RtcpTwccManager_FindPacketInfo( RtcpTwccManager_t * pTwccManager,
-                                                        uint16_t seqNum,
-                                                        TwccPacketInfo_t ** ppOutTwccPacketInfo )
+RtcpTwccManagerResult_t RtcpTwccManager_HandleTwccPacketWithFeedback( RtcpTwccManager_t * pTwccManager,
+                                                                      const RtcpTwccPacket_t * pTwccPacket,
+                                                                      TwccBandwidthInfo_t * pBandwidthInfo,
+                                                                      TwccPacketFeedback_t * pPacketFeedbackArray,
+                                                                      size_t packetFeedbackArrayLength,
+                                                                      size_t * pPacketFeedbackCount )
 {
     RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
-    TwccPacketInfo_t * pTwccPacketInfo;
-    size_t i;
 
     if( ( pTwccManager == NULL ) ||
-        ( ppOutTwccPacketInfo == NULL ) )
+        ( pTwccPacket == NULL ) ||
+        ( pBandwidthInfo == NULL ) ||
+        ( pPacketFeedbackArray == NULL ) ||
+        ( pPacketFeedbackCount == NULL ) ||
+        ( packetFeedbackArrayLength < pTwccPacket->arrivalInfoListLength ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        HandleTwccPacket( pTwccManager,
+                          pTwccPacket,
+                          pBandwidthInfo,
+                          pPacketFeedbackArray,
+                          pPacketFeedbackCount );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccManagerResult_t RtcpTwccSeqNumUnwrapper_Init( RtcpTwccSeqNumUnwrapper_t * pSeqNumUnwrapper )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+
+    if( pSeqNumUnwrapper == NULL )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        pSeqNumUnwrapper->lastExtendedSeqNum = 0;
+        pSeqNumUnwrapper->initialized = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccManagerResult_t RtcpTwccSeqNumUnwrapper_Unwrap( RtcpTwccSeqNumUnwrapper_t * pSeqNumUnwrapper,
+                                                        uint16_t seqNum,
+                                                        uint64_t * pExtendedSeqNum )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+
+    if( ( pSeqNumUnwrapper == NULL ) ||
+        ( pExtendedSeqNum == NULL ) )
     {
         result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
     }
 
     if( result == RTCP_TWCC_MANAGER_RESULT_OK )
     {
-        if( IS_TWCC_MANAGER_EMPTY( pTwccManager ) )
+        if( pSeqNumUnwrapper->initialized == 0 )
+        {
+            pSeqNumUnwrapper->lastExtendedSeqNum = seqNum;
+            pSeqNumUnwrapper->initialized = 1;
+        }
+        else
         {
-            result = RTCP_TWCC_MANAGER_RESULT_EMPTY;
+            pSeqNumUnwrapper->lastExtendedSeqNum = UnwrapSeqNum( pSeqNumUnwrapper->lastExtendedSeqNum,
+                                                                 seqNum );
         }
+
+        *pExtendedSeqNum = pSeqNumUnwrapper->lastExtendedSeqNum;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccManagerResult_t RtcpTwccSpscManager_Init( RtcpTwccSpscManager_t * pTwccSpscManager,
+                                                  TwccPacketInfo_t * pTwccPacketInfoArray,
+                                                  size_t twccPacketInfoArrayLength )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+
+    if( ( pTwccSpscManager == NULL ) ||
+        ( pTwccPacketInfoArray == NULL ) ||
+        ( twccPacketInfoArrayLength == 0 ) ||
+        ( twccPacketInfoArrayLength > RTCP_TWCC_MANAGER_MAX_LINEAR_LENGTH ) ||
+        ( !IS_POWER_OF_TWO( twccPacketInfoArrayLength ) ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
     }
 
     if( result == RTCP_TWCC_MANAGER_RESULT_OK )
     {
-        result = RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND;
+        pTwccSpscManager->pTwccPacketInfoArray = pTwccPacketInfoArray;
+        pTwccSpscManager->twccPacketInfoArrayLength = twccPacketInfoArrayLength;
+        pTwccSpscManager->indexMask = twccPacketInfoArrayLength - 1;
 
-        for( i = 0; i < pTwccManager->count; i++ )
-        {
-            pTwccPacketInfo = &( pTwccManager->pTwccPacketInfoArray[ WRAP( pTwccManager->readIndex + i,
-                                                                           pTwccManager->twccPacketInfoArrayLength ) ] );
+        memset( pTwccSpscManager->pTwccPacketInfoArray,
+                0,
+                sizeof( TwccPacketInfo_t ) * twccPacketInfoArrayLength );
+        pTwccSpscManager->readIndex = 0;
+        pTwccSpscManager->writeIndex = 0;
+        pTwccSpscManager->timeWindow = RTCP_TWCC_ESTIMATOR_TIME_WINDOW;
+    }
 
-            if( pTwccPacketInfo->packetSeqNum == seqNum )
-            {
-                *ppOutTwccPacketInfo = pTwccPacketInfo;
-                result = RTCP_TWCC_MANAGER_RESULT_OK;
-                break;
-            }
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccManagerResult_t RtcpTwccSpscManager_SetTimeWindow( RtcpTwccSpscManager_t * pTwccSpscManager,
+                                                           uint64_t timeWindow )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+
+    if( ( pTwccSpscManager == NULL ) ||
+        ( timeWindow == 0 ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        pTwccSpscManager->timeWindow = timeWindow;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccManagerResult_t RtcpTwccSpscManager_AddPacketInfo( RtcpTwccSpscManager_t * pTwccSpscManager,
+                                                           const TwccPacketInfo_t * pTwccPacketInfoToAdd )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+    size_t readIndex, writeIndex;
+
+    if( ( pTwccSpscManager == NULL ) ||
+        ( pTwccPacketInfoToAdd == NULL ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        /* Only the producer writes the write index. Acquiring the read index
+         * ensures that the consumer is done with the slot we are about to
+         * overwrite. */
+        writeIndex = pTwccSpscManager->writeIndex;
+        readIndex = RTCP_TWCC_ATOMIC_LOAD_ACQUIRE( &( pTwccSpscManager->readIndex ) );
+
+        if( ( writeIndex - readIndex ) == pTwccSpscManager->twccPacketInfoArrayLength )
+        {
+            result = RTCP_TWCC_MANAGER_RESULT_FULL;
         }
     }
 
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        CopyPacketInfo( &( pTwccSpscManager->pTwccPacketInfoArray[ writeIndex & pTwccSpscManager->indexMask ] ),
+                        pTwccPacketInfoToAdd );
+
+        /* Publish the packet info to the consumer. */
+        RTCP_TWCC_ATOMIC_STORE_RELEASE( &( pTwccSpscManager->writeIndex ),
+                                        writeIndex + 1 );
+    }
+
     return result;
 }
 
 /*-----------------------------------------------------------*/
 
-RtcpTwccManagerResult_t RtcpTwccManager_HandleTwccPacket( RtcpTwccManager_t * pTwccManager,
-                                                          const RtcpTwccPacket_t * pTwccPacket,
-                                                          TwccBandwidthInfo_t * pBandwidthInfo )
+RtcpTwccManagerResult_t RtcpTwccSpscManager_HandleTwccPacket( RtcpTwccSpscManager_t * pTwccSpscManager,
+                                                              const RtcpTwccPacket_t * pTwccPacket,
+                                                              TwccBandwidthInfo_t * pBandwidthInfo )
 {
-    RtcpTwccManagerResult_t findPacketResult, result = RTCP_TWCC_MANAGER_RESULT_OK;
-    size_t i;
-    uint8_t localStartTimeRecorded = 0;
-    uint64_t localStartTime, localEndTime;
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+    RtcpTwccManager_t twccManager = { 0 };
     TwccPacketInfo_t * pTwccPacketInfo;
-    PacketArrivalInfo_t * pArrivalInfo;
+    size_t readIndex, writeIndex;
+    uint64_t newestPacketSentTime;
+    uint16_t lastSeqNum;
 
-    if( ( pTwccManager == NULL ) ||
+    if( ( pTwccSpscManager == NULL ) ||
         ( pTwccPacket == NULL ) ||
         ( pBandwidthInfo == NULL ) )
     {
@@ -210,62 +1357,77 @@ RtcpTwccManagerResult_t RtcpTwccManager_HandleTwccPacket( RtcpTwccManager_t * pT
 
     if( result == RTCP_TWCC_MANAGER_RESULT_OK )
     {
-        memset( pBandwidthInfo,
-                0,
-                sizeof( TwccBandwidthInfo_t ) );
+        /* Only the consumer writes the read index. Acquiring the write index
+         * makes all the packet infos published by the producer visible. */
+        readIndex = pTwccSpscManager->readIndex;
+        writeIndex = RTCP_TWCC_ATOMIC_LOAD_ACQUIRE( &( pTwccSpscManager->writeIndex ) );
 
-        for( i = 0; i < pTwccPacket->arrivalInfoListLength; i++ )
+        if( writeIndex != readIndex )
         {
-            pArrivalInfo = &( pTwccPacket->pArrivalInfoList[ i ] );
+            newestPacketSentTime = pTwccSpscManager->pTwccPacketInfoArray[ ( writeIndex - 1 ) & pTwccSpscManager->indexMask ].localSentTime;
 
-            if( localStartTimeRecorded == 0 )
+            /* The newest packet info is never deleted. */
+            while( ( writeIndex - readIndex ) > 1 )
             {
-                findPacketResult = RtcpTwccManager_FindPacketInfo( pTwccManager,
-                                                                   pArrivalInfo->seqNum - 1,
-                                                                   &( pTwccPacketInfo ) );
+                pTwccPacketInfo = &( pTwccSpscManager->pTwccPacketInfoArray[ readIndex & pTwccSpscManager->indexMask ] );
 
-                if( findPacketResult != RTCP_TWCC_MANAGER_RESULT_OK )
+                if( ( newestPacketSentTime >= pTwccPacketInfo->localSentTime ) &&
+                    ( ( newestPacketSentTime - pTwccPacketInfo->localSentTime ) > pTwccSpscManager->timeWindow ) )
                 {
-                    localStartTime = RTCP_TWCC_PACKET_UNINITIALIZED_TIME;
+                    readIndex += 1;
                 }
                 else
                 {
-                    localStartTime = pTwccPacketInfo->localSentTime;
-                    localStartTimeRecorded = 1;
-                }
-
-                if( localStartTime == RTCP_TWCC_PACKET_UNINITIALIZED_TIME )
-                {
-                    findPacketResult = RtcpTwccManager_FindPacketInfo( pTwccManager,
-                                                                       pArrivalInfo->seqNum,
-                                                                       &( pTwccPacketInfo ) );
-
-                    if( findPacketResult == RTCP_TWCC_MANAGER_RESULT_OK )
-                    {
-                        localStartTime = pTwccPacketInfo->localSentTime;
-                        localStartTimeRecorded = 1;
-                    }
+                    break;
                 }
             }
 
-            findPacketResult = RtcpTwccManager_FindPacketInfo( pTwccManager,
-                                                               pArrivalInfo->seqNum,
-                                                               &( pTwccPacketInfo ) );
+            /* Hand the deleted slots back to the producer. */
+            RTCP_TWCC_ATOMIC_STORE_RELEASE( &( pTwccSpscManager->readIndex ),
+                                            readIndex );
+        }
 
-            if( findPacketResult == RTCP_TWCC_MANAGER_RESULT_OK )
-            {
-                localEndTime = pTwccPacketInfo->localSentTime;
-                pBandwidthInfo->duration = localEndTime - localStartTime;
-                pBandwidthInfo->sentBytes += pTwccPacketInfo->packetSize;
-                pBandwidthInfo->sentPackets += 1;
+        /* The slots between the read and the write index are not modified by
+         * the producer until we release them, so they can be handled like a
+         * regular TWCC manager. */
+        twccManager.pTwccPacketInfoArray = pTwccSpscManager->pTwccPacketInfoArray;
+        twccManager.twccPacketInfoArrayLength = pTwccSpscManager->twccPacketInfoArrayLength;
+        twccManager.readIndex = readIndex & pTwccSpscManager->indexMask;
+        twccManager.writeIndex = writeIndex & pTwccSpscManager->indexMask;
+        twccManager.count = writeIndex - readIndex;
+        twccManager.indexMask = pTwccSpscManager->indexMask;
+        twccManager.flags = RTCP_TWCC_MANAGER_FLAG_POWER_OF_TWO_LENGTH;
+        twccManager.timeWindow = pTwccSpscManager->timeWindow;
 
-                if( pArrivalInfo->remoteArrivalTime != RTCP_TWCC_PACKET_LOST_TIME )
-                {
-                    pBandwidthInfo->receivedBytes += pTwccPacketInfo->packetSize;
-                    pBandwidthInfo->receivedPackets += 1;
-                }
+        result = RtcpTwccManager_HandleTwccPacket( &( twccManager ),
+                                                   pTwccPacket,
+                                                   pBandwidthInfo );
+    }
+
+    if( ( result == RTCP_TWCC_MANAGER_RESULT_OK ) &&
+        ( pTwccPacket->arrivalInfoListLength > 0 ) )
+    {
+        lastSeqNum = pTwccPacket->pArrivalInfoList[ pTwccPacket->arrivalInfoListLength - 1 ].seqNum;
+
+        /* Packet infos up to the last sequence number in the feedback are
+         * never looked up again, so release them. Otherwise, a ring shorter
+         * than the time window fills up and the producer is starved. */
+        while( readIndex != writeIndex )
+        {
+            pTwccPacketInfo = &( pTwccSpscManager->pTwccPacketInfoArray[ readIndex & pTwccSpscManager->indexMask ] );
+
+            if( ( uint16_t ) ( lastSeqNum - pTwccPacketInfo->packetSeqNum ) < RTCP_TWCC_SEQ_NUM_HALF_RANGE )
+            {
+                readIndex += 1;
+            }
+            else
+            {
+                break;
             }
         }
+
+        RTCP_TWCC_ATOMIC_STORE_RELEASE( &( pTwccSpscManager->readIndex ),
+                                        readIndex );
     }
 
     return result;
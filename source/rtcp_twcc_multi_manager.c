@@ -0,0 +1,312 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "rtcp_twcc_multi_manager.h"
+
+/*-----------------------------------------------------------*/
+
+#define SESSION_HANDLE( index, generation ) \
+    ( ( ( ( RtcpTwccSessionHandle_t ) ( generation ) ) << 16 ) | ( RtcpTwccSessionHandle_t ) ( index ) )
+
+#define SESSION_HANDLE_INDEX( sessionHandle ) \
+    ( ( size_t ) ( ( sessionHandle ) & 0xFFFF ) )
+
+#define SESSION_HANDLE_GENERATION( sessionHandle ) \
+    ( ( uint16_t ) ( ( sessionHandle ) >> 16 ) )
+
+/* Terminates the free session list. */
+#define INVALID_SESSION_INDEX    0xFFFF
+
+/*-----------------------------------------------------------*/
+
+static RtcpTwccSession_t * GetSession( RtcpTwccMultiManager_t * pTwccMultiManager,
+                                       RtcpTwccSessionHandle_t sessionHandle )
+{
+    RtcpTwccSession_t * pSession = NULL;
+    size_t sessionIndex = SESSION_HANDLE_INDEX( sessionHandle );
+
+    if( ( sessionIndex < pTwccMultiManager->sessionArrayLength ) &&
+        ( pTwccMultiManager->pSessionArray[ sessionIndex ].inUse != 0 ) &&
+        ( pTwccMultiManager->pSessionArray[ sessionIndex ].generation == SESSION_HANDLE_GENERATION( sessionHandle ) ) )
+    {
+        pSession = &( pTwccMultiManager->pSessionArray[ sessionIndex ] );
+    }
+
+    return pSession;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccManagerResult_t RtcpTwccMultiManager_Init( RtcpTwccMultiManager_t * pTwccMultiManager,
+                                                   RtcpTwccSession_t * pSessionArray,
+                                                   size_t sessionArrayLength,
+                                                   TwccPacketInfo_t * pTwccPacketInfoSlab,
+                                                   size_t twccPacketInfoSlabLength,
+                                                   size_t twccPacketInfoArrayLength,
+                                                   uint32_t flags )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+    RtcpTwccManager_t twccManager;
+    size_t i;
+
+    if( ( pTwccMultiManager == NULL ) ||
+        ( pSessionArray == NULL ) ||
+        ( sessionArrayLength == 0 ) ||
+        ( sessionArrayLength > RTCP_TWCC_MULTI_MANAGER_MAX_SESSIONS ) ||
+        ( pTwccPacketInfoSlab == NULL ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    /* The slab must hold the history of every session. Dividing, rather
+     * than multiplying, cannot overflow. */
+    if( ( result == RTCP_TWCC_MANAGER_RESULT_OK ) &&
+        ( twccPacketInfoArrayLength > ( twccPacketInfoSlabLength / sessionArrayLength ) ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    /* Validate the history length and the flags once, so that opening a
+     * session cannot fail because of them. */
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                                pTwccPacketInfoSlab,
+                                                twccPacketInfoArrayLength,
+                                                flags );
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        pTwccMultiManager->pSessionArray = pSessionArray;
+        pTwccMultiManager->sessionArrayLength = sessionArrayLength;
+        pTwccMultiManager->pTwccPacketInfoSlab = pTwccPacketInfoSlab;
+        pTwccMultiManager->twccPacketInfoArrayLength = twccPacketInfoArrayLength;
+        pTwccMultiManager->flags = flags;
+        pTwccMultiManager->freeSessionIndex = 0;
+        pTwccMultiManager->openSessionCount = 0;
+
+        memset( pSessionArray,
+                0,
+                sizeof( RtcpTwccSession_t ) * sessionArrayLength );
+
+        for( i = 0; i < sessionArrayLength; i++ )
+        {
+            pSessionArray[ i ].nextFreeSessionIndex = ( i + 1 < sessionArrayLength ) ? ( uint16_t ) ( i + 1 ) :
+                                                                                      INVALID_SESSION_INDEX;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccManagerResult_t RtcpTwccMultiManager_OpenSession( RtcpTwccMultiManager_t * pTwccMultiManager,
+                                                          RtcpTwccSessionHandle_t * pSessionHandle )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+    RtcpTwccSession_t * pSession;
+    size_t sessionIndex;
+
+    if( ( pTwccMultiManager == NULL ) ||
+        ( pSessionHandle == NULL ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    if( ( result == RTCP_TWCC_MANAGER_RESULT_OK ) &&
+        ( pTwccMultiManager->freeSessionIndex == INVALID_SESSION_INDEX ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_FULL;
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        sessionIndex = pTwccMultiManager->freeSessionIndex;
+        pSession = &( pTwccMultiManager->pSessionArray[ sessionIndex ] );
+
+        result = RtcpTwccManager_InitWithFlags( &( pSession->twccManager ),
+                                                &( pTwccMultiManager->pTwccPacketInfoSlab[ sessionIndex * pTwccMultiManager->twccPacketInfoArrayLength ] ),
+                                                pTwccMultiManager->twccPacketInfoArrayLength,
+                                                pTwccMultiManager->flags );
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        pTwccMultiManager->freeSessionIndex = pSession->nextFreeSessionIndex;
+        pTwccMultiManager->openSessionCount += 1;
+        pSession->inUse = 1;
+
+        *pSessionHandle = SESSION_HANDLE( sessionIndex,
+                                          pSession->generation );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccManagerResult_t RtcpTwccMultiManager_CloseSession( RtcpTwccMultiManager_t * pTwccMultiManager,
+                                                           RtcpTwccSessionHandle_t sessionHandle )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+    RtcpTwccSession_t * pSession = NULL;
+
+    if( pTwccMultiManager == NULL )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        pSession = GetSession( pTwccMultiManager,
+                               sessionHandle );
+
+        if( pSession == NULL )
+        {
+            result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+        }
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        /* Invalidate the outstanding handles to this session. */
+        pSession->generation += 1;
+        pSession->inUse = 0;
+        pSession->nextFreeSessionIndex = ( uint16_t ) pTwccMultiManager->freeSessionIndex;
+
+        pTwccMultiManager->freeSessionIndex = SESSION_HANDLE_INDEX( sessionHandle );
+        pTwccMultiManager->openSessionCount -= 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccManagerResult_t RtcpTwccMultiManager_GetManager( RtcpTwccMultiManager_t * pTwccMultiManager,
+                                                         RtcpTwccSessionHandle_t sessionHandle,
+                                                         RtcpTwccManager_t ** ppTwccManager )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+    RtcpTwccSession_t * pSession = NULL;
+
+    if( ( pTwccMultiManager == NULL ) ||
+        ( ppTwccManager == NULL ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        pSession = GetSession( pTwccMultiManager,
+                               sessionHandle );
+
+        if( pSession == NULL )
+        {
+            result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+        }
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        *ppTwccManager = &( pSession->twccManager );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccManagerResult_t RtcpTwccMultiManager_AddPacketInfos( RtcpTwccMultiManager_t * pTwccMultiManager,
+                                                             const RtcpTwccSessionPacketInfo_t * pSessionPacketInfoArray,
+                                                             size_t sessionPacketInfoArrayLength )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK, addResult;
+    RtcpTwccSession_t * pSession;
+    size_t i;
+
+    if( ( pTwccMultiManager == NULL ) ||
+        ( ( pSessionPacketInfoArray == NULL ) && ( sessionPacketInfoArrayLength != 0 ) ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        for( i = 0; i < sessionPacketInfoArrayLength; i++ )
+        {
+            if( GetSession( pTwccMultiManager,
+                            pSessionPacketInfoArray[ i ].sessionHandle ) == NULL )
+            {
+                result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+                break;
+            }
+        }
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        for( i = 0; i < sessionPacketInfoArrayLength; i++ )
+        {
+            /* Handles were validated above. */
+            pSession = &( pTwccMultiManager->pSessionArray[ SESSION_HANDLE_INDEX( pSessionPacketInfoArray[ i ].sessionHandle ) ] );
+
+            addResult = RtcpTwccManager_AddPacketInfo( &( pSession->twccManager ),
+                                                       &( pSessionPacketInfoArray[ i ].twccPacketInfo ) );
+
+            /* The other packet infos are added regardless. */
+            if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+            {
+                result = addResult;
+            }
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccManagerResult_t RtcpTwccMultiManager_HandleTwccPackets( RtcpTwccMultiManager_t * pTwccMultiManager,
+                                                                RtcpTwccSessionTwccPacket_t * pSessionTwccPacketArray,
+                                                                size_t sessionTwccPacketArrayLength )
+{
+    RtcpTwccManagerResult_t result = RTCP_TWCC_MANAGER_RESULT_OK;
+    RtcpTwccSession_t * pSession;
+    RtcpTwccSessionTwccPacket_t * pSessionTwccPacket;
+    size_t i;
+
+    if( ( pTwccMultiManager == NULL ) ||
+        ( ( pSessionTwccPacketArray == NULL ) && ( sessionTwccPacketArrayLength != 0 ) ) )
+    {
+        result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        for( i = 0; i < sessionTwccPacketArrayLength; i++ )
+        {
+            pSessionTwccPacket = &( pSessionTwccPacketArray[ i ] );
+            pSession = GetSession( pTwccMultiManager,
+                                   pSessionTwccPacket->sessionHandle );
+
+            if( pSession == NULL )
+            {
+                pSessionTwccPacket->result = RTCP_TWCC_MANAGER_RESULT_BAD_PARAM;
+            }
+            else
+            {
+                pSessionTwccPacket->result = RtcpTwccManager_HandleTwccPacket( &( pSession->twccManager ),
+                                                                               pSessionTwccPacket->pTwccPacket,
+                                                                               &( pSessionTwccPacket->bandwidthInfo ) );
+            }
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,138 @@
+/* API includes. */
+#include "rtcp_twcc_recorder.h"
+
+/*-----------------------------------------------------------*/
+
+/* The reference time of a TWCC packet is in multiples of 64ms. */
+#define TWCC_REFERENCE_TIME_UNIT    ( ( uint64_t ) RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND * 64 / 1000 )
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccRecorderResult_t RtcpTwccRecorder_Init( RtcpTwccRecorder_t * pTwccRecorder,
+                                                PacketArrivalInfo_t * pArrivalInfoArray,
+                                                size_t arrivalInfoArrayLength )
+{
+    RtcpTwccRecorderResult_t result = RTCP_TWCC_RECORDER_RESULT_OK;
+
+    if( ( pTwccRecorder == NULL ) ||
+        ( pArrivalInfoArray == NULL ) ||
+        ( arrivalInfoArrayLength == 0 ) )
+    {
+        result = RTCP_TWCC_RECORDER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_TWCC_RECORDER_RESULT_OK )
+    {
+        pTwccRecorder->pArrivalInfoArray = pArrivalInfoArray;
+        pTwccRecorder->arrivalInfoArrayLength = arrivalInfoArrayLength;
+        pTwccRecorder->arrivalInfoCount = 0;
+        pTwccRecorder->baseSeqNum = 0;
+        pTwccRecorder->baseSeqNumValid = 0;
+        pTwccRecorder->feedbackPacketCount = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccRecorderResult_t RtcpTwccRecorder_RecordPacket( RtcpTwccRecorder_t * pTwccRecorder,
+                                                        uint16_t seqNum,
+                                                        uint64_t arrivalTime )
+{
+    RtcpTwccRecorderResult_t result = RTCP_TWCC_RECORDER_RESULT_OK;
+    size_t offset, i;
+
+    if( ( pTwccRecorder == NULL ) ||
+        ( arrivalTime == RTCP_TWCC_PACKET_LOST_TIME ) )
+    {
+        result = RTCP_TWCC_RECORDER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTCP_TWCC_RECORDER_RESULT_OK )
+    {
+        if( pTwccRecorder->baseSeqNumValid == 0 )
+        {
+            pTwccRecorder->baseSeqNum = seqNum;
+            pTwccRecorder->baseSeqNumValid = 1;
+        }
+
+        offset = ( uint16_t ) ( seqNum - pTwccRecorder->baseSeqNum );
+
+        if( offset >= 0x8000 )
+        {
+            /* More than half the range ahead is behind the base sequence
+             * number, already reported as not received. */
+        }
+        else if( offset >= pTwccRecorder->arrivalInfoArrayLength )
+        {
+            result = RTCP_TWCC_RECORDER_RESULT_FULL;
+        }
+        else
+        {
+            /* Packets skipped over are not received until they arrive. */
+            for( i = pTwccRecorder->arrivalInfoCount; i < offset; i++ )
+            {
+                pTwccRecorder->pArrivalInfoArray[ i ].seqNum = ( uint16_t ) ( pTwccRecorder->baseSeqNum + i );
+                pTwccRecorder->pArrivalInfoArray[ i ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+            }
+
+            if( offset >= pTwccRecorder->arrivalInfoCount )
+            {
+                pTwccRecorder->arrivalInfoCount = offset + 1;
+            }
+
+            pTwccRecorder->pArrivalInfoArray[ offset ].seqNum = seqNum;
+            pTwccRecorder->pArrivalInfoArray[ offset ].remoteArrivalTime = arrivalTime;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtcpTwccRecorderResult_t RtcpTwccRecorder_GetTwccPacket( RtcpTwccRecorder_t * pTwccRecorder,
+                                                         RtcpTwccPacket_t * pTwccPacket )
+{
+    RtcpTwccRecorderResult_t result = RTCP_TWCC_RECORDER_RESULT_OK;
+    size_t i = 0;
+
+    if( ( pTwccRecorder == NULL ) ||
+        ( pTwccPacket == NULL ) )
+    {
+        result = RTCP_TWCC_RECORDER_RESULT_BAD_PARAM;
+    }
+
+    if( ( result == RTCP_TWCC_RECORDER_RESULT_OK ) &&
+        ( pTwccRecorder->arrivalInfoCount == 0 ) )
+    {
+        result = RTCP_TWCC_RECORDER_RESULT_EMPTY;
+    }
+
+    if( result == RTCP_TWCC_RECORDER_RESULT_OK )
+    {
+        /* The last packet is always received. The reference time is that of
+         * the first received packet, rounded down, so that its receive delta
+         * is small. */
+        while( pTwccRecorder->pArrivalInfoArray[ i ].remoteArrivalTime == RTCP_TWCC_PACKET_LOST_TIME )
+        {
+            i++;
+        }
+
+        pTwccPacket->baseSeqNum = pTwccRecorder->baseSeqNum;
+        pTwccPacket->packetStatusCount = ( uint16_t ) pTwccRecorder->arrivalInfoCount;
+        pTwccPacket->referenceTime = ( uint32_t ) ( ( pTwccRecorder->pArrivalInfoArray[ i ].remoteArrivalTime / TWCC_REFERENCE_TIME_UNIT ) & 0xFFFFFF );
+        pTwccPacket->feedbackPacketCount = pTwccRecorder->feedbackPacketCount;
+        pTwccPacket->pArrivalInfoList = pTwccRecorder->pArrivalInfoArray;
+        pTwccPacket->arrivalInfoListLength = pTwccRecorder->arrivalInfoCount;
+
+        pTwccRecorder->baseSeqNum = ( uint16_t ) ( pTwccRecorder->baseSeqNum + pTwccRecorder->arrivalInfoCount );
+        pTwccRecorder->arrivalInfoCount = 0;
+        pTwccRecorder->feedbackPacketCount += 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
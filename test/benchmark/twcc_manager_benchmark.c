@@ -0,0 +1,161 @@
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* API includes. */
+#include "rtcp_twcc_manager.h"
+
+/*-----------------------------------------------------------*/
+
+#define TWCC_PACKET_INFO_ARRAY_LENGTH    4096
+#define NUM_PACKETS_TO_ADD               ( 1000 * 1000 )
+#define NUM_ARRIVALS_IN_FEEDBACK         500
+#define NUM_FEEDBACKS_TO_HANDLE          200
+
+/* 10k packets per second, in 100s of nanoseconds. */
+#define PACKET_SEND_INTERVAL             ( RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND / 10000 )
+
+/*-----------------------------------------------------------*/
+
+typedef struct BenchmarkConfig
+{
+    const char * pName;
+    uint32_t flags;
+    uint8_t compact;
+} BenchmarkConfig_t;
+
+static TwccPacketInfo_t twccPacketInfoArray[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
+static uint16_t seqNumArray[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
+static uint32_t relativeSentTimeArray[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
+static uint16_t packetSizeArray[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
+static PacketArrivalInfo_t arrivalInfoList[ NUM_ARRIVALS_IN_FEEDBACK ];
+
+/*-----------------------------------------------------------*/
+
+static uint64_t GetTimeNs( void )
+{
+    struct timespec now;
+
+    clock_gettime( CLOCK_MONOTONIC, &( now ) );
+
+    return ( ( uint64_t ) now.tv_sec * 1000000000ULL ) + ( uint64_t ) now.tv_nsec;
+}
+
+/*-----------------------------------------------------------*/
+
+static void RunBenchmark( const BenchmarkConfig_t * pConfig )
+{
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    TwccCompactPacketInfoArrays_t compactArrays;
+    RtcpTwccPacket_t twccPacket;
+    TwccPacketInfo_t packetInfo;
+    TwccBandwidthInfo_t bandwidthInfo;
+    uint64_t startNs, addNs, handleNs, receivedPackets = 0;
+    uint16_t firstSeqNum;
+    size_t i;
+
+    if( pConfig->compact != 0 )
+    {
+        compactArrays.pSeqNumArray = &( seqNumArray[ 0 ] );
+        compactArrays.pRelativeSentTimeArray = &( relativeSentTimeArray[ 0 ] );
+        compactArrays.pPacketSizeArray = &( packetSizeArray[ 0 ] );
+
+        result = RtcpTwccManager_InitCompact( &( twccManager ),
+                                              &( compactArrays ),
+                                              TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                              pConfig->flags );
+    }
+    else
+    {
+        result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                                &( twccPacketInfoArray[ 0 ] ),
+                                                TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                                pConfig->flags );
+    }
+
+    if( result != RTCP_TWCC_MANAGER_RESULT_OK )
+    {
+        printf( "%-40s init failed\n", pConfig->pName );
+        return;
+    }
+
+    packetInfo.packetSize = 1200;
+
+    startNs = GetTimeNs();
+
+    for( i = 0; i < NUM_PACKETS_TO_ADD; i++ )
+    {
+        packetInfo.packetSeqNum = ( uint16_t ) i;
+        packetInfo.localSentTime = RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND + ( i * PACKET_SEND_INTERVAL );
+        ( void ) RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                                &( packetInfo ) );
+    }
+
+    addNs = GetTimeNs() - startNs;
+
+    /* Feedback for the most recent packets. */
+    firstSeqNum = ( uint16_t ) ( NUM_PACKETS_TO_ADD - NUM_ARRIVALS_IN_FEEDBACK );
+
+    for( i = 0; i < NUM_ARRIVALS_IN_FEEDBACK; i++ )
+    {
+        arrivalInfoList[ i ].seqNum = ( uint16_t ) ( firstSeqNum + i );
+        arrivalInfoList[ i ].remoteArrivalTime = ( i % 10 == 0 ) ? RTCP_TWCC_PACKET_LOST_TIME : ( uint64_t ) i;
+    }
+
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+    twccPacket.arrivalInfoListLength = NUM_ARRIVALS_IN_FEEDBACK;
+
+    startNs = GetTimeNs();
+
+    for( i = 0; i < NUM_FEEDBACKS_TO_HANDLE; i++ )
+    {
+        ( void ) RtcpTwccManager_HandleTwccPacket( &( twccManager ),
+                                                   &( twccPacket ),
+                                                   &( bandwidthInfo ) );
+        receivedPackets += bandwidthInfo.receivedPackets;
+    }
+
+    handleNs = GetTimeNs() - startNs;
+
+    printf( "%-40s add: %8.2f ns/packet   handle: %10.2f ns/feedback (%llu received)\n",
+            pConfig->pName,
+            ( double ) addNs / NUM_PACKETS_TO_ADD,
+            ( double ) handleNs / NUM_FEEDBACKS_TO_HANDLE,
+            ( unsigned long long ) receivedPackets / NUM_FEEDBACKS_TO_HANDLE );
+}
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    size_t i;
+    const BenchmarkConfig_t configs[] =
+    {
+        { "linear",                                 RTCP_TWCC_MANAGER_FLAG_NONE,                                                             0 },
+        { "linear, power of two",                   RTCP_TWCC_MANAGER_FLAG_POWER_OF_TWO_LENGTH,                                              0 },
+        { "seq num indexed",                        RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED,                                                  0 },
+        { "seq num indexed, power of two",          RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED | RTCP_TWCC_MANAGER_FLAG_POWER_OF_TWO_LENGTH, 0 },
+        { "compact, power of two",                  RTCP_TWCC_MANAGER_FLAG_POWER_OF_TWO_LENGTH,                                              1 },
+        { "compact, seq num indexed, power of two", RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED | RTCP_TWCC_MANAGER_FLAG_POWER_OF_TWO_LENGTH, 1 },
+        { "seq num indexed, power of two, lazy",    RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED | RTCP_TWCC_MANAGER_FLAG_POWER_OF_TWO_LENGTH |
+                                                    RTCP_TWCC_MANAGER_FLAG_LAZY_EVICTION,                                                    0 },
+    };
+
+    printf( "TWCC manager: %d entries, %d packets added at 10k packets/s, %d feedbacks of %d arrivals.\n",
+            TWCC_PACKET_INFO_ARRAY_LENGTH,
+            NUM_PACKETS_TO_ADD,
+            NUM_FEEDBACKS_TO_HANDLE,
+            NUM_ARRIVALS_IN_FEEDBACK );
+
+    for( i = 0; i < sizeof( configs ) / sizeof( configs[ 0 ] ); i++ )
+    {
+        RunBenchmark( &( configs[ i ] ) );
+    }
+
+    return 0;
+}
+
+/*-----------------------------------------------------------*/
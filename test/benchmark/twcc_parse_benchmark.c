@@ -0,0 +1,448 @@
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* API includes. */
+#include "rtcp_api.h"
+
+/*-----------------------------------------------------------*/
+
+#define MAX_PACKET_STATUS_COUNT    2048
+#define MAX_PAYLOAD_LENGTH         ( 16 + ( 2 * MAX_PACKET_STATUS_COUNT ) + ( 2 * MAX_PACKET_STATUS_COUNT ) )
+#define NUM_PARSES                 20000
+
+#define STATUS_NOT_RECEIVED        0
+#define STATUS_SMALL_DELTA         1
+#define STATUS_LARGE_DELTA         2
+
+/*-----------------------------------------------------------*/
+
+typedef struct BenchmarkConfig
+{
+    const char * pName;
+    uint16_t packetStatusCount;
+    uint16_t lossInterval;       /* Every Nth packet is lost, 0 for none. */
+    uint16_t lossBurstLength;    /* Number of packets lost in a row. */
+    uint16_t largeDeltaInterval; /* Every Nth packet has a large delta, 0 for none. */
+} BenchmarkConfig_t;
+
+static uint8_t packetStatusArray[ MAX_PACKET_STATUS_COUNT ];
+static uint8_t payload[ MAX_PAYLOAD_LENGTH ];
+static PacketArrivalInfo_t arrivalInfoList[ MAX_PACKET_STATUS_COUNT ];
+static PacketArrivalInfo_t referenceArrivalInfoList[ MAX_PACKET_STATUS_COUNT ];
+static TwccPacketRun_t runList[ MAX_PACKET_STATUS_COUNT ];
+static uint64_t arrivalTimeList[ MAX_PACKET_STATUS_COUNT ];
+
+/*-----------------------------------------------------------*/
+
+static uint64_t GetTimeNs( void )
+{
+    struct timespec now;
+
+    clock_gettime( CLOCK_MONOTONIC, &( now ) );
+
+    return ( ( uint64_t ) now.tv_sec * 1000000000ULL ) + ( uint64_t ) now.tv_nsec;
+}
+
+/*-----------------------------------------------------------*/
+
+static void WriteUint16( uint8_t * pDst,
+                         uint16_t value )
+{
+    pDst[ 0 ] = ( uint8_t ) ( value >> 8 );
+    pDst[ 1 ] = ( uint8_t ) value;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Encodes a feedback the way a typical receiver does: run length chunks for
+ * runs of 7 or more identical statuses, status vector chunks otherwise. */
+static size_t BuildFeedback( const BenchmarkConfig_t * pConfig )
+{
+    size_t payloadLength = 16, numChunkBytes = 0, numDeltaBytes = 0, i, j, runLength, symbolCount;
+    uint16_t packetChunk;
+    uint8_t symbolSize;
+    static uint8_t deltas[ 2 * MAX_PACKET_STATUS_COUNT ];
+
+    for( i = 0; i < pConfig->packetStatusCount; i++ )
+    {
+        if( ( pConfig->lossInterval != 0 ) &&
+            ( ( i % pConfig->lossInterval ) < pConfig->lossBurstLength ) )
+        {
+            packetStatusArray[ i ] = STATUS_NOT_RECEIVED;
+        }
+        else if( ( pConfig->largeDeltaInterval != 0 ) &&
+                 ( ( i % pConfig->largeDeltaInterval ) == ( size_t ) ( pConfig->largeDeltaInterval - 1 ) ) )
+        {
+            packetStatusArray[ i ] = STATUS_LARGE_DELTA;
+        }
+        else
+        {
+            packetStatusArray[ i ] = STATUS_SMALL_DELTA;
+        }
+    }
+
+    memset( payload, 0, 16 );
+    WriteUint16( &( payload[ 8 ] ), 0xFF00 );                      /* Base sequence number. */
+    WriteUint16( &( payload[ 10 ] ), pConfig->packetStatusCount ); /* Packet status count. */
+    payload[ 14 ] = 0x01;                                          /* Reference time. */
+
+    i = 0;
+
+    while( i < pConfig->packetStatusCount )
+    {
+        runLength = 1;
+
+        while( ( i + runLength < pConfig->packetStatusCount ) &&
+               ( runLength < 0x1FFF ) &&
+               ( packetStatusArray[ i + runLength ] == packetStatusArray[ i ] ) )
+        {
+            runLength++;
+        }
+
+        if( runLength >= 7 )
+        {
+            packetChunk = ( uint16_t ) ( ( packetStatusArray[ i ] << 13 ) | runLength );
+            symbolCount = runLength;
+            symbolSize = 2;
+        }
+        else
+        {
+            symbolCount = ( pConfig->packetStatusCount - i < 14 ) ? pConfig->packetStatusCount - i : 14;
+            symbolSize = 1;
+
+            for( j = 0; j < symbolCount; j++ )
+            {
+                if( packetStatusArray[ i + j ] == STATUS_LARGE_DELTA )
+                {
+                    symbolSize = 2;
+                }
+            }
+
+            if( symbolSize == 1 )
+            {
+                packetChunk = 0x8000;
+            }
+            else
+            {
+                packetChunk = 0xC000;
+                symbolCount = ( symbolCount < 7 ) ? symbolCount : 7;
+            }
+
+            for( j = 0; j < symbolCount; j++ )
+            {
+                packetChunk |= ( uint16_t ) ( packetStatusArray[ i + j ] << ( 14 - ( ( j + 1 ) * symbolSize ) ) );
+            }
+        }
+
+        WriteUint16( &( payload[ payloadLength + numChunkBytes ] ), packetChunk );
+        numChunkBytes += 2;
+
+        for( j = 0; j < symbolCount; j++ )
+        {
+            if( packetStatusArray[ i + j ] == STATUS_SMALL_DELTA )
+            {
+                deltas[ numDeltaBytes ] = ( uint8_t ) ( 4 + ( ( i + j ) % 8 ) );
+                numDeltaBytes += 1;
+            }
+            else if( packetStatusArray[ i + j ] == STATUS_LARGE_DELTA )
+            {
+                WriteUint16( &( deltas[ numDeltaBytes ] ), 400 );
+                numDeltaBytes += 2;
+            }
+        }
+
+        i += symbolCount;
+    }
+
+    payloadLength += numChunkBytes;
+    memcpy( &( payload[ payloadLength ] ), deltas, numDeltaBytes );
+    payloadLength += numDeltaBytes;
+
+    return payloadLength;
+}
+
+/*-----------------------------------------------------------*/
+
+/* The two pass parser that Rtcp_ParseTwccPacket used to implement: the packet
+ * chunks are first scanned to find the receive deltas, and then decoded
+ * again one symbol at a time. */
+static RtcpResult_t ReferenceParseTwccPacket( RtcpContext_t * pCtx,
+                                              const RtcpPacket_t * pRtcpPacket,
+                                              RtcpTwccPacket_t * pTwccPacket )
+{
+    RtcpResult_t result = RTCP_RESULT_OK;
+    const uint8_t * pPayload = pRtcpPacket->pPayload;
+    size_t payloadLength = pRtcpPacket->payloadLength;
+    size_t chunkIndex, deltaIndex, numArrivalInfos = 0;
+    uint16_t packetsToParse, packetChunk, symbolCount, symbolSize, statusSymbol, runLength, i;
+    uint16_t remoteSeqNum, recvDelta;
+    uint64_t referenceTime, remoteArrivalTime = 0;
+
+    pTwccPacket->baseSeqNum = pCtx->readWriteFunctions.readUint16Fn( &( pPayload[ 8 ] ) );
+    pTwccPacket->packetStatusCount = pCtx->readWriteFunctions.readUint16Fn( &( pPayload[ 10 ] ) );
+    pTwccPacket->referenceTime = ( ( uint32_t ) pPayload[ 12 ] << 16 ) | ( ( uint32_t ) pPayload[ 13 ] << 8 ) | pPayload[ 14 ];
+
+    /* First pass - find the receive deltas. */
+    chunkIndex = 16;
+    packetsToParse = pTwccPacket->packetStatusCount;
+
+    while( ( packetsToParse > 0 ) && ( ( chunkIndex + 1 ) < payloadLength ) )
+    {
+        packetChunk = pCtx->readWriteFunctions.readUint16Fn( &( pPayload[ chunkIndex ] ) );
+        chunkIndex += 2;
+
+        if( ( packetChunk & 0x8000 ) == 0 )
+        {
+            packetsToParse -= packetChunk & 0x1FFF;
+        }
+        else
+        {
+            symbolCount = ( ( packetChunk & 0x4000 ) == 0 ) ? 14 : 7;
+            packetsToParse -= ( packetsToParse < symbolCount ) ? packetsToParse : symbolCount;
+        }
+    }
+
+    /* Second pass - decode. */
+    deltaIndex = chunkIndex;
+    chunkIndex = 16;
+    packetsToParse = pTwccPacket->packetStatusCount;
+    remoteSeqNum = pTwccPacket->baseSeqNum;
+    referenceTime = ( ( uint64_t ) pTwccPacket->referenceTime * 64 * 10000000 ) / 1000;
+
+    while( ( result == RTCP_RESULT_OK ) && ( packetsToParse > 0 ) && ( ( chunkIndex + 1 ) < payloadLength ) )
+    {
+        packetChunk = pCtx->readWriteFunctions.readUint16Fn( &( pPayload[ chunkIndex ] ) );
+        chunkIndex += 2;
+
+        if( ( packetChunk & 0x8000 ) == 0 )
+        {
+            runLength = packetChunk & 0x1FFF;
+            symbolSize = 0;
+        }
+        else
+        {
+            symbolSize = ( ( packetChunk & 0x4000 ) == 0 ) ? 1 : 2;
+            runLength = ( symbolSize == 1 ) ? 14 : 7;
+            runLength = ( packetsToParse < runLength ) ? packetsToParse : runLength;
+        }
+
+        for( i = 0; ( i < runLength ) && ( result == RTCP_RESULT_OK ); i++ )
+        {
+            if( symbolSize == 0 )
+            {
+                statusSymbol = ( packetChunk >> 13 ) & 3;
+            }
+            else
+            {
+                statusSymbol = ( packetChunk >> ( 14 - ( ( i + 1 ) * symbolSize ) ) ) & ( ( symbolSize == 1 ) ? 1 : 3 );
+            }
+
+            switch( statusSymbol )
+            {
+                case STATUS_NOT_RECEIVED:
+                    remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+                    break;
+
+                case STATUS_SMALL_DELTA:
+
+                    if( deltaIndex < payloadLength )
+                    {
+                        recvDelta = pPayload[ deltaIndex ];
+                        deltaIndex += 1;
+                        referenceTime += ( ( uint64_t ) recvDelta * 250 * 10000000 ) / 1000000;
+                        remoteArrivalTime = referenceTime;
+                    }
+                    else
+                    {
+                        result = RTCP_RESULT_MALFORMED_PACKET;
+                    }
+
+                    break;
+
+                case STATUS_LARGE_DELTA:
+
+                    if( ( deltaIndex + 1 ) < payloadLength )
+                    {
+                        recvDelta = pCtx->readWriteFunctions.readUint16Fn( &( pPayload[ deltaIndex ] ) );
+                        deltaIndex += 2;
+                        referenceTime += ( ( uint64_t ) recvDelta * 250 * 10000000 ) / 1000000;
+                        remoteArrivalTime = referenceTime;
+                    }
+                    else
+                    {
+                        result = RTCP_RESULT_MALFORMED_PACKET;
+                    }
+
+                    break;
+
+                default:
+                    break;
+            }
+
+            if( numArrivalInfos < pTwccPacket->arrivalInfoListLength )
+            {
+                pTwccPacket->pArrivalInfoList[ numArrivalInfos ].seqNum = remoteSeqNum;
+                pTwccPacket->pArrivalInfoList[ numArrivalInfos ].remoteArrivalTime = remoteArrivalTime;
+                numArrivalInfos += 1;
+            }
+            else
+            {
+                result = RTCP_RESULT_OUT_OF_MEMORY;
+            }
+
+            packetsToParse -= 1;
+            remoteSeqNum += 1;
+        }
+    }
+
+    pTwccPacket->arrivalInfoListLength = numArrivalInfos;
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void SumArrivalTimes( void * pUserData,
+                             const PacketArrivalInfo_t * pArrivalInfos,
+                             size_t arrivalInfosLength )
+{
+    uint64_t * pSum = ( uint64_t * ) pUserData;
+    size_t i;
+
+    for( i = 0; i < arrivalInfosLength; i++ )
+    {
+        *pSum += pArrivalInfos[ i ].remoteArrivalTime;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void RunBenchmark( const BenchmarkConfig_t * pConfig )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpTwccPacket_t twccPacket, referenceTwccPacket;
+    RtcpTwccRunsPacket_t twccRunsPacket;
+    RtcpResult_t result = RTCP_RESULT_OK, referenceResult = RTCP_RESULT_OK, runsResult = RTCP_RESULT_OK, visitResult = RTCP_RESULT_OK;
+    uint64_t startNs, parseNs, referenceNs, runsNs, visitNs, checksum = 0;
+    size_t i;
+
+    ( void ) Rtcp_Init( &( context ) );
+
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+    rtcpPacket.pPayload = &( payload[ 0 ] );
+    rtcpPacket.payloadLength = BuildFeedback( pConfig );
+
+    startNs = GetTimeNs();
+
+    for( i = 0; i < NUM_PARSES; i++ )
+    {
+        referenceTwccPacket.pArrivalInfoList = &( referenceArrivalInfoList[ 0 ] );
+        referenceTwccPacket.arrivalInfoListLength = MAX_PACKET_STATUS_COUNT;
+        referenceResult = ReferenceParseTwccPacket( &( context ),
+                                                    &( rtcpPacket ),
+                                                    &( referenceTwccPacket ) );
+        checksum += referenceTwccPacket.pArrivalInfoList[ i % pConfig->packetStatusCount ].remoteArrivalTime;
+    }
+
+    referenceNs = GetTimeNs() - startNs;
+
+    startNs = GetTimeNs();
+
+    for( i = 0; i < NUM_PARSES; i++ )
+    {
+        twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+        twccPacket.arrivalInfoListLength = MAX_PACKET_STATUS_COUNT;
+        result = Rtcp_ParseTwccPacket( &( context ),
+                                       &( rtcpPacket ),
+                                       &( twccPacket ) );
+        checksum += twccPacket.pArrivalInfoList[ i % pConfig->packetStatusCount ].remoteArrivalTime;
+    }
+
+    parseNs = GetTimeNs() - startNs;
+
+    startNs = GetTimeNs();
+
+    for( i = 0; i < NUM_PARSES; i++ )
+    {
+        twccRunsPacket.pRunList = &( runList[ 0 ] );
+        twccRunsPacket.runListLength = MAX_PACKET_STATUS_COUNT;
+        twccRunsPacket.pArrivalTimeList = &( arrivalTimeList[ 0 ] );
+        twccRunsPacket.arrivalTimeListLength = MAX_PACKET_STATUS_COUNT;
+        runsResult = Rtcp_ParseTwccPacketRuns( &( context ),
+                                               &( rtcpPacket ),
+                                               &( twccRunsPacket ) );
+        checksum += twccRunsPacket.runListLength;
+    }
+
+    runsNs = GetTimeNs() - startNs;
+
+    startNs = GetTimeNs();
+
+    for( i = 0; i < NUM_PARSES; i++ )
+    {
+        visitResult = Rtcp_VisitTwccPacket( &( context ),
+                                            &( rtcpPacket ),
+                                            &( twccPacket ),
+                                            SumArrivalTimes,
+                                            &( checksum ) );
+    }
+
+    visitNs = GetTimeNs() - startNs;
+
+    if( ( result != RTCP_RESULT_OK ) ||
+        ( referenceResult != RTCP_RESULT_OK ) ||
+        ( runsResult != RTCP_RESULT_OK ) ||
+        ( visitResult != RTCP_RESULT_OK ) ||
+        ( twccPacket.arrivalInfoListLength != referenceTwccPacket.arrivalInfoListLength ) ||
+        ( memcmp( arrivalInfoList,
+                  referenceArrivalInfoList,
+                  sizeof( PacketArrivalInfo_t ) * twccPacket.arrivalInfoListLength ) != 0 ) )
+    {
+        printf( "%-32s output mismatch\n", pConfig->pName );
+        return;
+    }
+
+    printf( "%-32s %4u packets %5u bytes   two pass: %8.1f ns   single pass: %8.1f ns   runs: %8.1f ns (%u runs)   visit: %8.1f ns   (%llu)\n",
+            pConfig->pName,
+            ( unsigned ) pConfig->packetStatusCount,
+            ( unsigned ) rtcpPacket.payloadLength,
+            ( double ) referenceNs / NUM_PARSES,
+            ( double ) parseNs / NUM_PARSES,
+            ( double ) runsNs / NUM_PARSES,
+            ( unsigned ) twccRunsPacket.runListLength,
+            ( double ) visitNs / NUM_PARSES,
+            ( unsigned long long ) ( checksum & 0xFF ) );
+}
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    size_t i;
+    const BenchmarkConfig_t configs[] =
+    {
+        { "no loss",                   50,   0,  0,  0   },
+        { "no loss",                   500,  0,  0,  0   },
+        { "1% loss",                   500,  100, 1, 0   },
+        { "5% loss, large deltas",     500,  20, 1,  50  },
+        { "burst loss, large deltas",  500,  50, 10, 25  },
+        { "1% loss",                   2000, 100, 1, 0   },
+        { "link drop",                 2000, 2000, 1800, 0 },
+    };
+
+    printf( "TWCC feedback parsing: %d parses per configuration.\n",
+            NUM_PARSES );
+
+    for( i = 0; i < sizeof( configs ) / sizeof( configs[ 0 ] ); i++ )
+    {
+        RunBenchmark( &( configs[ i ] ) );
+    }
+
+    return 0;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,680 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "rtcp_delay_based_estimator.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define HUNDREDS_OF_NANOS_IN_A_MS    10000
+#define PACKET_SIZE                  1000
+#define SEND_INTERVAL                ( 10 * HUNDREDS_OF_NANOS_IN_A_MS )
+
+/* 1000 bytes every 10 ms. */
+#define STEADY_BITRATE_BPS           800000
+
+RtcpDelayBasedEstimator_t estimator;
+uint64_t sentTime;
+uint64_t arrivalTime;
+
+void setUp( void )
+{
+    memset( &( estimator ),
+            0,
+            sizeof( RtcpDelayBasedEstimator_t ) );
+
+    sentTime = 1000 * HUNDREDS_OF_NANOS_IN_A_MS;
+    arrivalTime = 5000 * HUNDREDS_OF_NANOS_IN_A_MS;
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Helpers  ============================== */
+
+static void AddPackets( uint32_t numPackets,
+                        uint64_t sendInterval,
+                        uint64_t arrivalInterval )
+{
+    RtcpDelayBasedEstimatorResult_t result;
+    uint32_t i;
+
+    for( i = 0; i < numPackets; i++ )
+    {
+        sentTime += sendInterval;
+        arrivalTime += arrivalInterval;
+
+        result = RtcpDelayBasedEstimator_AddPacketFeedback( &( estimator ),
+                                                            sentTime,
+                                                            arrivalTime,
+                                                            PACKET_SIZE );
+
+        TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                           result );
+    }
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate Delay Based Estimator functionality for Bad Parameters.
+ */
+void test_delayBasedEstimator_BadParams( void )
+{
+    RtcpDelayBasedEstimatorResult_t result;
+    uint32_t targetBitrateBps;
+
+    result = RtcpDelayBasedEstimator_Init( NULL,
+                                           1000000,
+                                           100000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+
+    /* Min bitrate greater than max bitrate. */
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           1000000,
+                                           2000000,
+                                           100000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+
+    /* Initial bitrate less than min bitrate. */
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           10000,
+                                           100000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+
+    /* Initial bitrate greater than max bitrate. */
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           3000000,
+                                           100000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpDelayBasedEstimator_AddPacketFeedback( NULL,
+                                                        sentTime,
+                                                        arrivalTime,
+                                                        PACKET_SIZE );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpDelayBasedEstimator_GetTargetBitrate( NULL,
+                                                       &( targetBitrateBps ) );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpDelayBasedEstimator_GetTargetBitrate( &( estimator ),
+                                                       NULL );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Delay Based Estimator init functionality.
+ */
+void test_delayBasedEstimator_Init( void )
+{
+    RtcpDelayBasedEstimatorResult_t result;
+    uint32_t targetBitrateBps;
+
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           1000000,
+                                           100000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    result = RtcpDelayBasedEstimator_GetTargetBitrate( &( estimator ),
+                                                       &( targetBitrateBps ) );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1000000,
+                       targetBitrateBps );
+    TEST_ASSERT_EQUAL( RTCP_BANDWIDTH_USAGE_NORMAL,
+                       estimator.bandwidthUsage );
+    TEST_ASSERT_EQUAL( RTCP_RATE_CONTROL_STATE_HOLD,
+                       estimator.rateControlState );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that packets sent within a burst are grouped together and
+ * reordered packets are ignored.
+ */
+void test_delayBasedEstimator_PacketGroups( void )
+{
+    RtcpDelayBasedEstimatorResult_t result;
+
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           1000000,
+                                           100000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    /* 5 packets, 1 ms apart. */
+    AddPackets( 5,
+                HUNDREDS_OF_NANOS_IN_A_MS,
+                HUNDREDS_OF_NANOS_IN_A_MS );
+
+    TEST_ASSERT_EQUAL( 1,
+                       estimator.currentGroupValid );
+    TEST_ASSERT_EQUAL( 0,
+                       estimator.previousGroupValid );
+    TEST_ASSERT_EQUAL( 5 * PACKET_SIZE,
+                       estimator.currentGroup.size );
+    TEST_ASSERT_EQUAL_UINT64( sentTime,
+                              estimator.currentGroup.lastSentTime );
+
+    /* A packet sent at the same time as the last one. */
+    AddPackets( 1,
+                0,
+                HUNDREDS_OF_NANOS_IN_A_MS );
+
+    TEST_ASSERT_EQUAL( 6 * PACKET_SIZE,
+                       estimator.currentGroup.size );
+    TEST_ASSERT_EQUAL_UINT64( arrivalTime,
+                              estimator.currentGroup.lastArrivalTime );
+
+    /* A reordered packet sent before the current group. */
+    result = RtcpDelayBasedEstimator_AddPacketFeedback( &( estimator ),
+                                                        estimator.currentGroup.firstSentTime - 1,
+                                                        arrivalTime,
+                                                        PACKET_SIZE );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 6 * PACKET_SIZE,
+                       estimator.currentGroup.size );
+
+    /* Packet outside of the burst starts a new group. */
+    AddPackets( 1,
+                SEND_INTERVAL,
+                SEND_INTERVAL );
+
+    TEST_ASSERT_EQUAL( 1,
+                       estimator.previousGroupValid );
+    TEST_ASSERT_EQUAL( 6 * PACKET_SIZE,
+                       estimator.previousGroup.size );
+    TEST_ASSERT_EQUAL( PACKET_SIZE,
+                       estimator.currentGroup.size );
+    TEST_ASSERT_EQUAL( 0,
+                       estimator.numDeltas );
+
+    /* The second group boundary produces the first delta. */
+    AddPackets( 1,
+                SEND_INTERVAL,
+                SEND_INTERVAL );
+
+    TEST_ASSERT_EQUAL( 1,
+                       estimator.numDeltas );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the target bitrate increases on a stable network but
+ * not beyond what the network delivers.
+ */
+void test_delayBasedEstimator_Increase( void )
+{
+    RtcpDelayBasedEstimatorResult_t result;
+    uint32_t targetBitrateBps;
+
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           1000000,
+                                           100000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    /* 500 ms of constant delay, before any acknowledged bitrate. */
+    AddPackets( 49,
+                SEND_INTERVAL,
+                SEND_INTERVAL );
+
+    TEST_ASSERT_EQUAL( 0,
+                       estimator.ackedBitrateBps );
+    TEST_ASSERT_EQUAL( RTCP_BANDWIDTH_USAGE_NORMAL,
+                       estimator.bandwidthUsage );
+    TEST_ASSERT_EQUAL( RTCP_RATE_CONTROL_STATE_INCREASE,
+                       estimator.rateControlState );
+    TEST_ASSERT_GREATER_THAN( 1000000,
+                              estimator.targetBitrateBps );
+
+    /* 10 seconds of constant delay. */
+    AddPackets( 1000,
+                SEND_INTERVAL,
+                SEND_INTERVAL );
+
+    TEST_ASSERT_EQUAL( STEADY_BITRATE_BPS,
+                       estimator.ackedBitrateBps );
+    TEST_ASSERT_EQUAL( RTCP_BANDWIDTH_USAGE_NORMAL,
+                       estimator.bandwidthUsage );
+
+    result = RtcpDelayBasedEstimator_GetTargetBitrate( &( estimator ),
+                                                       &( targetBitrateBps ) );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( ( 15 * STEADY_BITRATE_BPS / 10 ) + 10000,
+                       targetBitrateBps );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the target bitrate is not reduced by the acknowledged
+ * bitrate bound alone, and is capped at the max bitrate.
+ */
+void test_delayBasedEstimator_IncreaseAboveAckedBitrate( void )
+{
+    RtcpDelayBasedEstimatorResult_t result;
+
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           1950000,
+                                           100000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    AddPackets( 1000,
+                SEND_INTERVAL,
+                SEND_INTERVAL );
+
+    TEST_ASSERT_EQUAL( STEADY_BITRATE_BPS,
+                       estimator.ackedBitrateBps );
+    TEST_ASSERT_EQUAL( 2000000,
+                       estimator.targetBitrateBps );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that growing queuing delay is detected as overuse and the
+ * target bitrate is reduced below the acknowledged bitrate.
+ */
+void test_delayBasedEstimator_Overuse( void )
+{
+    RtcpDelayBasedEstimatorResult_t result;
+
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           1000000,
+                                           100000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    AddPackets( 200,
+                SEND_INTERVAL,
+                SEND_INTERVAL );
+
+    TEST_ASSERT_EQUAL( RTCP_BANDWIDTH_USAGE_NORMAL,
+                       estimator.bandwidthUsage );
+
+    /* Each packet is delayed by 2 ms more than the previous one. */
+    AddPackets( 60,
+                SEND_INTERVAL,
+                SEND_INTERVAL + ( 2 * HUNDREDS_OF_NANOS_IN_A_MS ) );
+
+    TEST_ASSERT_EQUAL( RTCP_BANDWIDTH_USAGE_OVERUSING,
+                       estimator.bandwidthUsage );
+    TEST_ASSERT_EQUAL( RTCP_RATE_CONTROL_STATE_HOLD,
+                       estimator.rateControlState );
+    TEST_ASSERT_LESS_THAN( STEADY_BITRATE_BPS,
+                           estimator.targetBitrateBps );
+    TEST_ASSERT_GREATER_THAN( STEADY_BITRATE_BPS / 2,
+                              estimator.targetBitrateBps );
+
+    /* Queuing delay keeps growing, but slower. */
+    AddPackets( 20,
+                SEND_INTERVAL,
+                SEND_INTERVAL + ( HUNDREDS_OF_NANOS_IN_A_MS / 2 ) );
+
+    TEST_ASSERT_LESS_THAN( STEADY_BITRATE_BPS,
+                           estimator.targetBitrateBps );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate overuse detection when packets are sent far apart.
+ */
+void test_delayBasedEstimator_OveruseLongSendInterval( void )
+{
+    RtcpDelayBasedEstimatorResult_t result;
+
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           1000000,
+                                           100000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    AddPackets( 30,
+                3 * SEND_INTERVAL,
+                3 * SEND_INTERVAL );
+
+    /* Each packet is delayed by 5 ms more than the previous one. */
+    AddPackets( 30,
+                3 * SEND_INTERVAL,
+                ( 3 * SEND_INTERVAL ) + ( 5 * HUNDREDS_OF_NANOS_IN_A_MS ) );
+
+    TEST_ASSERT_EQUAL( RTCP_BANDWIDTH_USAGE_OVERUSING,
+                       estimator.bandwidthUsage );
+    TEST_ASSERT_LESS_THAN( 1000000,
+                           estimator.targetBitrateBps );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate overuse detection before any acknowledged bitrate is
+ * available, and the min bitrate bound.
+ */
+void test_delayBasedEstimator_OveruseNoAckedBitrate( void )
+{
+    RtcpDelayBasedEstimatorResult_t result;
+
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           1000000,
+                                           900000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    /* Each packet is delayed by 4 ms more than the previous one. */
+    AddPackets( 30,
+                SEND_INTERVAL,
+                SEND_INTERVAL + ( 4 * HUNDREDS_OF_NANOS_IN_A_MS ) );
+
+    TEST_ASSERT_EQUAL( 0,
+                       estimator.ackedBitrateBps );
+    TEST_ASSERT_EQUAL( RTCP_BANDWIDTH_USAGE_OVERUSING,
+                       estimator.bandwidthUsage );
+    TEST_ASSERT_EQUAL( 900000,
+                       estimator.targetBitrateBps );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the target bitrate is never increased on overuse.
+ */
+void test_delayBasedEstimator_OveruseAboveTargetBitrate( void )
+{
+    RtcpDelayBasedEstimatorResult_t result;
+    uint32_t targetBitrateBps;
+
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           200000,
+                                           100000,
+                                           210000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    AddPackets( 200,
+                SEND_INTERVAL,
+                SEND_INTERVAL );
+
+    targetBitrateBps = estimator.targetBitrateBps;
+
+    TEST_ASSERT_EQUAL( 210000,
+                       targetBitrateBps );
+
+    AddPackets( 60,
+                SEND_INTERVAL,
+                SEND_INTERVAL + ( 2 * HUNDREDS_OF_NANOS_IN_A_MS ) );
+
+    TEST_ASSERT_EQUAL( RTCP_BANDWIDTH_USAGE_OVERUSING,
+                       estimator.bandwidthUsage );
+    TEST_ASSERT_EQUAL( targetBitrateBps,
+                       estimator.targetBitrateBps );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that shrinking queuing delay is detected as underuse and the
+ * target bitrate is held.
+ */
+void test_delayBasedEstimator_Underuse( void )
+{
+    RtcpDelayBasedEstimatorResult_t result;
+    uint32_t targetBitrateBps;
+
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           1000000,
+                                           100000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    AddPackets( 100,
+                SEND_INTERVAL,
+                SEND_INTERVAL );
+
+    /* Each packet is delayed by 2 ms less than the previous one. */
+    AddPackets( 30,
+                SEND_INTERVAL,
+                SEND_INTERVAL - ( 2 * HUNDREDS_OF_NANOS_IN_A_MS ) );
+
+    TEST_ASSERT_EQUAL( RTCP_BANDWIDTH_USAGE_UNDERUSING,
+                       estimator.bandwidthUsage );
+    TEST_ASSERT_EQUAL( RTCP_RATE_CONTROL_STATE_HOLD,
+                       estimator.rateControlState );
+
+    targetBitrateBps = estimator.targetBitrateBps;
+
+    AddPackets( 10,
+                SEND_INTERVAL,
+                SEND_INTERVAL - ( 2 * HUNDREDS_OF_NANOS_IN_A_MS ) );
+
+    TEST_ASSERT_EQUAL( targetBitrateBps,
+                       estimator.targetBitrateBps );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the estimator with packets which arrive at the same time
+ * and with long pauses in between.
+ */
+void test_delayBasedEstimator_ArrivalTimeEdgeCases( void )
+{
+    RtcpDelayBasedEstimatorResult_t result;
+    uint32_t targetBitrateBps;
+
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           1000000,
+                                           100000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    /* All packets are received at the same time (i.e. delivered in one
+     * batch), the trend can not be calculated. */
+    AddPackets( 30,
+                SEND_INTERVAL,
+                0 );
+
+    TEST_ASSERT_EQUAL( 0,
+                       estimator.ackedBitrateBps );
+    TEST_ASSERT_EQUAL_INT64( 0,
+                             estimator.trend );
+
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           1000000,
+                                           100000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    AddPackets( 100,
+                SEND_INTERVAL,
+                SEND_INTERVAL );
+
+    targetBitrateBps = estimator.targetBitrateBps;
+
+    /* Long pause in sending. */
+    AddPackets( 3,
+                5000 * HUNDREDS_OF_NANOS_IN_A_MS,
+                5000 * HUNDREDS_OF_NANOS_IN_A_MS );
+
+    /* The acknowledged bitrate dropped during the pause, so the target
+     * bitrate is held. */
+    TEST_ASSERT_LESS_THAN( STEADY_BITRATE_BPS / 10,
+                           estimator.ackedBitrateBps );
+    TEST_ASSERT_EQUAL( targetBitrateBps,
+                       estimator.targetBitrateBps );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the target bitrate increases by a minimum amount at
+ * very low bitrates.
+ */
+void test_delayBasedEstimator_IncreaseLowBitrate( void )
+{
+    RtcpDelayBasedEstimatorResult_t result;
+
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           10000,
+                                           1000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    /* One second of constant delay. */
+    AddPackets( 102,
+                SEND_INTERVAL,
+                SEND_INTERVAL );
+
+    TEST_ASSERT_GREATER_THAN( 10000 + 900,
+                              estimator.targetBitrateBps );
+    TEST_ASSERT_LESS_THAN( 10000 + 1100,
+                           estimator.targetBitrateBps );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the bounds of the adaptive overuse threshold.
+ */
+void test_delayBasedEstimator_ThresholdBounds( void )
+{
+    RtcpDelayBasedEstimatorResult_t result;
+
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           1000000,
+                                           100000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    /* Threshold decreases to the minimum on a stable network. */
+    AddPackets( 50,
+                SEND_INTERVAL,
+                SEND_INTERVAL );
+
+    TEST_ASSERT_EQUAL_INT64( 6 * 65536,
+                             estimator.threshold );
+
+    /* A sudden drop in delay (e.g. a route change) does not move the
+     * threshold. */
+    AddPackets( 2,
+                1000 * HUNDREDS_OF_NANOS_IN_A_MS,
+                SEND_INTERVAL );
+
+    TEST_ASSERT_EQUAL_INT64( 6 * 65536,
+                             estimator.threshold );
+
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           1000000,
+                                           100000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    AddPackets( 50,
+                SEND_INTERVAL,
+                SEND_INTERVAL );
+
+    /* Threshold above the maximum is brought back within bounds. */
+    estimator.threshold = 1000 * 65536;
+    estimator.lastThresholdUpdateTime = arrivalTime;
+
+    AddPackets( 1,
+                SEND_INTERVAL,
+                SEND_INTERVAL );
+
+    TEST_ASSERT_EQUAL_INT64( 600 * 65536,
+                             estimator.threshold );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the fixed point trend of a constant growth of the queuing
+ * delay.
+ */
+void test_delayBasedEstimator_Trend( void )
+{
+    RtcpDelayBasedEstimatorResult_t result;
+
+    result = RtcpDelayBasedEstimator_Init( &( estimator ),
+                                           1000000,
+                                           100000,
+                                           2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    /* Each packet is delayed by 1 ms more than the previous one. */
+    AddPackets( 100,
+                SEND_INTERVAL,
+                SEND_INTERVAL + HUNDREDS_OF_NANOS_IN_A_MS );
+
+    /* The delay grows by 1 ms every 11 ms of arrival time, i.e. a trend of
+     * 1 / 11 in Q16 once the smoothing has caught up with the growth. */
+    TEST_ASSERT_GREATER_THAN( ( 65536 / 11 ) - 16,
+                              estimator.trend );
+    TEST_ASSERT_LESS_THAN( ( 65536 / 11 ) + 16,
+                           estimator.trend );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,441 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "rtcp_loss_based_estimator.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define HUNDREDS_OF_NANOS_IN_A_MS          10000
+#define ARRIVAL_INFO_LIST_LENGTH           500
+
+RtcpLossBasedEstimator_t estimator;
+PacketArrivalInfo_t arrivalInfoList[ ARRIVAL_INFO_LIST_LENGTH ];
+RtcpTwccPacket_t twccPacket;
+
+void setUp( void )
+{
+    size_t i;
+
+    memset( &( estimator ),
+            0,
+            sizeof( RtcpLossBasedEstimator_t ) );
+
+    for( i = 0; i < ARRIVAL_INFO_LIST_LENGTH; i++ )
+    {
+        arrivalInfoList[ i ].seqNum = ( uint16_t ) i;
+        arrivalInfoList[ i ].remoteArrivalTime = ( uint64_t ) ( i + 1 ) * HUNDREDS_OF_NANOS_IN_A_MS;
+    }
+
+    memset( &( twccPacket ),
+            0,
+            sizeof( RtcpTwccPacket_t ) );
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+    twccPacket.arrivalInfoListLength = ARRIVAL_INFO_LIST_LENGTH;
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate Loss Based Estimator functionality for Bad Parameters.
+ */
+void test_lossBasedEstimator_BadParams( void )
+{
+    RtcpLossBasedEstimatorResult_t result;
+    RtcpReceptionReport_t receptionReport = { 0 };
+    uint32_t targetBitrateBps;
+
+    result = RtcpLossBasedEstimator_Init( NULL,
+                                          1000000,
+                                          100000,
+                                          2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+
+    /* Min bitrate greater than max bitrate. */
+    result = RtcpLossBasedEstimator_Init( &( estimator ),
+                                          1000000,
+                                          2000000,
+                                          100000 );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+
+    /* Initial bitrate less than min bitrate. */
+    result = RtcpLossBasedEstimator_Init( &( estimator ),
+                                          10000,
+                                          100000,
+                                          2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+
+    /* Initial bitrate greater than max bitrate. */
+    result = RtcpLossBasedEstimator_Init( &( estimator ),
+                                          3000000,
+                                          100000,
+                                          2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpLossBasedEstimator_AddTwccPacket( NULL,
+                                                   &( twccPacket ),
+                                                   0 );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpLossBasedEstimator_AddTwccPacket( &( estimator ),
+                                                   NULL,
+                                                   0 );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+
+    twccPacket.pArrivalInfoList = NULL;
+
+    result = RtcpLossBasedEstimator_AddTwccPacket( &( estimator ),
+                                                   &( twccPacket ),
+                                                   0 );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpLossBasedEstimator_AddReceptionReport( NULL,
+                                                        &( receptionReport ),
+                                                        0 );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpLossBasedEstimator_AddReceptionReport( &( estimator ),
+                                                        NULL,
+                                                        0 );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpLossBasedEstimator_GetTargetBitrate( NULL,
+                                                      &( targetBitrateBps ) );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpLossBasedEstimator_GetTargetBitrate( &( estimator ),
+                                                      NULL );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the target bitrate increases at most once per increase
+ * interval when the loss is low.
+ */
+void test_lossBasedEstimator_LowLoss( void )
+{
+    RtcpLossBasedEstimatorResult_t result;
+    uint32_t targetBitrateBps;
+
+    result = RtcpLossBasedEstimator_Init( &( estimator ),
+                                          1000000,
+                                          100000,
+                                          2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    /* 1 packet lost out of 100. */
+    twccPacket.arrivalInfoListLength = 100;
+    arrivalInfoList[ 50 ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+
+    result = RtcpLossBasedEstimator_AddTwccPacket( &( estimator ),
+                                                   &( twccPacket ),
+                                                   1000 * HUNDREDS_OF_NANOS_IN_A_MS );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       estimator.fractionLost );
+    TEST_ASSERT_EQUAL( 1,
+                       estimator.longestLostRun );
+
+    result = RtcpLossBasedEstimator_GetTargetBitrate( &( estimator ),
+                                                      &( targetBitrateBps ) );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1081000,
+                       targetBitrateBps );
+
+    /* Too soon for another increase. */
+    result = RtcpLossBasedEstimator_AddTwccPacket( &( estimator ),
+                                                   &( twccPacket ),
+                                                   1500 * HUNDREDS_OF_NANOS_IN_A_MS );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1081000,
+                       estimator.targetBitrateBps );
+
+    /* Time went backwards. */
+    result = RtcpLossBasedEstimator_AddTwccPacket( &( estimator ),
+                                                   &( twccPacket ),
+                                                   500 * HUNDREDS_OF_NANOS_IN_A_MS );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1081000,
+                       estimator.targetBitrateBps );
+
+    /* An empty TWCC packet carries no loss sample. */
+    twccPacket.arrivalInfoListLength = 0;
+
+    result = RtcpLossBasedEstimator_AddTwccPacket( &( estimator ),
+                                                   &( twccPacket ),
+                                                   2000 * HUNDREDS_OF_NANOS_IN_A_MS );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1081000,
+                       estimator.targetBitrateBps );
+
+    twccPacket.pArrivalInfoList = NULL;
+
+    result = RtcpLossBasedEstimator_AddTwccPacket( &( estimator ),
+                                                   &( twccPacket ),
+                                                   2000 * HUNDREDS_OF_NANOS_IN_A_MS );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1081000,
+                       estimator.targetBitrateBps );
+
+    /* No loss in a reception report. */
+    result = RtcpLossBasedEstimator_AddReceptionReport( &( estimator ),
+                                                        &( ( RtcpReceptionReport_t ) { 0 } ),
+                                                        2000 * HUNDREDS_OF_NANOS_IN_A_MS );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       estimator.fractionLost );
+    TEST_ASSERT_EQUAL( 1168480,
+                       estimator.targetBitrateBps );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a burst of lost packets prevents an increase even when
+ * the overall loss is low.
+ */
+void test_lossBasedEstimator_BurstLoss( void )
+{
+    RtcpLossBasedEstimatorResult_t result;
+    size_t i;
+
+    result = RtcpLossBasedEstimator_Init( &( estimator ),
+                                          1000000,
+                                          100000,
+                                          2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    /* 8 packets lost out of 500, scattered. */
+    for( i = 0; i < RTCP_LOSS_BASED_ESTIMATOR_BURST_LOSS_RUN_LENGTH; i++ )
+    {
+        arrivalInfoList[ i * 10 ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+    }
+
+    result = RtcpLossBasedEstimator_AddTwccPacket( &( estimator ),
+                                                   &( twccPacket ),
+                                                   1000 * HUNDREDS_OF_NANOS_IN_A_MS );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 4,
+                       estimator.fractionLost );
+    TEST_ASSERT_EQUAL( 1,
+                       estimator.longestLostRun );
+    TEST_ASSERT_EQUAL( 1081000,
+                       estimator.targetBitrateBps );
+
+    /* 8 packets lost out of 500, in a row. */
+    setUp();
+    result = RtcpLossBasedEstimator_Init( &( estimator ),
+                                          1000000,
+                                          100000,
+                                          2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    for( i = 0; i < RTCP_LOSS_BASED_ESTIMATOR_BURST_LOSS_RUN_LENGTH; i++ )
+    {
+        arrivalInfoList[ 100 + i ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+    }
+
+    result = RtcpLossBasedEstimator_AddTwccPacket( &( estimator ),
+                                                   &( twccPacket ),
+                                                   1000 * HUNDREDS_OF_NANOS_IN_A_MS );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 4,
+                       estimator.fractionLost );
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_BURST_LOSS_RUN_LENGTH,
+                       estimator.longestLostRun );
+    TEST_ASSERT_EQUAL( 1000000,
+                       estimator.targetBitrateBps );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the target bitrate is held when the loss is moderate.
+ */
+void test_lossBasedEstimator_ModerateLoss( void )
+{
+    RtcpLossBasedEstimatorResult_t result;
+    RtcpReceptionReport_t receptionReport = { 0 };
+
+    result = RtcpLossBasedEstimator_Init( &( estimator ),
+                                          1000000,
+                                          100000,
+                                          2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    /* ~5% loss. */
+    receptionReport.fractionLost = 13;
+
+    result = RtcpLossBasedEstimator_AddReceptionReport( &( estimator ),
+                                                        &( receptionReport ),
+                                                        1000 * HUNDREDS_OF_NANOS_IN_A_MS );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 13,
+                       estimator.fractionLost );
+    TEST_ASSERT_EQUAL( 1000000,
+                       estimator.targetBitrateBps );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the target bitrate decreases at most once per decrease
+ * interval when the loss is high.
+ */
+void test_lossBasedEstimator_HighLoss( void )
+{
+    RtcpLossBasedEstimatorResult_t result;
+    RtcpReceptionReport_t receptionReport = { 0 };
+
+    result = RtcpLossBasedEstimator_Init( &( estimator ),
+                                          1000000,
+                                          100000,
+                                          2000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    /* 25% loss. */
+    receptionReport.fractionLost = 64;
+
+    result = RtcpLossBasedEstimator_AddReceptionReport( &( estimator ),
+                                                        &( receptionReport ),
+                                                        1000 * HUNDREDS_OF_NANOS_IN_A_MS );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 875000,
+                       estimator.targetBitrateBps );
+
+    /* Too soon for another decrease. */
+    result = RtcpLossBasedEstimator_AddReceptionReport( &( estimator ),
+                                                        &( receptionReport ),
+                                                        1200 * HUNDREDS_OF_NANOS_IN_A_MS );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 875000,
+                       estimator.targetBitrateBps );
+
+    /* All the packets in a TWCC packet are lost. */
+    twccPacket.arrivalInfoListLength = 4;
+    arrivalInfoList[ 0 ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+    arrivalInfoList[ 1 ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+    arrivalInfoList[ 2 ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+    arrivalInfoList[ 3 ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+
+    result = RtcpLossBasedEstimator_AddTwccPacket( &( estimator ),
+                                                   &( twccPacket ),
+                                                   1300 * HUNDREDS_OF_NANOS_IN_A_MS );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 255,
+                       estimator.fractionLost );
+    TEST_ASSERT_EQUAL( 4,
+                       estimator.longestLostRun );
+    /* 875000 * ( 512 - 255 ) / 512. */
+    TEST_ASSERT_EQUAL( 439208,
+                       estimator.targetBitrateBps );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the target bitrate stays within the min and max
+ * bitrate.
+ */
+void test_lossBasedEstimator_Bounds( void )
+{
+    RtcpLossBasedEstimatorResult_t result;
+    RtcpReceptionReport_t receptionReport = { 0 };
+
+    result = RtcpLossBasedEstimator_Init( &( estimator ),
+                                          1000000,
+                                          900000,
+                                          1050000 );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+
+    result = RtcpLossBasedEstimator_AddReceptionReport( &( estimator ),
+                                                        &( receptionReport ),
+                                                        1000 * HUNDREDS_OF_NANOS_IN_A_MS );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1050000,
+                       estimator.targetBitrateBps );
+
+    receptionReport.fractionLost = 128;
+
+    result = RtcpLossBasedEstimator_AddReceptionReport( &( estimator ),
+                                                        &( receptionReport ),
+                                                        2000 * HUNDREDS_OF_NANOS_IN_A_MS );
+
+    TEST_ASSERT_EQUAL( RTCP_LOSS_BASED_ESTIMATOR_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 900000,
+                       estimator.targetBitrateBps );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,415 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* API includes. */
+#include "rtcp_api.h"
+#include "rtcp_nack_generator.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define RECEIVED_BITMAP_LENGTH     4
+#define LOST_PACKET_ARRAY_LENGTH   64
+#define MILLISECONDS               10000ULL
+
+RtcpNackGenerator_t nackGenerator;
+uint32_t receivedBitmap[ RECEIVED_BITMAP_LENGTH ];
+RtcpNackGeneratorLostPacket_t lostPacketArray[ LOST_PACKET_ARRAY_LENGTH ];
+uint16_t seqNumList[ 64 ];
+RtcpNackPacket_t nackPacket;
+
+void setUp( void )
+{
+    RtcpNackGeneratorResult_t result;
+
+    result = RtcpNackGenerator_Init( &( nackGenerator ),
+                                     &( receivedBitmap[ 0 ] ),
+                                     RECEIVED_BITMAP_LENGTH,
+                                     &( lostPacketArray[ 0 ] ),
+                                     LOST_PACKET_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       result );
+}
+
+void tearDown( void )
+{
+}
+
+static void RecordPackets( const uint16_t * pSeqNums,
+                           size_t seqNumsLength )
+{
+    size_t i;
+
+    for( i = 0; i < seqNumsLength; i++ )
+    {
+        TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                           RtcpNackGenerator_RecordPacket( &( nackGenerator ),
+                                                           pSeqNums[ i ] ) );
+    }
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate NACK Generator fail functionality for Bad Parameters.
+ */
+void test_nackGenerator_BadParams( void )
+{
+    RtcpNackGenerator_t badNackGenerator;
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_BAD_PARAM,
+                       RtcpNackGenerator_Init( NULL, &( receivedBitmap[ 0 ] ), 4, &( lostPacketArray[ 0 ] ), 4 ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_BAD_PARAM,
+                       RtcpNackGenerator_Init( &( badNackGenerator ), NULL, 4, &( lostPacketArray[ 0 ] ), 4 ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_BAD_PARAM,
+                       RtcpNackGenerator_Init( &( badNackGenerator ), &( receivedBitmap[ 0 ] ), 0, &( lostPacketArray[ 0 ] ), 4 ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_BAD_PARAM,
+                       RtcpNackGenerator_Init( &( badNackGenerator ), &( receivedBitmap[ 0 ] ), 3, &( lostPacketArray[ 0 ] ), 4 ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_BAD_PARAM,
+                       RtcpNackGenerator_Init( &( badNackGenerator ), &( receivedBitmap[ 0 ] ), 2048, &( lostPacketArray[ 0 ] ), 4 ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_BAD_PARAM,
+                       RtcpNackGenerator_Init( &( badNackGenerator ), &( receivedBitmap[ 0 ] ), 4, NULL, 4 ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_BAD_PARAM,
+                       RtcpNackGenerator_Init( &( badNackGenerator ), &( receivedBitmap[ 0 ] ), 4, &( lostPacketArray[ 0 ] ), 0 ) );
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_BAD_PARAM,
+                       RtcpNackGenerator_SetRetryLimit( NULL, 0, 1 ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_BAD_PARAM,
+                       RtcpNackGenerator_SetRetryLimit( &( nackGenerator ), 0, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_BAD_PARAM,
+                       RtcpNackGenerator_UpdateRoundTripTime( NULL, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_BAD_PARAM,
+                       RtcpNackGenerator_RecordPacket( NULL, 0 ) );
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_BAD_PARAM,
+                       RtcpNackGenerator_GetNackPacket( NULL, 0, &( seqNumList[ 0 ] ), 64, &( nackPacket ) ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_BAD_PARAM,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 0, NULL, 64, &( nackPacket ) ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_BAD_PARAM,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 0, &( seqNumList[ 0 ] ), 0, &( nackPacket ) ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_BAD_PARAM,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 0, &( seqNumList[ 0 ] ), 64, NULL ) );
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_EMPTY,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 0, &( seqNumList[ 0 ] ), 64, &( nackPacket ) ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate NACK Generator functionality for lost, reordered and
+ * retransmitted packets, and the serialization of its NACK packets.
+ */
+void test_nackGenerator_GetNackPacket( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpNackPacket_t parsedNackPacket;
+    uint16_t parsedSeqNumList[ 8 ];
+    uint8_t buffer[ 64 ];
+    size_t bufferLength = sizeof( buffer );
+    uint16_t receivedSeqNums[] = { 10, 11, 14, 13, 17 };
+    uint16_t expectedSeqNumList[] = { 12, 15, 16 };
+
+    RecordPackets( &( receivedSeqNums[ 0 ] ),
+                   sizeof( receivedSeqNums ) / sizeof( receivedSeqNums[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 0, &( seqNumList[ 0 ] ), 64, &( nackPacket ) ) );
+    TEST_ASSERT_EQUAL_PTR( &( seqNumList[ 0 ] ),
+                           nackPacket.pSeqNumList );
+    TEST_ASSERT_EQUAL( 3,
+                       nackPacket.seqNumListLength );
+    TEST_ASSERT_EQUAL_UINT16_ARRAY( &( expectedSeqNumList[ 0 ] ),
+                                    &( seqNumList[ 0 ] ),
+                                    3 );
+
+    nackPacket.senderSsrc = 0x12345678;
+    nackPacket.mediaSourceSsrc = 0x9ABCDEF0;
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       Rtcp_Init( &( context ) ) );
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       Rtcp_SerializeNackPacket( &( context ), &( nackPacket ), &( buffer[ 0 ] ), &( bufferLength ) ) );
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       Rtcp_DeserializePacket( &( context ), &( buffer[ 0 ] ), bufferLength, &( rtcpPacket ) ) );
+
+    parsedNackPacket.pSeqNumList = &( parsedSeqNumList[ 0 ] );
+    parsedNackPacket.seqNumListLength = 8;
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       Rtcp_ParseNackPacket( &( context ), &( rtcpPacket ), &( parsedNackPacket ) ) );
+    TEST_ASSERT_EQUAL( 3,
+                       parsedNackPacket.seqNumListLength );
+    TEST_ASSERT_EQUAL_UINT16_ARRAY( &( expectedSeqNumList[ 0 ] ),
+                                    &( parsedSeqNumList[ 0 ] ),
+                                    3 );
+
+    /* Not NACKed again within the default round trip time of 100ms. */
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_EMPTY,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 99 * MILLISECONDS, &( seqNumList[ 0 ] ), 64, &( nackPacket ) ) );
+
+    /* 15 is retransmitted, and a duplicate of 17 is ignored. */
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_RecordPacket( &( nackGenerator ), 15 ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_RecordPacket( &( nackGenerator ), 17 ) );
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 100 * MILLISECONDS, &( seqNumList[ 0 ] ), 64, &( nackPacket ) ) );
+    TEST_ASSERT_EQUAL( 2,
+                       nackPacket.seqNumListLength );
+    TEST_ASSERT_EQUAL( 12,
+                       seqNumList[ 0 ] );
+    TEST_ASSERT_EQUAL( 16,
+                       seqNumList[ 1 ] );
+    TEST_ASSERT_EQUAL( 2,
+                       nackGenerator.lostPacketCount );
+    TEST_ASSERT_EQUAL( 2,
+                       lostPacketArray[ 0 ].nackCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate NACK Generator retry interval and maximum NACK count.
+ */
+void test_nackGenerator_RetryLimit( void )
+{
+    uint16_t receivedSeqNums[] = { 1, 3 };
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_SetRetryLimit( &( nackGenerator ), 20 * MILLISECONDS, 2 ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_UpdateRoundTripTime( &( nackGenerator ), 5 * MILLISECONDS ) );
+
+    RecordPackets( &( receivedSeqNums[ 0 ] ),
+                   sizeof( receivedSeqNums ) / sizeof( receivedSeqNums[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 0, &( seqNumList[ 0 ] ), 64, &( nackPacket ) ) );
+
+    /* The round trip time is below the minimum interval. */
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_EMPTY,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 10 * MILLISECONDS, &( seqNumList[ 0 ] ), 64, &( nackPacket ) ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 20 * MILLISECONDS, &( seqNumList[ 0 ] ), 64, &( nackPacket ) ) );
+    TEST_ASSERT_EQUAL( 2,
+                       seqNumList[ 0 ] );
+
+    /* NACKed twice, and given up. */
+    TEST_ASSERT_EQUAL( 1,
+                       nackGenerator.lostPacketCount );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_EMPTY,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 40 * MILLISECONDS, &( seqNumList[ 0 ] ), 64, &( nackPacket ) ) );
+    TEST_ASSERT_EQUAL( 0,
+                       nackGenerator.lostPacketCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate NACK Generator functionality when the NACK packet has room
+ * for only some of the lost packets.
+ */
+void test_nackGenerator_SeqNumListFull( void )
+{
+    uint16_t receivedSeqNums[] = { 100, 104 };
+
+    RecordPackets( &( receivedSeqNums[ 0 ] ),
+                   sizeof( receivedSeqNums ) / sizeof( receivedSeqNums[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 0, &( seqNumList[ 0 ] ), 2, &( nackPacket ) ) );
+    TEST_ASSERT_EQUAL( 2,
+                       nackPacket.seqNumListLength );
+    TEST_ASSERT_EQUAL( 101,
+                       seqNumList[ 0 ] );
+    TEST_ASSERT_EQUAL( 102,
+                       seqNumList[ 1 ] );
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 0, &( seqNumList[ 0 ] ), 2, &( nackPacket ) ) );
+    TEST_ASSERT_EQUAL( 1,
+                       nackPacket.seqNumListLength );
+    TEST_ASSERT_EQUAL( 103,
+                       seqNumList[ 0 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate NACK Generator functionality across the sequence number
+ * wrap around.
+ */
+void test_nackGenerator_SeqNumWrapAround( void )
+{
+    uint16_t receivedSeqNums[] = { 65533, 65534, 1 };
+
+    RecordPackets( &( receivedSeqNums[ 0 ] ),
+                   sizeof( receivedSeqNums ) / sizeof( receivedSeqNums[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 0, &( seqNumList[ 0 ] ), 64, &( nackPacket ) ) );
+    TEST_ASSERT_EQUAL( 2,
+                       nackPacket.seqNumListLength );
+    TEST_ASSERT_EQUAL( 65535,
+                       seqNumList[ 0 ] );
+    TEST_ASSERT_EQUAL( 0,
+                       seqNumList[ 1 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate NACK Generator functionality for lost packets which leave
+ * the received bitmap window.
+ */
+void test_nackGenerator_Window( void )
+{
+    uint16_t receivedSeqNums[] = { 0, 2 };
+    size_t i;
+
+    RecordPackets( &( receivedSeqNums[ 0 ] ),
+                   sizeof( receivedSeqNums ) / sizeof( receivedSeqNums[ 0 ] ) );
+
+    /* In a window of 128 sequence numbers, 1 is given up and 23 to 149 are
+     * lost, of which only the last 64 fit in the lost packet list. */
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_FULL,
+                       RtcpNackGenerator_RecordPacket( &( nackGenerator ), 150 ) );
+    TEST_ASSERT_EQUAL( 64,
+                       nackGenerator.lostPacketCount );
+
+    /* Too old, and must not be taken for 129, which has the same bit. */
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_RecordPacket( &( nackGenerator ), 1 ) );
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 0, &( seqNumList[ 0 ] ), 64, &( nackPacket ) ) );
+    TEST_ASSERT_EQUAL( 64,
+                       nackPacket.seqNumListLength );
+
+    for( i = 0; i < 64; i++ )
+    {
+        TEST_ASSERT_EQUAL( 86 + i,
+                           seqNumList[ i ] );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate NACK Generator functionality when the lost packet list is
+ * full.
+ */
+void test_nackGenerator_LostPacketArrayFull( void )
+{
+    RtcpNackGeneratorLostPacket_t smallLostPacketArray[ 4 ];
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_Init( &( nackGenerator ),
+                                               &( receivedBitmap[ 0 ] ),
+                                               RECEIVED_BITMAP_LENGTH,
+                                               &( smallLostPacketArray[ 0 ] ),
+                                               4 ) );
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_RecordPacket( &( nackGenerator ), 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_FULL,
+                       RtcpNackGenerator_RecordPacket( &( nackGenerator ), 10 ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_RecordPacket( &( nackGenerator ), 11 ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_FULL,
+                       RtcpNackGenerator_RecordPacket( &( nackGenerator ), 14 ) );
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 0, &( seqNumList[ 0 ] ), 64, &( nackPacket ) ) );
+    TEST_ASSERT_EQUAL( 4,
+                       nackPacket.seqNumListLength );
+    TEST_ASSERT_EQUAL( 8,
+                       seqNumList[ 0 ] );
+    TEST_ASSERT_EQUAL( 9,
+                       seqNumList[ 1 ] );
+    TEST_ASSERT_EQUAL( 12,
+                       seqNumList[ 2 ] );
+    TEST_ASSERT_EQUAL( 13,
+                       seqNumList[ 3 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate NACK Generator order of the lost packets when the head of
+ * the full lost packet list wraps around, and the lost packets kept for a gap
+ * longer than the list.
+ */
+void test_nackGenerator_LostPacketArrayWrapAround( void )
+{
+    RtcpNackGeneratorLostPacket_t smallLostPacketArray[ 4 ];
+    uint16_t receivedSeqNums[] = { 0, 3, 6 };
+    uint16_t expectedSeqNumList[] = { 9, 10, 12, 14 };
+    size_t i;
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_Init( &( nackGenerator ),
+                                               &( receivedBitmap[ 0 ] ),
+                                               RECEIVED_BITMAP_LENGTH,
+                                               &( smallLostPacketArray[ 0 ] ),
+                                               4 ) );
+
+    /* 1, 2, 4 and 5 fill the list. */
+    RecordPackets( &( receivedSeqNums[ 0 ] ),
+                   sizeof( receivedSeqNums ) / sizeof( receivedSeqNums[ 0 ] ) );
+
+    /* Each of 7, 9, 10, 12 and 14 gives up the oldest lost packet. */
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_FULL,
+                       RtcpNackGenerator_RecordPacket( &( nackGenerator ), 8 ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_FULL,
+                       RtcpNackGenerator_RecordPacket( &( nackGenerator ), 11 ) );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_FULL,
+                       RtcpNackGenerator_RecordPacket( &( nackGenerator ), 13 ) );
+    TEST_ASSERT_EQUAL( 0,
+                       nackGenerator.lostPacketHead );
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_FULL,
+                       RtcpNackGenerator_RecordPacket( &( nackGenerator ), 15 ) );
+    TEST_ASSERT_EQUAL( 1,
+                       nackGenerator.lostPacketHead );
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 100 * MILLISECONDS, &( seqNumList[ 0 ] ), 64, &( nackPacket ) ) );
+    TEST_ASSERT_EQUAL( 4,
+                       nackPacket.seqNumListLength );
+    TEST_ASSERT_EQUAL_UINT16_ARRAY( &( expectedSeqNumList[ 0 ] ),
+                                    &( seqNumList[ 0 ] ),
+                                    4 );
+
+    /* The time went back, not a round trip time since the last NACK. */
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_EMPTY,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 50 * MILLISECONDS, &( seqNumList[ 0 ] ), 64, &( nackPacket ) ) );
+    TEST_ASSERT_EQUAL( 4,
+                       nackGenerator.lostPacketCount );
+
+    /* 16 to 29 are lost, of which only the last 4 are kept, replacing the
+     * NACKed ones. */
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_FULL,
+                       RtcpNackGenerator_RecordPacket( &( nackGenerator ), 30 ) );
+    TEST_ASSERT_EQUAL( 4,
+                       nackGenerator.lostPacketCount );
+
+    TEST_ASSERT_EQUAL( RTCP_NACK_GENERATOR_RESULT_OK,
+                       RtcpNackGenerator_GetNackPacket( &( nackGenerator ), 100 * MILLISECONDS, &( seqNumList[ 0 ] ), 64, &( nackPacket ) ) );
+    TEST_ASSERT_EQUAL( 4,
+                       nackPacket.seqNumListLength );
+
+    for( i = 0; i < 4; i++ )
+    {
+        TEST_ASSERT_EQUAL( 26 + i,
+                           seqNumList[ i ] );
+        TEST_ASSERT_EQUAL( 26 + i,
+                           smallLostPacketArray[ i ].seqNum );
+        TEST_ASSERT_EQUAL( 1,
+                           smallLostPacketArray[ i ].nackCount );
+    }
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,375 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* API includes. */
+#include "rtcp_api.h"
+#include "rtcp_receiver_statistics.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define SOURCE_SSRC     0x12345678
+#define CLOCK_RATE      90000
+#define MILLISECONDS    10000ULL
+
+RtcpReceiverStatistics_t receiverStatistics;
+RtcpReceptionReport_t receptionReport;
+
+void setUp( void )
+{
+    RtcpReceiverStatisticsResult_t result;
+
+    result = RtcpReceiverStatistics_Init( &( receiverStatistics ),
+                                          SOURCE_SSRC,
+                                          CLOCK_RATE );
+
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       result );
+}
+
+void tearDown( void )
+{
+}
+
+/* Updates the statistics with packets 20ms apart, with no jitter. */
+static void UpdatePackets( const uint16_t * pSeqNums,
+                           size_t seqNumsLength )
+{
+    size_t i;
+
+    for( i = 0; i < seqNumsLength; i++ )
+    {
+        ( void ) RtcpReceiverStatistics_UpdatePacket( &( receiverStatistics ),
+                                                      pSeqNums[ i ],
+                                                      ( uint32_t ) ( i * 1800 ),
+                                                      i * 20 * MILLISECONDS );
+    }
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate Receiver Statistics fail functionality for Bad Parameters.
+ */
+void test_receiverStatistics_BadParams( void )
+{
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_BAD_PARAM,
+                       RtcpReceiverStatistics_Init( NULL, SOURCE_SSRC, CLOCK_RATE ) );
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_BAD_PARAM,
+                       RtcpReceiverStatistics_Init( &( receiverStatistics ), SOURCE_SSRC, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_BAD_PARAM,
+                       RtcpReceiverStatistics_UpdatePacket( NULL, 0, 0, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_BAD_PARAM,
+                       RtcpReceiverStatistics_GetReceptionReport( NULL, &( receptionReport ) ) );
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_BAD_PARAM,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), NULL ) );
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_EMPTY,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), &( receptionReport ) ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Receiver Statistics probation of a new source.
+ */
+void test_receiverStatistics_Probation( void )
+{
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_INVALID_PACKET,
+                       RtcpReceiverStatistics_UpdatePacket( &( receiverStatistics ), 100, 0, 0 ) );
+
+    /* Out of sequence, the probation starts over. */
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_INVALID_PACKET,
+                       RtcpReceiverStatistics_UpdatePacket( &( receiverStatistics ), 102, 0, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_EMPTY,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), &( receptionReport ) ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_UpdatePacket( &( receiverStatistics ), 103, 0, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), &( receptionReport ) ) );
+    TEST_ASSERT_EQUAL( SOURCE_SSRC,
+                       receptionReport.sourceSsrc );
+    TEST_ASSERT_EQUAL( 0,
+                       receptionReport.fractionLost );
+    TEST_ASSERT_EQUAL( 0,
+                       receptionReport.cumulativePacketsLost );
+    TEST_ASSERT_EQUAL( 103,
+                       receptionReport.extendedHighestSeqNumReceived );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Receiver Statistics fraction lost and cumulative packets
+ * lost.
+ */
+void test_receiverStatistics_PacketsLost( void )
+{
+    uint16_t seqNums[] = { 100, 101, 102, 104, 105 };
+    uint16_t moreSeqNums[] = { 106, 110 };
+
+    UpdatePackets( &( seqNums[ 0 ] ),
+                   sizeof( seqNums ) / sizeof( seqNums[ 0 ] ) );
+
+    /* 1 of 101 to 105 lost. */
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), &( receptionReport ) ) );
+    TEST_ASSERT_EQUAL( ( 1 << 8 ) / 5,
+                       receptionReport.fractionLost );
+    TEST_ASSERT_EQUAL( 1,
+                       receptionReport.cumulativePacketsLost );
+    TEST_ASSERT_EQUAL( 105,
+                       receptionReport.extendedHighestSeqNumReceived );
+    TEST_ASSERT_EQUAL( 0,
+                       receptionReport.interArrivalJitter );
+
+    /* Nothing lost since the previous report. */
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), &( receptionReport ) ) );
+    TEST_ASSERT_EQUAL( 0,
+                       receptionReport.fractionLost );
+    TEST_ASSERT_EQUAL( 1,
+                       receptionReport.cumulativePacketsLost );
+
+    /* 3 of 106 to 110 lost. */
+    UpdatePackets( &( moreSeqNums[ 0 ] ),
+                   sizeof( moreSeqNums ) / sizeof( moreSeqNums[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), &( receptionReport ) ) );
+    TEST_ASSERT_EQUAL( ( 3 << 8 ) / 5,
+                       receptionReport.fractionLost );
+    TEST_ASSERT_EQUAL( 4,
+                       receptionReport.cumulativePacketsLost );
+    TEST_ASSERT_EQUAL( 110,
+                       receptionReport.extendedHighestSeqNumReceived );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Receiver Statistics negative cumulative packets lost for
+ * duplicate packets.
+ */
+void test_receiverStatistics_DuplicatePackets( void )
+{
+    RtcpContext_t context;
+    RtcpReceiverReport_t receiverReport, parsedReceiverReport;
+    RtcpReceptionReport_t parsedReceptionReport;
+    RtcpPacket_t rtcpPacket;
+    uint8_t buffer[ 64 ];
+    size_t bufferLength = sizeof( buffer );
+    uint16_t seqNums[] = { 10, 11, 11, 12, 12 };
+
+    UpdatePackets( &( seqNums[ 0 ] ),
+                   sizeof( seqNums ) / sizeof( seqNums[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), &( receptionReport ) ) );
+    TEST_ASSERT_EQUAL( 0,
+                       receptionReport.fractionLost );
+    TEST_ASSERT_EQUAL( 0xFFFFFE,
+                       receptionReport.cumulativePacketsLost );
+
+    receptionReport.lastSR = 0;
+    receptionReport.delaySinceLastSR = 0;
+    receiverReport.senderSsrc = 0x9ABCDEF0;
+    receiverReport.pReceptionReports = &( receptionReport );
+    receiverReport.numReceptionReports = 1;
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       Rtcp_Init( &( context ) ) );
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       Rtcp_SerializeReceiverReport( &( context ), &( receiverReport ), &( buffer[ 0 ] ), &( bufferLength ) ) );
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       Rtcp_DeserializePacket( &( context ), &( buffer[ 0 ] ), bufferLength, &( rtcpPacket ) ) );
+
+    parsedReceiverReport.pReceptionReports = &( parsedReceptionReport );
+    parsedReceiverReport.numReceptionReports = 1;
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       Rtcp_ParseReceiverReport( &( context ), &( rtcpPacket ), &( parsedReceiverReport ) ) );
+    TEST_ASSERT_EQUAL( 0xFFFFFE,
+                       parsedReceptionReport.cumulativePacketsLost );
+    TEST_ASSERT_EQUAL( 12,
+                       parsedReceptionReport.extendedHighestSeqNumReceived );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Receiver Statistics extended highest sequence number across
+ * the sequence number wrap around, and reordered packets.
+ */
+void test_receiverStatistics_SeqNumWrapAround( void )
+{
+    uint16_t seqNums[] = { 65533, 65534, 0, 65535, 1 };
+
+    UpdatePackets( &( seqNums[ 0 ] ),
+                   sizeof( seqNums ) / sizeof( seqNums[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), &( receptionReport ) ) );
+    TEST_ASSERT_EQUAL( 0,
+                       receptionReport.cumulativePacketsLost );
+    TEST_ASSERT_EQUAL( 65536 + 1,
+                       receptionReport.extendedHighestSeqNumReceived );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Receiver Statistics restart of a source after a large
+ * sequence number jump.
+ */
+void test_receiverStatistics_LargeJump( void )
+{
+    uint16_t seqNums[] = { 10, 11, 12 };
+
+    UpdatePackets( &( seqNums[ 0 ] ),
+                   sizeof( seqNums ) / sizeof( seqNums[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_INVALID_PACKET,
+                       RtcpReceiverStatistics_UpdatePacket( &( receiverStatistics ), 5000, 0, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_UpdatePacket( &( receiverStatistics ), 13, 0, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_INVALID_PACKET,
+                       RtcpReceiverStatistics_UpdatePacket( &( receiverStatistics ), 6000, 0, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_UpdatePacket( &( receiverStatistics ), 6001, 0, 0 ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), &( receptionReport ) ) );
+    TEST_ASSERT_EQUAL( 0,
+                       receptionReport.cumulativePacketsLost );
+    TEST_ASSERT_EQUAL( 6001,
+                       receptionReport.extendedHighestSeqNumReceived );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Receiver Statistics interarrival jitter.
+ */
+void test_receiverStatistics_Jitter( void )
+{
+    /* 20ms apart, with no jitter. */
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_INVALID_PACKET,
+                       RtcpReceiverStatistics_UpdatePacket( &( receiverStatistics ), 1, 1000, 5000 * MILLISECONDS ) );
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_UpdatePacket( &( receiverStatistics ), 2, 2800, 5020 * MILLISECONDS ) );
+
+    /* 1ms, i.e. 90 timestamp units, late. */
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_UpdatePacket( &( receiverStatistics ), 3, 4600, 5041 * MILLISECONDS ) );
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), &( receptionReport ) ) );
+    TEST_ASSERT_EQUAL( 90 / 16,
+                       receptionReport.interArrivalJitter );
+
+    /* On time again. */
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_UpdatePacket( &( receiverStatistics ), 4, 6400, 5060 * MILLISECONDS ) );
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), &( receptionReport ) ) );
+    TEST_ASSERT_EQUAL( ( 90 + 90 - ( ( 90 + 8 ) >> 4 ) ) / 16,
+                       receptionReport.interArrivalJitter );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Receiver Statistics highest fraction lost, when all but
+ * one of the expected packets are lost.
+ */
+void test_receiverStatistics_AllButOneLost( void )
+{
+    uint16_t seqNums[] = { 10, 11, 12 };
+
+    UpdatePackets( &( seqNums[ 0 ] ),
+                   sizeof( seqNums ) / sizeof( seqNums[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), &( receptionReport ) ) );
+
+    /* 255 of 13 to 268 lost. */
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_UpdatePacket( &( receiverStatistics ), 268, 0, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), &( receptionReport ) ) );
+    TEST_ASSERT_EQUAL( 0xFF,
+                       receptionReport.fractionLost );
+    TEST_ASSERT_EQUAL( 255,
+                       receptionReport.cumulativePacketsLost );
+
+    /* 2997 of 269 to 3266 lost, rounded down to 255/256. */
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_UpdatePacket( &( receiverStatistics ), 3266, 0, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), &( receptionReport ) ) );
+    TEST_ASSERT_EQUAL( 0xFF,
+                       receptionReport.fractionLost );
+    TEST_ASSERT_EQUAL( 255 + 2997,
+                       receptionReport.cumulativePacketsLost );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Receiver Statistics cumulative packets lost clamped to the
+ * highest signed 24 bit value.
+ */
+void test_receiverStatistics_CumulativePacketsLostClamped( void )
+{
+    uint16_t seqNums[] = { 10, 11 };
+    uint16_t seqNum = 11;
+    uint32_t i;
+
+    UpdatePackets( &( seqNums[ 0 ] ),
+                   sizeof( seqNums ) / sizeof( seqNums[ 0 ] ) );
+
+    /* 2998 lost before each of 2800 packets, i.e. 8394400 lost. */
+    for( i = 0; i < 2800; i++ )
+    {
+        seqNum += 2999;
+
+        TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                           RtcpReceiverStatistics_UpdatePacket( &( receiverStatistics ), seqNum, 0, 0 ) );
+    }
+
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), &( receptionReport ) ) );
+    TEST_ASSERT_EQUAL( 0x7FFFFF,
+                       receptionReport.cumulativePacketsLost );
+    TEST_ASSERT_EQUAL( 11 + ( 2800 * 2999 ),
+                       receptionReport.extendedHighestSeqNumReceived );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Receiver Statistics negative cumulative packets lost
+ * clamped to the lowest signed 24 bit value.
+ */
+void test_receiverStatistics_NegativeCumulativePacketsLostClamped( void )
+{
+    uint16_t seqNums[] = { 10, 11 };
+    uint32_t i;
+
+    UpdatePackets( &( seqNums[ 0 ] ),
+                   sizeof( seqNums ) / sizeof( seqNums[ 0 ] ) );
+
+    /* 0x800001 duplicates of the only expected packet. */
+    for( i = 0; i < 0x800001; i++ )
+    {
+        ( void ) RtcpReceiverStatistics_UpdatePacket( &( receiverStatistics ), 11, 0, 0 );
+    }
+
+    TEST_ASSERT_EQUAL( RTCP_RECEIVER_STATISTICS_RESULT_OK,
+                       RtcpReceiverStatistics_GetReceptionReport( &( receiverStatistics ), &( receptionReport ) ) );
+    TEST_ASSERT_EQUAL( 0,
+                       receptionReport.fractionLost );
+    TEST_ASSERT_EQUAL( 0x800000,
+                       receptionReport.cumulativePacketsLost );
+}
+
+/*-----------------------------------------------------------*/
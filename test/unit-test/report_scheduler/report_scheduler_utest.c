@@ -0,0 +1,343 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* API includes. */
+#include "rtcp_report_scheduler.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+/* 1 Mbps of session bandwidth, i.e. 6250 bytes per second of RTCP. */
+#define SESSION_BANDWIDTH_BPS          1000000
+#define START_TIME                     ( 1000ULL * 10000000ULL )
+#define RANDOM_VALUE_MIDDLE            0x80000000
+
+/* The initial and regular minimum intervals of 2.5 and 5 seconds, divided
+ * by e - 3/2. */
+#define INITIAL_MIN_INTERVAL           20520734ULL
+#define MIN_INTERVAL                   41041468ULL
+
+/* 1000 receivers of 100 bytes reports in 3/4 of 6250 bytes per second,
+ * divided by e - 3/2. */
+#define THOUSAND_MEMBERS_INTERVAL      175110263ULL
+
+/* 100 senders of 100 bytes reports in 1/4 of 6250 bytes per second, divided
+ * by e - 3/2. */
+#define HUNDRED_SENDERS_INTERVAL       52533079ULL
+
+/* The maximum interval of 24 hours, divided by e - 3/2. */
+#define MAX_INTERVAL                   709196572216ULL
+
+RtcpReportScheduler_t reportScheduler;
+
+void setUp( void )
+{
+    RtcpReportSchedulerResult_t result;
+
+    result = RtcpReportScheduler_Init( &( reportScheduler ),
+                                       SESSION_BANDWIDTH_BPS,
+                                       START_TIME,
+                                       RANDOM_VALUE_MIDDLE );
+
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       result );
+}
+
+void tearDown( void )
+{
+}
+
+static RtcpScheduledReport_t CheckReport( uint64_t currentTime )
+{
+    RtcpScheduledReport_t scheduledReport;
+
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_CheckReport( &( reportScheduler ),
+                                                        currentTime,
+                                                        RANDOM_VALUE_MIDDLE,
+                                                        &( scheduledReport ) ) );
+
+    return scheduledReport;
+}
+
+static uint64_t GetNextReportTime( void )
+{
+    uint64_t nextReportTime;
+
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_GetNextReportTime( &( reportScheduler ),
+                                                              &( nextReportTime ) ) );
+
+    return nextReportTime;
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate Report Scheduler fail functionality for Bad Parameters.
+ */
+void test_reportScheduler_BadParams( void )
+{
+    RtcpScheduledReport_t scheduledReport;
+    uint64_t nextReportTime;
+
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM,
+                       RtcpReportScheduler_Init( NULL, SESSION_BANDWIDTH_BPS, 0, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM,
+                       RtcpReportScheduler_Init( &( reportScheduler ), 159, 0, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM,
+                       RtcpReportScheduler_RecordRtpPacketSent( NULL ) );
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM,
+                       RtcpReportScheduler_RecordRtcpPacket( NULL, 100 ) );
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM,
+                       RtcpReportScheduler_RecordRtcpPacket( &( reportScheduler ), 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM,
+                       RtcpReportScheduler_RecordRtcpPacket( &( reportScheduler ), 65536 ) );
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM,
+                       RtcpReportScheduler_UpdateMembers( NULL, 1, 0, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM,
+                       RtcpReportScheduler_UpdateMembers( &( reportScheduler ), 0, 0, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM,
+                       RtcpReportScheduler_UpdateMembers( &( reportScheduler ), 1, 2, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM,
+                       RtcpReportScheduler_CheckReport( NULL, 0, 0, &( scheduledReport ) ) );
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM,
+                       RtcpReportScheduler_CheckReport( &( reportScheduler ), 0, 0, NULL ) );
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM,
+                       RtcpReportScheduler_GetNextReportTime( NULL, &( nextReportTime ) ) );
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_BAD_PARAM,
+                       RtcpReportScheduler_GetNextReportTime( &( reportScheduler ), NULL ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Report Scheduler randomization of the first report
+ * interval.
+ */
+void test_reportScheduler_RandomizedInterval( void )
+{
+    TEST_ASSERT_EQUAL_UINT64( START_TIME + INITIAL_MIN_INTERVAL,
+                              GetNextReportTime() );
+
+    /* 0.5 and almost 1.5 times the interval. */
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_Init( &( reportScheduler ), SESSION_BANDWIDTH_BPS, START_TIME, 0 ) );
+    TEST_ASSERT_EQUAL_UINT64( START_TIME + ( 12500000ULL * 100000 / 121828 ),
+                              GetNextReportTime() );
+
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_Init( &( reportScheduler ), SESSION_BANDWIDTH_BPS, START_TIME, 0xFFFFFFFF ) );
+    TEST_ASSERT_EQUAL_UINT64( START_TIME + ( ( 12500000ULL + ( ( 25000000ULL * 0xFFFF ) >> 16 ) ) * 100000 / 121828 ),
+                              GetNextReportTime() );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Report Scheduler functionality for a receiver alone in the
+ * session.
+ */
+void test_reportScheduler_ReceiverReport( void )
+{
+    TEST_ASSERT_EQUAL( RTCP_SCHEDULED_REPORT_NONE,
+                       CheckReport( START_TIME + INITIAL_MIN_INTERVAL - 1 ) );
+    TEST_ASSERT_EQUAL( RTCP_SCHEDULED_REPORT_RECEIVER_REPORT,
+                       CheckReport( START_TIME + INITIAL_MIN_INTERVAL ) );
+    TEST_ASSERT_EQUAL_UINT64( START_TIME + INITIAL_MIN_INTERVAL + MIN_INTERVAL,
+                              GetNextReportTime() );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Report Scheduler SR packets while RTP packets are sent, and
+ * until two reports after the last one.
+ */
+void test_reportScheduler_SenderReport( void )
+{
+    uint64_t reportTime = START_TIME + INITIAL_MIN_INTERVAL;
+
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_RecordRtpPacketSent( &( reportScheduler ) ) );
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_UpdateMembers( &( reportScheduler ), 2, 1, START_TIME ) );
+
+    TEST_ASSERT_EQUAL( RTCP_SCHEDULED_REPORT_SENDER_REPORT,
+                       CheckReport( reportTime ) );
+
+    reportTime += MIN_INTERVAL;
+    TEST_ASSERT_EQUAL( RTCP_SCHEDULED_REPORT_SENDER_REPORT,
+                       CheckReport( reportTime ) );
+
+    reportTime += MIN_INTERVAL;
+    TEST_ASSERT_EQUAL( RTCP_SCHEDULED_REPORT_RECEIVER_REPORT,
+                       CheckReport( reportTime ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Report Scheduler timer reconsideration when members join,
+ * and reverse reconsideration when they leave.
+ */
+void test_reportScheduler_Reconsideration( void )
+{
+    uint64_t reportTime = START_TIME + THOUSAND_MEMBERS_INTERVAL;
+    uint64_t currentTime = reportTime + 100000000;
+
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_UpdateMembers( &( reportScheduler ), 1000, 0, START_TIME ) );
+
+    /* Postponed for the new members. */
+    TEST_ASSERT_EQUAL( RTCP_SCHEDULED_REPORT_NONE,
+                       CheckReport( START_TIME + INITIAL_MIN_INTERVAL ) );
+    TEST_ASSERT_EQUAL_UINT64( reportTime,
+                              GetNextReportTime() );
+
+    TEST_ASSERT_EQUAL( RTCP_SCHEDULED_REPORT_RECEIVER_REPORT,
+                       CheckReport( reportTime ) );
+    TEST_ASSERT_EQUAL_UINT64( reportTime + THOUSAND_MEMBERS_INTERVAL,
+                              GetNextReportTime() );
+
+    /* Half the members leave. */
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_UpdateMembers( &( reportScheduler ), 500, 0, currentTime ) );
+    TEST_ASSERT_EQUAL_UINT64( currentTime + ( ( THOUSAND_MEMBERS_INTERVAL - 100000000 ) / 2 ),
+                              GetNextReportTime() );
+    TEST_ASSERT_EQUAL_UINT64( currentTime - ( 100000000 / 2 ),
+                              reportScheduler.previousReportTime );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Report Scheduler average RTCP packet size.
+ */
+void test_reportScheduler_RecordRtcpPacket( void )
+{
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_RecordRtcpPacket( &( reportScheduler ), 260 ) );
+
+    /* 100 + ( 260 - 100 ) / 16 bytes. */
+    TEST_ASSERT_EQUAL( 110 * 16,
+                       reportScheduler.averagePacketSize );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Report Scheduler share of 1/4 of the bandwidth for the
+ * senders, when they are at most 1/4 of the members and we are sending.
+ */
+void test_reportScheduler_SendersShare( void )
+{
+    uint64_t reportTime = START_TIME + HUNDRED_SENDERS_INTERVAL;
+
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_UpdateMembers( &( reportScheduler ), 1000, 100, START_TIME ) );
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_RecordRtpPacketSent( &( reportScheduler ) ) );
+
+    /* Postponed for the 100 senders, instead of the 900 receivers. */
+    TEST_ASSERT_EQUAL( RTCP_SCHEDULED_REPORT_NONE,
+                       CheckReport( START_TIME + INITIAL_MIN_INTERVAL ) );
+    TEST_ASSERT_EQUAL_UINT64( reportTime,
+                              GetNextReportTime() );
+
+    TEST_ASSERT_EQUAL( RTCP_SCHEDULED_REPORT_SENDER_REPORT,
+                       CheckReport( reportTime ) );
+    TEST_ASSERT_EQUAL_UINT64( reportTime + HUNDRED_SENDERS_INTERVAL,
+                              GetNextReportTime() );
+
+    /* The 900 receivers share 3/4 of the bandwidth once we stopped
+     * sending. */
+    reportTime += HUNDRED_SENDERS_INTERVAL;
+    TEST_ASSERT_EQUAL( RTCP_SCHEDULED_REPORT_SENDER_REPORT,
+                       CheckReport( reportTime ) );
+    TEST_ASSERT_EQUAL_UINT64( reportTime + ( 192000000ULL * 100000 / 121828 ),
+                              GetNextReportTime() );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Report Scheduler shares of a bandwidth of less than
+ * 4 bytes per second, which are not rounded to 0.
+ */
+void test_reportScheduler_LowBandwidth( void )
+{
+    /* 160 bps, i.e. 1 byte per second of RTCP, for a single receiver, i.e.
+     * 100 bytes in 3/4 byte per second. */
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_Init( &( reportScheduler ), 160, START_TIME, RANDOM_VALUE_MIDDLE ) );
+    TEST_ASSERT_EQUAL_UINT64( START_TIME + ( 1333333332ULL * 100000 / 121828 ),
+                              GetNextReportTime() );
+
+    /* A single sender among 4 members, i.e. 100 bytes in 1/4 byte per
+     * second. */
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_UpdateMembers( &( reportScheduler ), 4, 1, START_TIME ) );
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_RecordRtpPacketSent( &( reportScheduler ) ) );
+
+    TEST_ASSERT_EQUAL( RTCP_SCHEDULED_REPORT_NONE,
+                       CheckReport( GetNextReportTime() ) );
+    TEST_ASSERT_EQUAL_UINT64( START_TIME + ( 4000000000ULL * 100000 / 121828 ),
+                              GetNextReportTime() );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Report Scheduler maximum interval.
+ */
+void test_reportScheduler_MaxInterval( void )
+{
+    /* 1000 receivers of 100 bytes reports in 3/4 byte per second, i.e. more
+     * than 24 hours. */
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_Init( &( reportScheduler ), 160, START_TIME, RANDOM_VALUE_MIDDLE ) );
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_UpdateMembers( &( reportScheduler ), 1000, 0, START_TIME ) );
+
+    TEST_ASSERT_EQUAL( RTCP_SCHEDULED_REPORT_NONE,
+                       CheckReport( GetNextReportTime() ) );
+    TEST_ASSERT_EQUAL_UINT64( START_TIME + MAX_INTERVAL,
+                              GetNextReportTime() );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Report Scheduler reverse reconsideration is skipped when
+ * members leave after the next report time, or before the previous one.
+ */
+void test_reportScheduler_ReverseReconsiderationSkipped( void )
+{
+    uint64_t reportTime = START_TIME + THOUSAND_MEMBERS_INTERVAL;
+
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_UpdateMembers( &( reportScheduler ), 1000, 0, START_TIME ) );
+    TEST_ASSERT_EQUAL( RTCP_SCHEDULED_REPORT_NONE,
+                       CheckReport( START_TIME + INITIAL_MIN_INTERVAL ) );
+    TEST_ASSERT_EQUAL( RTCP_SCHEDULED_REPORT_RECEIVER_REPORT,
+                       CheckReport( reportTime ) );
+
+    /* The next report is already due. */
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_UpdateMembers( &( reportScheduler ), 500, 0, reportTime + THOUSAND_MEMBERS_INTERVAL ) );
+    TEST_ASSERT_EQUAL_UINT64( reportTime + THOUSAND_MEMBERS_INTERVAL,
+                              GetNextReportTime() );
+
+    /* A time before the previous report. */
+    TEST_ASSERT_EQUAL( RTCP_REPORT_SCHEDULER_RESULT_OK,
+                       RtcpReportScheduler_UpdateMembers( &( reportScheduler ), 250, 0, reportTime - 1 ) );
+    TEST_ASSERT_EQUAL_UINT64( reportTime + THOUSAND_MEMBERS_INTERVAL,
+                              GetNextReportTime() );
+    TEST_ASSERT_EQUAL_UINT64( reportTime,
+                              reportScheduler.previousReportTime );
+    TEST_ASSERT_EQUAL( 1000,
+                       reportScheduler.previousMembers );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,459 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* API includes. */
+#include "rtcp_api.h"
+#include "rtcp_retransmission_history.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define PACKET_ARRAY_LENGTH    8
+#define PACKET_LENGTH          100
+#define MILLISECONDS           10000ULL
+
+RtcpRetransmissionHistory_t history;
+RtcpRetransmissionPacket_t packetArray[ PACKET_ARRAY_LENGTH ];
+uint8_t packetBuffers[ 16 ][ PACKET_LENGTH ];
+
+void setUp( void )
+{
+    RtcpRetransmissionHistoryResult_t result;
+
+    result = RtcpRetransmissionHistory_Init( &( history ),
+                                             &( packetArray[ 0 ] ),
+                                             PACKET_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       result );
+}
+
+void tearDown( void )
+{
+}
+
+/* Adds packets 100 to 107 sent 1ms apart, from time 0. */
+static void AddPackets( void )
+{
+    uint16_t i;
+
+    for( i = 0; i < PACKET_ARRAY_LENGTH; i++ )
+    {
+        TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                           RtcpRetransmissionHistory_AddPacket( &( history ),
+                                                                100 + i,
+                                                                &( packetBuffers[ i ][ 0 ] ),
+                                                                PACKET_LENGTH,
+                                                                i * MILLISECONDS,
+                                                                NULL ) );
+    }
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate Retransmission History fail functionality for Bad
+ * Parameters.
+ */
+void test_retransmissionHistory_BadParams( void )
+{
+    RtcpRetransmissionHistory_t badHistory;
+    RtcpNackPacket_t nackPacket = { 0 };
+    RtcpNackFciPacket_t nackFciPacket = { 0 };
+    RtcpRetransmissionPacket_t * resendList[ 4 ];
+    size_t resendListLength = 4;
+
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_Init( NULL, &( packetArray[ 0 ] ), PACKET_ARRAY_LENGTH ) );
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_Init( &( badHistory ), NULL, PACKET_ARRAY_LENGTH ) );
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_Init( &( badHistory ), &( packetArray[ 0 ] ), 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_Init( &( badHistory ), &( packetArray[ 0 ] ), 6 ) );
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_Init( &( badHistory ), &( packetArray[ 0 ] ), 65536 ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_SetRateLimit( NULL, 0, 1, 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_SetRateLimit( &( history ), 0, 0, 0 ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_AddPacket( NULL, 1, &( packetBuffers[ 0 ][ 0 ] ), PACKET_LENGTH, 0, NULL ) );
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_AddPacket( &( history ), 1, NULL, PACKET_LENGTH, 0, NULL ) );
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_AddPacket( &( history ), 1, &( packetBuffers[ 0 ][ 0 ] ), 0, 0, NULL ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_HandleNackPacket( NULL, &( nackPacket ), 0, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), NULL, 0, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 0, NULL, &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 0, &( resendList[ 0 ] ), NULL ) );
+
+    nackPacket.seqNumListLength = 1;
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 0, &( resendList[ 0 ] ), &( resendListLength ) ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_HandleNackFciPacket( NULL, &( nackFciPacket ), 0, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_HandleNackFciPacket( &( history ), NULL, 0, &( resendList[ 0 ] ), &( resendListLength ) ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_HandleNackFciPacket( &( history ), &( nackFciPacket ), 0, NULL, &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_HandleNackFciPacket( &( history ), &( nackFciPacket ), 0, &( resendList[ 0 ] ), NULL ) );
+
+    nackFciPacket.fciListLength = 1;
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_BAD_PARAM,
+                       RtcpRetransmissionHistory_HandleNackFciPacket( &( history ), &( nackFciPacket ), 0, &( resendList[ 0 ] ), &( resendListLength ) ) );
+
+    /* An empty list. */
+    nackPacket.seqNumListLength = 0;
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 0, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 0,
+                       resendListLength );
+
+    resendListLength = 4;
+    nackFciPacket.fciListLength = 0;
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_HandleNackFciPacket( &( history ), &( nackFciPacket ), 0, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 0,
+                       resendListLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Retransmission History eviction of older packets.
+ */
+void test_retransmissionHistory_AddPacket_Evicted( void )
+{
+    RtcpRetransmissionPacket_t evictedPacket;
+    RtcpNackPacket_t nackPacket = { 0 };
+    RtcpRetransmissionPacket_t * resendList[ 4 ];
+    size_t resendListLength = 4;
+    uint16_t seqNumList[] = { 100, 108 };
+
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_AddPacket( &( history ), 100, &( packetBuffers[ 0 ][ 0 ] ), PACKET_LENGTH, 0, &( evictedPacket ) ) );
+    TEST_ASSERT_NULL( evictedPacket.pPacket );
+
+    /* 108 takes the slot of 100. */
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_AddPacket( &( history ), 108, &( packetBuffers[ 8 ][ 0 ] ), PACKET_LENGTH, MILLISECONDS, &( evictedPacket ) ) );
+    TEST_ASSERT_EQUAL_PTR( &( packetBuffers[ 0 ][ 0 ] ),
+                           evictedPacket.pPacket );
+    TEST_ASSERT_EQUAL( 100,
+                       evictedPacket.seqNum );
+
+    nackPacket.pSeqNumList = &( seqNumList[ 0 ] );
+    nackPacket.seqNumListLength = 2;
+
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 100 * MILLISECONDS, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 1,
+                       resendListLength );
+    TEST_ASSERT_EQUAL_PTR( &( packetBuffers[ 8 ][ 0 ] ),
+                           resendList[ 0 ]->pPacket );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Retransmission History functionality for a NACK packet.
+ */
+void test_retransmissionHistory_HandleNackPacket( void )
+{
+    RtcpNackPacket_t nackPacket = { 0 };
+    RtcpRetransmissionPacket_t * resendList[ 4 ];
+    size_t resendListLength = 4;
+    uint16_t seqNumList[] = { 99, 101, 103, 104 };
+
+    AddPackets();
+
+    nackPacket.pSeqNumList = &( seqNumList[ 0 ] );
+    nackPacket.seqNumListLength = 4;
+
+    /* 99 was never sent. 104 was sent at 4ms, less than 10ms ago. */
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 13 * MILLISECONDS, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 2,
+                       resendListLength );
+    TEST_ASSERT_EQUAL( 101,
+                       resendList[ 0 ]->seqNum );
+    TEST_ASSERT_EQUAL_PTR( &( packetBuffers[ 1 ][ 0 ] ),
+                           resendList[ 0 ]->pPacket );
+    TEST_ASSERT_EQUAL( 1,
+                       resendList[ 0 ]->resendCount );
+    TEST_ASSERT_EQUAL( 103,
+                       resendList[ 1 ]->seqNum );
+
+    /* 101 and 103 were just resent. */
+    resendListLength = 4;
+
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 15 * MILLISECONDS, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 1,
+                       resendListLength );
+    TEST_ASSERT_EQUAL( 104,
+                       resendList[ 0 ]->seqNum );
+
+    /* The resend list is filled by the first packet. */
+    resendListLength = 1;
+
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_FULL,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 30 * MILLISECONDS, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 1,
+                       resendListLength );
+    TEST_ASSERT_EQUAL( 101,
+                       resendList[ 0 ]->seqNum );
+    TEST_ASSERT_EQUAL( 2,
+                       resendList[ 0 ]->resendCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Retransmission History skips packets never added, and
+ * packets sent after the current time.
+ */
+void test_retransmissionHistory_HandleNackPacket_NotSent( void )
+{
+    RtcpNackPacket_t nackPacket = { 0 };
+    RtcpRetransmissionPacket_t * resendList[ 4 ];
+    size_t resendListLength = 4;
+    uint16_t seqNumList[] = { 101, 100 };
+
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_AddPacket( &( history ), 100, &( packetBuffers[ 0 ][ 0 ] ), PACKET_LENGTH, 50 * MILLISECONDS, NULL ) );
+
+    nackPacket.pSeqNumList = &( seqNumList[ 0 ] );
+    nackPacket.seqNumListLength = 2;
+
+    /* The slot of 101 is empty, and 100 is sent at 50ms. */
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 20 * MILLISECONDS, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 0,
+                       resendListLength );
+
+    resendListLength = 4;
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 60 * MILLISECONDS, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 1,
+                       resendListLength );
+    TEST_ASSERT_EQUAL( 100,
+                       resendList[ 0 ]->seqNum );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Retransmission History resend count and rate limits.
+ */
+void test_retransmissionHistory_RateLimit( void )
+{
+    RtcpNackPacket_t nackPacket = { 0 };
+    RtcpRetransmissionPacket_t * resendList[ 8 ];
+    size_t resendListLength;
+    uint16_t seqNumList[] = { 100, 101, 102, 103, 104 };
+
+    AddPackets();
+
+    /* Two resends of a packet, of up to 250 bytes per second. */
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_SetRateLimit( &( history ), 0, 2, 250 ) );
+
+    nackPacket.pSeqNumList = &( seqNumList[ 0 ] );
+    nackPacket.seqNumListLength = 5;
+
+    resendListLength = 8;
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 1000 * MILLISECONDS, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 2,
+                       resendListLength );
+    TEST_ASSERT_EQUAL( 100,
+                       resendList[ 0 ]->seqNum );
+    TEST_ASSERT_EQUAL( 101,
+                       resendList[ 1 ]->seqNum );
+
+    /* 400ms refills 100 bytes. */
+    resendListLength = 8;
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 1400 * MILLISECONDS, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 1,
+                       resendListLength );
+    TEST_ASSERT_EQUAL( 100,
+                       resendList[ 0 ]->seqNum );
+
+    /* 100 was resent twice, the most allowed. */
+    resendListLength = 8;
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 5000 * MILLISECONDS, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 2,
+                       resendListLength );
+    TEST_ASSERT_EQUAL( 101,
+                       resendList[ 0 ]->seqNum );
+    TEST_ASSERT_EQUAL( 102,
+                       resendList[ 1 ]->seqNum );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Retransmission History functionality for a NACK packet
+ * parsed into PID and BLP entries.
+ */
+void test_retransmissionHistory_HandleNackFciPacket( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpNackFciPacket_t nackFciPacket;
+    RtcpNackFci_t fciList[ 2 ];
+    RtcpRetransmissionPacket_t * resendList[ 8 ];
+    size_t resendListLength = 8;
+    uint8_t nackPacketPayload[] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0x00, 0x63, 0x00, 0x05, /* NACK: PID = 99, BLP = 100, 102. */
+        0x00, 0x69, 0x80, 0x01  /* NACK: PID = 105, BLP = 106, 121. */
+    };
+
+    AddPackets();
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       Rtcp_Init( &( context ) ) );
+
+    rtcpPacket.pPayload = &( nackPacketPayload[ 0 ] );
+    rtcpPacket.payloadLength = sizeof( nackPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_NACK;
+
+    nackFciPacket.pFciList = &( fciList[ 0 ] );
+    nackFciPacket.fciListLength = 2;
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       Rtcp_ParseNackPacketFcis( &( context ), &( rtcpPacket ), &( nackFciPacket ) ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_HandleNackFciPacket( &( history ), &( nackFciPacket ), 100 * MILLISECONDS, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 4,
+                       resendListLength );
+    TEST_ASSERT_EQUAL( 100,
+                       resendList[ 0 ]->seqNum );
+    TEST_ASSERT_EQUAL( 102,
+                       resendList[ 1 ]->seqNum );
+    TEST_ASSERT_EQUAL( 105,
+                       resendList[ 2 ]->seqNum );
+    TEST_ASSERT_EQUAL( 106,
+                       resendList[ 3 ]->seqNum );
+    TEST_ASSERT_EQUAL_PTR( &( packetBuffers[ 6 ][ 0 ] ),
+                           resendList[ 3 ]->pPacket );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Retransmission History budget refilled by partial refills
+ * up to one second of resends, and not refilled when the time goes back.
+ */
+void test_retransmissionHistory_RateLimit_PartialRefills( void )
+{
+    RtcpNackPacket_t nackPacket = { 0 };
+    RtcpRetransmissionPacket_t * resendList[ 8 ];
+    size_t resendListLength;
+    uint16_t seqNumList[] = { 100, 101, 102, 103 };
+
+    AddPackets();
+
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_SetRateLimit( &( history ), 0, 10, 250 ) );
+
+    nackPacket.pSeqNumList = &( seqNumList[ 0 ] );
+    nackPacket.seqNumListLength = 1;
+
+    /* 150 bytes left. */
+    resendListLength = 8;
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 1000 * MILLISECONDS, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 1,
+                       resendListLength );
+
+    /* 800ms refills 200 bytes, capped to 250 bytes, 150 bytes left. */
+    nackPacket.pSeqNumList = &( seqNumList[ 1 ] );
+    resendListLength = 8;
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 1800 * MILLISECONDS, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 1,
+                       resendListLength );
+    TEST_ASSERT_EQUAL( 150,
+                       history.resendBytesBudget );
+
+    /* 50 bytes left after 102, not enough for 103. */
+    nackPacket.pSeqNumList = &( seqNumList[ 2 ] );
+    nackPacket.seqNumListLength = 2;
+    resendListLength = 8;
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 1800 * MILLISECONDS, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 1,
+                       resendListLength );
+    TEST_ASSERT_EQUAL( 102,
+                       resendList[ 0 ]->seqNum );
+
+    /* The time went back. */
+    nackPacket.pSeqNumList = &( seqNumList[ 3 ] );
+    nackPacket.seqNumListLength = 1;
+    resendListLength = 8;
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_OK,
+                       RtcpRetransmissionHistory_HandleNackPacket( &( history ), &( nackPacket ), 1700 * MILLISECONDS, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 0,
+                       resendListLength );
+    TEST_ASSERT_EQUAL( 50,
+                       history.resendBytesBudget );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Retransmission History functionality for a NACK packet
+ * parsed into PID and BLP entries, with a resend list filled before the BLP
+ * of an entry.
+ */
+void test_retransmissionHistory_HandleNackFciPacket_Full( void )
+{
+    RtcpNackFciPacket_t nackFciPacket;
+    RtcpNackFci_t fciList[ 3 ];
+    RtcpRetransmissionPacket_t * resendList[ 1 ];
+    size_t resendListLength = 1;
+
+    AddPackets();
+
+    /* PID = 100, then PID = 102, BLP = 103, then PID = 105. */
+    fciList[ 0 ].pid = 100;
+    fciList[ 0 ].blp = 0;
+    fciList[ 1 ].pid = 102;
+    fciList[ 1 ].blp = 0x0001;
+    fciList[ 2 ].pid = 105;
+    fciList[ 2 ].blp = 0;
+
+    nackFciPacket.pFciList = &( fciList[ 0 ] );
+    nackFciPacket.fciListLength = 3;
+
+    TEST_ASSERT_EQUAL( RTCP_RETRANSMISSION_HISTORY_RESULT_FULL,
+                       RtcpRetransmissionHistory_HandleNackFciPacket( &( history ), &( nackFciPacket ), 100 * MILLISECONDS, &( resendList[ 0 ] ), &( resendListLength ) ) );
+    TEST_ASSERT_EQUAL( 1,
+                       resendListLength );
+    TEST_ASSERT_EQUAL( 100,
+                       resendList[ 0 ]->seqNum );
+    TEST_ASSERT_EQUAL( 0,
+                       packetArray[ 103 % PACKET_ARRAY_LENGTH ].resendCount );
+    TEST_ASSERT_EQUAL( 0,
+                       packetArray[ 105 % PACKET_ARRAY_LENGTH ].resendCount );
+}
+
+/*-----------------------------------------------------------*/
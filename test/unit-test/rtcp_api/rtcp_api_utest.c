@@ -3522,8 +3522,2419 @@ void test_rtcpParseTwccPacket_StatusVectorChunk_ArrivalInfoList( void )
                        rtcpTwccPacket.arrivalInfoListLength );
     TEST_ASSERT_EQUAL( 0x0001,
                        rtcpTwccPacket.pArrivalInfoList[ 0 ].seqNum );
-    TEST_ASSERT_EQUAL( 81922500,
+    /* Large deltas are signed: 0x8001 = -32767 * 250us = -8191.75ms. */
+    TEST_ASSERT_EQUAL_UINT64( ( uint64_t ) ( -81917500LL ),
+                              rtcpTwccPacket.pArrivalInfoList[ 0 ].remoteArrivalTime );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Parse Twcc Packet functionality for Status Vector Chunk with mixed symbols.
+ */
+void test_rtcpParseTwccPacket_StatusVectorChunk_MixedSymbols( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    PacketArrivalInfo_t packetArrivalInfo[ 7 ];
+    RtcpTwccPacket_t rtcpTwccPacket;
+    RtcpResult_t result;
+    uint8_t twccPacketPayload[] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0x00, 0x01,             /* Base Sequence Number. */
+        0x00, 0x07,             /* Packet Status Count. */
+        0x00, 0x00, 0x00, 0x02, /* Reference Time (0), Feedback Packet Count (2). */
+        0xDB, 0x10,             /* Status Vector Chunk. */
+        /* Recv delta. */
+        0x04,
+        0x00, 0x08,
+        0x02
+    };
+
+    /*
+     *  0                   1
+     *  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5
+     * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+     * |1|1|0 1|1 0|1 1|0 0|0 1|0 0|0 0|
+     * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+     *
+     * 1x Small-Delta Packet (1ms).
+     * 1x Big-Delta Packet (2ms).
+     * 1x Reserved.
+     * 1x Packet Not Received.
+     * 1x Small-Delta Packet (0.5ms).
+     * 2x Packet Not Received.
+     */
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    rtcpTwccPacket.pArrivalInfoList = &( packetArrivalInfo[ 0 ] );
+    rtcpTwccPacket.arrivalInfoListLength = 7;
+
+    result = Rtcp_ParseTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 7,
+                       rtcpTwccPacket.arrivalInfoListLength );
+    TEST_ASSERT_EQUAL( 0x0001,
+                       rtcpTwccPacket.pArrivalInfoList[ 0 ].seqNum );
+    TEST_ASSERT_EQUAL( 10000,
                        rtcpTwccPacket.pArrivalInfoList[ 0 ].remoteArrivalTime );
+    TEST_ASSERT_EQUAL( 30000,
+                       rtcpTwccPacket.pArrivalInfoList[ 1 ].remoteArrivalTime );
+    TEST_ASSERT_EQUAL( RTCP_TWCC_PACKET_LOST_TIME,
+                       rtcpTwccPacket.pArrivalInfoList[ 2 ].remoteArrivalTime );
+    TEST_ASSERT_EQUAL( RTCP_TWCC_PACKET_LOST_TIME,
+                       rtcpTwccPacket.pArrivalInfoList[ 3 ].remoteArrivalTime );
+    TEST_ASSERT_EQUAL( 35000,
+                       rtcpTwccPacket.pArrivalInfoList[ 4 ].remoteArrivalTime );
+    TEST_ASSERT_EQUAL( RTCP_TWCC_PACKET_LOST_TIME,
+                       rtcpTwccPacket.pArrivalInfoList[ 5 ].remoteArrivalTime );
+    TEST_ASSERT_EQUAL( 0x0007,
+                       rtcpTwccPacket.pArrivalInfoList[ 6 ].seqNum );
+    TEST_ASSERT_EQUAL( RTCP_TWCC_PACKET_LOST_TIME,
+                       rtcpTwccPacket.pArrivalInfoList[ 6 ].remoteArrivalTime );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Parse Twcc Packet functionality for Status Vector Chunk
+ * with more symbols than the packet status count.
+ */
+void test_rtcpParseTwccPacket_StatusVectorChunk_SymbolsPastStatusCount( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpTwccPacket_t rtcpTwccPacket;
+    RtcpResult_t result;
+    uint8_t twccPacketPayload[] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0x00, 0x01,             /* Base Sequence Number. */
+        0x00, 0x03,             /* Packet Status Count. */
+        0x00, 0x00, 0x00, 0x02, /* Reference Time (0), Feedback Packet Count (2). */
+        0xBF, 0xFF,             /* Status Vector Chunk. */
+        /* Recv delta. */
+        0x01, 0x02, 0x03
+    };
+
+    /* All the 14 symbols are set, but only the first 3 are used and so only
+     * 3 receive deltas must be present. */
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    rtcpTwccPacket.pArrivalInfoList = NULL;
+    rtcpTwccPacket.arrivalInfoListLength = 0;
+
+    result = Rtcp_ParseTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 3,
+                       rtcpTwccPacket.arrivalInfoListLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Parse Twcc Packet functionality for a Run Length Chunk
+ * followed by a Status Vector Chunk.
+ */
+void test_rtcpParseTwccPacket_MixedChunks( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    PacketArrivalInfo_t packetArrivalInfo[ 10 ];
+    RtcpTwccPacket_t rtcpTwccPacket;
+    RtcpResult_t result;
+    size_t i;
+    uint64_t expectedArrivalTimes[ 10 ] =
+    {
+        650000, 660000, 670000, 690000,
+        RTCP_TWCC_PACKET_LOST_TIME, 692500,
+        RTCP_TWCC_PACKET_LOST_TIME, RTCP_TWCC_PACKET_LOST_TIME, RTCP_TWCC_PACKET_LOST_TIME,
+        697500
+    };
+    uint8_t twccPacketPayload[] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0xFF, 0xFE,             /* Base Sequence Number. */
+        0x00, 0x0A,             /* Packet Status Count. */
+        0x00, 0x00, 0x01, 0x02, /* Reference Time (1 * 64ms), Feedback Packet Count (2). */
+        0x20, 0x03,             /* Packet Status (Small Delta), Run Length Chunk. */
+        0xA8, 0x80,             /* Status Vector Chunk (1 0 1 0 0 0 1). */
+        /* Recv delta. */
+        0x04, 0x04, 0x04,
+        0x08, 0x01, 0x02
+    };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    rtcpTwccPacket.pArrivalInfoList = &( packetArrivalInfo[ 0 ] );
+    rtcpTwccPacket.arrivalInfoListLength = 10;
+
+    result = Rtcp_ParseTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 10,
+                       rtcpTwccPacket.arrivalInfoListLength );
+
+    for( i = 0; i < 10; i++ )
+    {
+        TEST_ASSERT_EQUAL( ( uint16_t ) ( 0xFFFE + i ),
+                           rtcpTwccPacket.pArrivalInfoList[ i ].seqNum );
+        TEST_ASSERT_EQUAL_UINT64( expectedArrivalTimes[ i ],
+                                  rtcpTwccPacket.pArrivalInfoList[ i ].remoteArrivalTime );
+    }
+
+    /* One receive delta short. */
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload ) - 1;
+    rtcpTwccPacket.arrivalInfoListLength = 10;
+
+    result = Rtcp_ParseTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_MALFORMED_PACKET,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Parse Twcc Packet functionality for every Status Vector
+ * Chunk symbol list, with exactly enough receive deltas and one byte short.
+ */
+void test_rtcpParseTwccPacket_StatusVectorChunk_AllSymbolLists( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpTwccPacket_t rtcpTwccPacket;
+    RtcpResult_t result;
+    uint32_t symbolList;
+    uint16_t packetChunk, symbol, symbolSize, i;
+    size_t receiveDeltaLength;
+    uint8_t twccPacketPayload[ 18 + 14 ] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0x00, 0x01,             /* Base Sequence Number. */
+        0x00, 0x00,             /* Packet Status Count. */
+        0x00, 0x00, 0x00, 0x02, /* Reference Time (0), Feedback Packet Count (2). */
+        0x00, 0x00,             /* Status Vector Chunk. */
+        /* Recv deltas follow. */
+    };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    for( symbolSize = 1; symbolSize <= 2; symbolSize++ )
+    {
+        twccPacketPayload[ 11 ] = ( symbolSize == 1 ) ? 14 : 7;
+
+        for( symbolList = 0; symbolList <= 0x3FFF; symbolList++ )
+        {
+            receiveDeltaLength = 0;
+
+            for( i = 0; i < 14 / symbolSize; i++ )
+            {
+                symbol = ( uint16_t ) ( ( symbolList >> ( 14 - ( ( i + 1 ) * symbolSize ) ) ) & ( ( 1U << symbolSize ) - 1U ) );
+                receiveDeltaLength += ( symbol == 3 ) ? 0 : symbol;
+            }
+
+            packetChunk = ( uint16_t ) ( 0x8000 | ( ( symbolSize == 2 ) ? 0x4000 : 0 ) | symbolList );
+            twccPacketPayload[ 16 ] = ( uint8_t ) ( packetChunk >> 8 );
+            twccPacketPayload[ 17 ] = ( uint8_t ) packetChunk;
+
+            rtcpTwccPacket.pArrivalInfoList = NULL;
+            rtcpTwccPacket.arrivalInfoListLength = 0;
+            rtcpPacket.payloadLength = 18 + receiveDeltaLength;
+
+            result = Rtcp_ParseTwccPacket( &( context ),
+                                           &( rtcpPacket ),
+                                           &( rtcpTwccPacket ) );
+
+            TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                               result );
+
+            if( receiveDeltaLength > 0 )
+            {
+                rtcpPacket.payloadLength = 18 + receiveDeltaLength - 1;
+
+                result = Rtcp_ParseTwccPacket( &( context ),
+                                               &( rtcpPacket ),
+                                               &( rtcpTwccPacket ) );
+
+                TEST_ASSERT_EQUAL( RTCP_RESULT_MALFORMED_PACKET,
+                                   result );
+            }
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Parse Twcc Packet Runs fail functionality for Bad Parameters.
+ */
+void test_rtcpParseTwccPacketRuns_BadParams( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpTwccRunsPacket_t rtcpTwccRunsPacket;
+    RtcpResult_t result;
+    uint8_t twccPacketPayload[ 18 ] = { 0 };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    result = Rtcp_ParseTwccPacketRuns( NULL,
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       NULL,
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       NULL );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    rtcpPacket.pPayload = NULL;
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload ) - 1;
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_NACK;
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Parse Twcc Packet Runs functionality.
+ */
+void test_rtcpParseTwccPacketRuns( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpTwccRunsPacket_t rtcpTwccRunsPacket;
+    TwccPacketRun_t runList[ 4 ];
+    uint64_t arrivalTimeList[ 7 ];
+    RtcpResult_t result;
+    size_t i;
+    uint8_t twccPacketPayload[] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0x00, 0x10,             /* Base Sequence Number. */
+        0x00, 0x1E,             /* Packet Status Count. */
+        0x00, 0x00, 0x00, 0x02, /* Reference Time (0), Feedback Packet Count (2). */
+        0x20, 0x03,             /* Packet Status (Small Delta), Run Length Chunk. */
+        0xB0, 0x03,             /* Status Vector Chunk (1 1 0 0 0 0 0 0 0 0 0 0 1 1). */
+        0x00, 0x0D,             /* Packet Status (Not Received), Run Length Chunk. */
+        /* Recv delta. */
+        0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04
+    };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    /* Count only. */
+    rtcpTwccRunsPacket.pRunList = NULL;
+    rtcpTwccRunsPacket.runListLength = 0;
+    rtcpTwccRunsPacket.pArrivalTimeList = NULL;
+    rtcpTwccRunsPacket.arrivalTimeListLength = 0;
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 4,
+                       rtcpTwccRunsPacket.runListLength );
+    TEST_ASSERT_EQUAL( 7,
+                       rtcpTwccRunsPacket.arrivalTimeListLength );
+
+    rtcpTwccRunsPacket.pRunList = &( runList[ 0 ] );
+    rtcpTwccRunsPacket.runListLength = 4;
+    rtcpTwccRunsPacket.pArrivalTimeList = &( arrivalTimeList[ 0 ] );
+    rtcpTwccRunsPacket.arrivalTimeListLength = 7;
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0x12345678,
+                       rtcpTwccRunsPacket.senderSsrc );
+    TEST_ASSERT_EQUAL( 0x9ABCDEF0,
+                       rtcpTwccRunsPacket.mediaSourceSsrc );
+    TEST_ASSERT_EQUAL( 0x0010,
+                       rtcpTwccRunsPacket.baseSeqNum );
+    TEST_ASSERT_EQUAL( 30,
+                       rtcpTwccRunsPacket.packetStatusCount );
+    TEST_ASSERT_EQUAL( 2,
+                       rtcpTwccRunsPacket.feedbackPacketCount );
+    TEST_ASSERT_EQUAL( 4,
+                       rtcpTwccRunsPacket.runListLength );
+
+    TEST_ASSERT_EQUAL( 0x0010,
+                       runList[ 0 ].startSeqNum );
+    TEST_ASSERT_EQUAL( 5,
+                       runList[ 0 ].length );
+    TEST_ASSERT_EQUAL( 1,
+                       runList[ 0 ].received );
+    TEST_ASSERT_EQUAL( 0x0015,
+                       runList[ 1 ].startSeqNum );
+    TEST_ASSERT_EQUAL( 10,
+                       runList[ 1 ].length );
+    TEST_ASSERT_EQUAL( 0,
+                       runList[ 1 ].received );
+    TEST_ASSERT_EQUAL( 0x001F,
+                       runList[ 2 ].startSeqNum );
+    TEST_ASSERT_EQUAL( 2,
+                       runList[ 2 ].length );
+    TEST_ASSERT_EQUAL( 1,
+                       runList[ 2 ].received );
+    TEST_ASSERT_EQUAL( 0x0021,
+                       runList[ 3 ].startSeqNum );
+    TEST_ASSERT_EQUAL( 13,
+                       runList[ 3 ].length );
+    TEST_ASSERT_EQUAL( 0,
+                       runList[ 3 ].received );
+
+    TEST_ASSERT_EQUAL( 7,
+                       rtcpTwccRunsPacket.arrivalTimeListLength );
+
+    for( i = 0; i < 7; i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT64( ( i + 1 ) * 10000,
+                                  arrivalTimeList[ i ] );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Parse Twcc Packet Runs functionality for Out of Memory
+ * and Malformed Packet.
+ */
+void test_rtcpParseTwccPacketRuns_OutOfMemory_Malformed( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpTwccRunsPacket_t rtcpTwccRunsPacket;
+    TwccPacketRun_t runList[ 4 ];
+    uint64_t arrivalTimeList[ 7 ];
+    RtcpResult_t result;
+    uint8_t twccPacketPayload[] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0x00, 0x10,             /* Base Sequence Number. */
+        0x00, 0x1E,             /* Packet Status Count. */
+        0x00, 0x00, 0x00, 0x02, /* Reference Time (0), Feedback Packet Count (2). */
+        0x20, 0x03,             /* Packet Status (Small Delta), Run Length Chunk. */
+        0xB0, 0x03,             /* Status Vector Chunk (1 1 0 0 0 0 0 0 0 0 0 0 1 1). */
+        0x00, 0x0D,             /* Packet Status (Not Received), Run Length Chunk. */
+        /* Recv delta. */
+        0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04
+    };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    /* One run short. */
+    rtcpTwccRunsPacket.pRunList = &( runList[ 0 ] );
+    rtcpTwccRunsPacket.runListLength = 3;
+    rtcpTwccRunsPacket.pArrivalTimeList = &( arrivalTimeList[ 0 ] );
+    rtcpTwccRunsPacket.arrivalTimeListLength = 7;
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    /* One arrival time short. */
+    rtcpTwccRunsPacket.runListLength = 4;
+    rtcpTwccRunsPacket.arrivalTimeListLength = 6;
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    /* Out of arrival times in the middle of the Status Vector Chunk. */
+    rtcpTwccRunsPacket.runListLength = 4;
+    rtcpTwccRunsPacket.arrivalTimeListLength = 4;
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    /* Out of arrival times in the Run Length Chunk. */
+    rtcpTwccRunsPacket.runListLength = 4;
+    rtcpTwccRunsPacket.arrivalTimeListLength = 2;
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    /* One receive delta short. */
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload ) - 1;
+    rtcpTwccRunsPacket.runListLength = 4;
+    rtcpTwccRunsPacket.arrivalTimeListLength = 7;
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_MALFORMED_PACKET,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that RTCP Parse Twcc Packet resolves the arrival times of
+ * the arrival infos which fit on Out of Memory.
+ */
+void test_rtcpParseTwccPacket_OutOfMemory_PartialList( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    PacketArrivalInfo_t packetArrivalInfo[ 6 ];
+    RtcpTwccPacket_t rtcpTwccPacket;
+    RtcpResult_t result;
+    size_t i;
+    uint64_t expectedArrivalTimes[ 6 ] =
+    {
+        650000, 660000, 670000, 690000,
+        RTCP_TWCC_PACKET_LOST_TIME, 692500
+    };
+    uint8_t twccPacketPayload[] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0xFF, 0xFE,             /* Base Sequence Number. */
+        0x00, 0x0A,             /* Packet Status Count. */
+        0x00, 0x00, 0x01, 0x02, /* Reference Time (1 * 64ms), Feedback Packet Count (2). */
+        0x20, 0x03,             /* Packet Status (Small Delta), Run Length Chunk. */
+        0xA8, 0x80,             /* Status Vector Chunk (1 0 1 0 0 0 1). */
+        /* Recv delta. */
+        0x04, 0x04, 0x04,
+        0x08, 0x01, 0x02
+    };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    /* The list ends in the middle of the Status Vector Chunk. */
+    rtcpTwccPacket.pArrivalInfoList = &( packetArrivalInfo[ 0 ] );
+    rtcpTwccPacket.arrivalInfoListLength = 6;
+
+    result = Rtcp_ParseTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OUT_OF_MEMORY,
+                       result );
+    TEST_ASSERT_EQUAL( 6,
+                       rtcpTwccPacket.arrivalInfoListLength );
+
+    for( i = 0; i < 6; i++ )
+    {
+        TEST_ASSERT_EQUAL( ( uint16_t ) ( 0xFFFE + i ),
+                           rtcpTwccPacket.pArrivalInfoList[ i ].seqNum );
+        TEST_ASSERT_EQUAL_UINT64( expectedArrivalTimes[ i ],
+                                  rtcpTwccPacket.pArrivalInfoList[ i ].remoteArrivalTime );
+    }
+
+    /* The list ends in the middle of the Run Length Chunk. */
+    rtcpTwccPacket.arrivalInfoListLength = 2;
+
+    result = Rtcp_ParseTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OUT_OF_MEMORY,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       rtcpTwccPacket.arrivalInfoListLength );
+
+    for( i = 0; i < 2; i++ )
+    {
+        TEST_ASSERT_EQUAL( ( uint16_t ) ( 0xFFFE + i ),
+                           rtcpTwccPacket.pArrivalInfoList[ i ].seqNum );
+        TEST_ASSERT_EQUAL_UINT64( expectedArrivalTimes[ i ],
+                                  rtcpTwccPacket.pArrivalInfoList[ i ].remoteArrivalTime );
+    }
+
+    /* A malformed packet is reported as such, even when out of memory. */
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload ) - 1;
+    rtcpTwccPacket.arrivalInfoListLength = 2;
+
+    result = Rtcp_ParseTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_MALFORMED_PACKET,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Parse Twcc Packet Runs functionality for an empty Run
+ * Length Chunk and for fewer packet chunks than the packet status count.
+ */
+void test_rtcpParseTwccPacketRuns_EmptyRunAndShortPacket( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpTwccRunsPacket_t rtcpTwccRunsPacket;
+    TwccPacketRun_t runList[ 2 ];
+    uint64_t arrivalTimeList[ 2 ];
+    RtcpResult_t result;
+    uint8_t twccPacketPayload[] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0x00, 0x10,             /* Base Sequence Number. */
+        0x00, 0x08,             /* Packet Status Count. */
+        0x00, 0x00, 0x00, 0x02, /* Reference Time (0), Feedback Packet Count (2). */
+        0x00, 0x01,             /* Packet Status (Not Received), Run Length Chunk. */
+        0x20, 0x00,             /* Packet Status (Small Delta), empty Run Length Chunk. */
+        0x00, 0x01              /* Packet Status (Not Received), Run Length Chunk. */
+    };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    rtcpTwccRunsPacket.pRunList = &( runList[ 0 ] );
+    rtcpTwccRunsPacket.runListLength = 2;
+    rtcpTwccRunsPacket.pArrivalTimeList = &( arrivalTimeList[ 0 ] );
+    rtcpTwccRunsPacket.arrivalTimeListLength = 2;
+
+    /* The packet chunks run out before the packet status count. The empty
+     * run does not split the packets which were not received. */
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1,
+                       rtcpTwccRunsPacket.runListLength );
+    TEST_ASSERT_EQUAL( 0x0010,
+                       runList[ 0 ].startSeqNum );
+    TEST_ASSERT_EQUAL( 2,
+                       runList[ 0 ].length );
+    TEST_ASSERT_EQUAL( 0,
+                       runList[ 0 ].received );
+    TEST_ASSERT_EQUAL( 0,
+                       rtcpTwccRunsPacket.arrivalTimeListLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that RTCP Parse Twcc Packet Runs splits a run which would
+ * be longer than UINT16_MAX packets.
+ */
+void test_rtcpParseTwccPacketRuns_LongRun( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpTwccRunsPacket_t rtcpTwccRunsPacket;
+    TwccPacketRun_t runList[ 2 ];
+    RtcpResult_t result;
+    uint8_t twccPacketPayload[] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0x00, 0x00,             /* Base Sequence Number. */
+        0xFF, 0xFF,             /* Packet Status Count. */
+        0x00, 0x00, 0x00, 0x02, /* Reference Time (0), Feedback Packet Count (2). */
+        /* 9x Packet Status (Not Received), Run Length Chunk (8191). */
+        0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF,
+        0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF,
+        0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF
+    };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    /* Count only. 8 chunks are merged, the 9th does not fit. */
+    rtcpTwccRunsPacket.pRunList = NULL;
+    rtcpTwccRunsPacket.runListLength = 0;
+    rtcpTwccRunsPacket.pArrivalTimeList = NULL;
+    rtcpTwccRunsPacket.arrivalTimeListLength = 0;
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       rtcpTwccRunsPacket.runListLength );
+    TEST_ASSERT_EQUAL( 0,
+                       rtcpTwccRunsPacket.arrivalTimeListLength );
+
+    rtcpTwccRunsPacket.pRunList = &( runList[ 0 ] );
+    rtcpTwccRunsPacket.runListLength = 2;
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       rtcpTwccRunsPacket.runListLength );
+    TEST_ASSERT_EQUAL( 0,
+                       runList[ 0 ].startSeqNum );
+    TEST_ASSERT_EQUAL( 8 * 8191,
+                       runList[ 0 ].length );
+    TEST_ASSERT_EQUAL( 0,
+                       runList[ 0 ].received );
+    TEST_ASSERT_EQUAL( 8 * 8191,
+                       runList[ 1 ].startSeqNum );
+    TEST_ASSERT_EQUAL( 8191,
+                       runList[ 1 ].length );
+    TEST_ASSERT_EQUAL( 0,
+                       runList[ 1 ].received );
+
+    /* The second run does not fit. */
+    rtcpTwccRunsPacket.runListLength = 1;
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OUT_OF_MEMORY,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Parse Twcc Packet Runs functionality for a two bit
+ * Status Vector Chunk with a large delta, which covers fewer packets than
+ * its symbols.
+ */
+void test_rtcpParseTwccPacketRuns_LargeDeltaStatusVector( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpTwccRunsPacket_t rtcpTwccRunsPacket;
+    TwccPacketRun_t runList[ 2 ];
+    uint64_t arrivalTimeList[ 2 ];
+    RtcpResult_t result;
+    uint8_t twccPacketPayload[] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0x00, 0x01,             /* Base Sequence Number. */
+        0x00, 0x03,             /* Packet Status Count. */
+        0x00, 0x00, 0x00, 0x02, /* Reference Time (0), Feedback Packet Count (2). */
+        0xD8, 0x40,             /* Status Vector Chunk (1 2 0 1 0 0 0), past the count from the 4th. */
+        /* Recv delta. */
+        0x04, 0x01, 0x00
+    };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    rtcpTwccRunsPacket.pRunList = &( runList[ 0 ] );
+    rtcpTwccRunsPacket.runListLength = 2;
+    rtcpTwccRunsPacket.pArrivalTimeList = &( arrivalTimeList[ 0 ] );
+    rtcpTwccRunsPacket.arrivalTimeListLength = 2;
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       rtcpTwccRunsPacket.runListLength );
+    TEST_ASSERT_EQUAL( 1,
+                       runList[ 0 ].startSeqNum );
+    TEST_ASSERT_EQUAL( 2,
+                       runList[ 0 ].length );
+    TEST_ASSERT_EQUAL( 1,
+                       runList[ 0 ].received );
+    TEST_ASSERT_EQUAL( 3,
+                       runList[ 1 ].startSeqNum );
+    TEST_ASSERT_EQUAL( 1,
+                       runList[ 1 ].length );
+    TEST_ASSERT_EQUAL( 0,
+                       runList[ 1 ].received );
+    TEST_ASSERT_EQUAL( 2,
+                       rtcpTwccRunsPacket.arrivalTimeListLength );
+    TEST_ASSERT_EQUAL_UINT64( 10000,
+                              arrivalTimeList[ 0 ] );
+    TEST_ASSERT_EQUAL_UINT64( 650000,
+                              arrivalTimeList[ 1 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+typedef struct VisitedArrivalInfos
+{
+    PacketArrivalInfo_t arrivalInfoList[ 64 ];
+    size_t arrivalInfoListLength;
+    size_t numBatches;
+} VisitedArrivalInfos_t;
+
+static void CollectArrivalInfos( void * pUserData,
+                                 const PacketArrivalInfo_t * pArrivalInfos,
+                                 size_t arrivalInfosLength )
+{
+    VisitedArrivalInfos_t * pVisited = ( VisitedArrivalInfos_t * ) pUserData;
+    size_t i;
+
+    for( i = 0; ( i < arrivalInfosLength ) && ( pVisited->arrivalInfoListLength < 64 ); i++ )
+    {
+        pVisited->arrivalInfoList[ pVisited->arrivalInfoListLength ] = pArrivalInfos[ i ];
+        pVisited->arrivalInfoListLength += 1;
+    }
+
+    pVisited->numBatches += 1;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Visit Twcc Packet fail functionality for Bad Parameters.
+ */
+void test_rtcpVisitTwccPacket_BadParams( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpTwccPacket_t rtcpTwccPacket;
+    VisitedArrivalInfos_t visited = { 0 };
+    RtcpResult_t result;
+    uint8_t twccPacketPayload[ 18 ] = { 0 };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    result = Rtcp_VisitTwccPacket( NULL,
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ),
+                                   CollectArrivalInfos,
+                                   &( visited ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtcp_VisitTwccPacket( &( context ),
+                                   NULL,
+                                   &( rtcpTwccPacket ),
+                                   CollectArrivalInfos,
+                                   &( visited ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtcp_VisitTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   NULL,
+                                   CollectArrivalInfos,
+                                   &( visited ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtcp_VisitTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ),
+                                   NULL,
+                                   &( visited ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    rtcpPacket.pPayload = NULL;
+
+    result = Rtcp_VisitTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ),
+                                   CollectArrivalInfos,
+                                   &( visited ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload ) - 1;
+
+    result = Rtcp_VisitTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ),
+                                   CollectArrivalInfos,
+                                   &( visited ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_NACK;
+
+    result = Rtcp_VisitTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ),
+                                   CollectArrivalInfos,
+                                   &( visited ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       visited.numBatches );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that RTCP Visit Twcc Packet visits the same arrival infos as
+ * RTCP Parse Twcc Packet gives, in batches.
+ */
+void test_rtcpVisitTwccPacket( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpTwccPacket_t rtcpTwccPacket;
+    PacketArrivalInfo_t packetArrivalInfo[ 64 ];
+    VisitedArrivalInfos_t visited = { 0 };
+    RtcpResult_t result;
+    size_t i;
+    uint8_t twccPacketPayload[ 18 + 4 + 40 + 2 + 2 ] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0xFF, 0xF0,             /* Base Sequence Number. */
+        0x00, 0x35,             /* Packet Status Count (53). */
+        0x00, 0x00, 0x01, 0x02, /* Reference Time (1 * 64ms), Feedback Packet Count (2). */
+        0x20, 0x28,             /* Packet Status (Small Delta), Run Length Chunk (40). */
+        0xD9, 0x00,             /* Status Vector Chunk (01 10 01 00 00 00 00). */
+        0x00, 0x06              /* Packet Status (Not Received), Run Length Chunk (6). */
+        /* Recv deltas are filled in below. */
+    };
+
+    for( i = 0; i < 40; i++ )
+    {
+        twccPacketPayload[ 22 + i ] = ( uint8_t ) ( i + 1 );
+    }
+
+    twccPacketPayload[ 62 ] = 0x01; /* Large delta. */
+    twccPacketPayload[ 63 ] = 0x00;
+    twccPacketPayload[ 64 ] = 0x03;
+    twccPacketPayload[ 65 ] = 0x04;
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    rtcpTwccPacket.pArrivalInfoList = &( packetArrivalInfo[ 0 ] );
+    rtcpTwccPacket.arrivalInfoListLength = 64;
+
+    result = Rtcp_ParseTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 53,
+                       rtcpTwccPacket.arrivalInfoListLength );
+
+    result = Rtcp_VisitTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ),
+                                   CollectArrivalInfos,
+                                   &( visited ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_PTR( &( packetArrivalInfo[ 0 ] ),
+                           rtcpTwccPacket.pArrivalInfoList );
+    TEST_ASSERT_EQUAL( 0xFFF0,
+                       rtcpTwccPacket.baseSeqNum );
+    TEST_ASSERT_EQUAL( 53,
+                       rtcpTwccPacket.arrivalInfoListLength );
+    TEST_ASSERT_EQUAL( 53,
+                       visited.arrivalInfoListLength );
+    TEST_ASSERT_EQUAL( ( 53 + RTCP_TWCC_VISITOR_BATCH_LENGTH - 1 ) / RTCP_TWCC_VISITOR_BATCH_LENGTH,
+                       visited.numBatches );
+
+    for( i = 0; i < 53; i++ )
+    {
+        TEST_ASSERT_EQUAL( packetArrivalInfo[ i ].seqNum,
+                           visited.arrivalInfoList[ i ].seqNum );
+        TEST_ASSERT_EQUAL_UINT64( packetArrivalInfo[ i ].remoteArrivalTime,
+                                  visited.arrivalInfoList[ i ].remoteArrivalTime );
+    }
+
+    /* One receive delta short - the visitor is not called. */
+    visited.arrivalInfoListLength = 0;
+    visited.numBatches = 0;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload ) - 1;
+
+    result = Rtcp_VisitTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ),
+                                   CollectArrivalInfos,
+                                   &( visited ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_MALFORMED_PACKET,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       visited.numBatches );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that RTCP Visit Twcc Packet visits a 1 bit Status Vector
+ * Chunk, and calls the visitor once when the arrival infos fill exactly one
+ * batch.
+ */
+void test_rtcpVisitTwccPacket_OneBitStatusVector_FullBatch( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpTwccPacket_t rtcpTwccPacket;
+    PacketArrivalInfo_t packetArrivalInfo[ RTCP_TWCC_VISITOR_BATCH_LENGTH ];
+    VisitedArrivalInfos_t visited = { 0 };
+    RtcpResult_t result;
+    size_t i;
+    uint8_t twccPacketPayload[] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0x00, 0x10,             /* Base Sequence Number. */
+        0x00, 0x20,             /* Packet Status Count (32). */
+        0x00, 0x00, 0x01, 0x02, /* Reference Time (1 * 64ms), Feedback Packet Count (2). */
+        0xA8, 0x01,             /* Status Vector Chunk (1 0 1 0 0 0 0 0 0 0 0 0 0 1). */
+        0x00, 0x12,             /* Packet Status (Not Received), Run Length Chunk (18). */
+        /* Recv delta. */
+        0x04, 0x04, 0x04
+    };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    rtcpTwccPacket.pArrivalInfoList = &( packetArrivalInfo[ 0 ] );
+    rtcpTwccPacket.arrivalInfoListLength = RTCP_TWCC_VISITOR_BATCH_LENGTH;
+
+    result = Rtcp_ParseTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 32,
+                       rtcpTwccPacket.arrivalInfoListLength );
+
+    result = Rtcp_VisitTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ),
+                                   CollectArrivalInfos,
+                                   &( visited ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 32,
+                       visited.arrivalInfoListLength );
+    TEST_ASSERT_EQUAL( 32 / RTCP_TWCC_VISITOR_BATCH_LENGTH,
+                       visited.numBatches );
+
+    for( i = 0; i < 32; i++ )
+    {
+        TEST_ASSERT_EQUAL( packetArrivalInfo[ i ].seqNum,
+                           visited.arrivalInfoList[ i ].seqNum );
+        TEST_ASSERT_EQUAL_UINT64( packetArrivalInfo[ i ].remoteArrivalTime,
+                                  visited.arrivalInfoList[ i ].remoteArrivalTime );
+    }
+
+    TEST_ASSERT_EQUAL_UINT64( 650000,
+                              visited.arrivalInfoList[ 0 ].remoteArrivalTime );
+    TEST_ASSERT_EQUAL_UINT64( RTCP_TWCC_PACKET_LOST_TIME,
+                              visited.arrivalInfoList[ 1 ].remoteArrivalTime );
+    TEST_ASSERT_EQUAL_UINT64( 670000,
+                              visited.arrivalInfoList[ 13 ].remoteArrivalTime );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that RTCP Parse Twcc Packet, RTCP Parse Twcc Packet Runs
+ * and RTCP Visit Twcc Packet give the same packets when the last run is
+ * longer than the packet status count.
+ */
+void test_rtcpParseTwccPacket_RunPastStatusCount_CrossCheck( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    PacketArrivalInfo_t packetArrivalInfo[ 8 ];
+    RtcpTwccPacket_t rtcpTwccPacket;
+    RtcpTwccRunsPacket_t rtcpTwccRunsPacket;
+    TwccPacketRun_t runList[ 4 ];
+    uint64_t arrivalTimeList[ 8 ];
+    VisitedArrivalInfos_t visited = { 0 };
+    RtcpResult_t result;
+    size_t i, j, packetIndex = 0, arrivalTimeIndex = 0;
+    uint8_t twccPacketPayload[] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0xFF, 0xFD,             /* Base Sequence Number. */
+        0x00, 0x04,             /* Packet Status Count. */
+        0x00, 0x00, 0x01, 0x02, /* Reference Time (1 * 64ms), Feedback Packet Count (2). */
+        0x00, 0x02,             /* Packet Status (Not Received), Run Length Chunk. */
+        0x20, 0x05,             /* Packet Status (Small Delta), Run Length Chunk. */
+        /* Recv delta, for the whole run. */
+        0x04, 0x04, 0x04, 0x04, 0x04
+    };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    rtcpTwccPacket.pArrivalInfoList = &( packetArrivalInfo[ 0 ] );
+    rtcpTwccPacket.arrivalInfoListLength = 8;
+
+    result = Rtcp_ParseTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 7,
+                       rtcpTwccPacket.arrivalInfoListLength );
+
+    rtcpTwccRunsPacket.pRunList = &( runList[ 0 ] );
+    rtcpTwccRunsPacket.runListLength = 4;
+    rtcpTwccRunsPacket.pArrivalTimeList = &( arrivalTimeList[ 0 ] );
+    rtcpTwccRunsPacket.arrivalTimeListLength = 8;
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       rtcpTwccRunsPacket.runListLength );
+    TEST_ASSERT_EQUAL( 5,
+                       rtcpTwccRunsPacket.arrivalTimeListLength );
+
+    result = Rtcp_VisitTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ),
+                                   CollectArrivalInfos,
+                                   &( visited ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 7,
+                       visited.arrivalInfoListLength );
+
+    /* Expand the runs and compare them with the arrival infos. */
+    for( i = 0; i < rtcpTwccRunsPacket.runListLength; i++ )
+    {
+        for( j = 0; j < runList[ i ].length; j++ )
+        {
+            TEST_ASSERT_EQUAL( ( uint16_t ) ( runList[ i ].startSeqNum + j ),
+                               packetArrivalInfo[ packetIndex ].seqNum );
+            TEST_ASSERT_EQUAL( packetArrivalInfo[ packetIndex ].seqNum,
+                               visited.arrivalInfoList[ packetIndex ].seqNum );
+            TEST_ASSERT_EQUAL_UINT64( packetArrivalInfo[ packetIndex ].remoteArrivalTime,
+                                      visited.arrivalInfoList[ packetIndex ].remoteArrivalTime );
+
+            if( runList[ i ].received != 0 )
+            {
+                TEST_ASSERT_EQUAL_UINT64( arrivalTimeList[ arrivalTimeIndex ],
+                                          packetArrivalInfo[ packetIndex ].remoteArrivalTime );
+                arrivalTimeIndex += 1;
+            }
+            else
+            {
+                TEST_ASSERT_EQUAL_UINT64( RTCP_TWCC_PACKET_LOST_TIME,
+                                          packetArrivalInfo[ packetIndex ].remoteArrivalTime );
+            }
+
+            packetIndex += 1;
+        }
+    }
+
+    TEST_ASSERT_EQUAL( 7,
+                       packetIndex );
+    TEST_ASSERT_EQUAL( 5,
+                       arrivalTimeIndex );
+    TEST_ASSERT_EQUAL_UINT64( 650000,
+                              arrivalTimeList[ 0 ] );
+    TEST_ASSERT_EQUAL_UINT64( 690000,
+                              arrivalTimeList[ 4 ] );
+
+    /* The receive deltas of the whole run are needed. */
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload ) - 1;
+    rtcpTwccPacket.arrivalInfoListLength = 8;
+    rtcpTwccRunsPacket.runListLength = 4;
+    rtcpTwccRunsPacket.arrivalTimeListLength = 8;
+
+    result = Rtcp_ParseTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_MALFORMED_PACKET,
+                       result );
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_MALFORMED_PACKET,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Parse Twcc Packet arrival times with a negative large
+ * delta and the largest reference time.
+ */
+void test_rtcpParseTwccPacket_NegativeLargeDelta( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    PacketArrivalInfo_t packetArrivalInfo[ 3 ];
+    RtcpTwccPacket_t rtcpTwccPacket;
+    RtcpTwccRunsPacket_t rtcpTwccRunsPacket;
+    TwccPacketRun_t runList[ 1 ];
+    uint64_t arrivalTimeList[ 3 ];
+    RtcpResult_t result;
+    uint64_t referenceTime = 0xFFFFFFULL * 640000ULL; /* 64ms units, in 100s of nanoseconds. */
+    uint8_t twccPacketPayload[] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0x00, 0x01,             /* Base Sequence Number. */
+        0x00, 0x03,             /* Packet Status Count. */
+        0xFF, 0xFF, 0xFF, 0x02, /* Reference Time (0xFFFFFF), Feedback Packet Count (2). */
+        0xE6, 0x00,             /* Status Vector Chunk (10 01 10). */
+        /* Recv delta. */
+        0xFF, 0xFC,             /* -4 * 250us = -1ms. */
+        0xFF,                   /* 255 * 250us = 63.75ms. */
+        0x00, 0x01              /* 1 * 250us = 0.25ms. */
+    };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = twccPacketPayload;
+    rtcpPacket.payloadLength = sizeof( twccPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    rtcpTwccPacket.pArrivalInfoList = &( packetArrivalInfo[ 0 ] );
+    rtcpTwccPacket.arrivalInfoListLength = 3;
+
+    result = Rtcp_ParseTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpTwccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0xFFFFFF,
+                       rtcpTwccPacket.referenceTime );
+    TEST_ASSERT_EQUAL_UINT64( referenceTime - 10000,
+                              packetArrivalInfo[ 0 ].remoteArrivalTime );
+    TEST_ASSERT_EQUAL_UINT64( referenceTime + 627500,
+                              packetArrivalInfo[ 1 ].remoteArrivalTime );
+    TEST_ASSERT_EQUAL_UINT64( referenceTime + 630000,
+                              packetArrivalInfo[ 2 ].remoteArrivalTime );
+
+    rtcpTwccRunsPacket.pRunList = &( runList[ 0 ] );
+    rtcpTwccRunsPacket.runListLength = 1;
+    rtcpTwccRunsPacket.pArrivalTimeList = &( arrivalTimeList[ 0 ] );
+    rtcpTwccRunsPacket.arrivalTimeListLength = 3;
+
+    result = Rtcp_ParseTwccPacketRuns( &( context ),
+                                       &( rtcpPacket ),
+                                       &( rtcpTwccRunsPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( referenceTime - 10000,
+                              arrivalTimeList[ 0 ] );
+    TEST_ASSERT_EQUAL_UINT64( referenceTime + 627500,
+                              arrivalTimeList[ 1 ] );
+    TEST_ASSERT_EQUAL_UINT64( referenceTime + 630000,
+                              arrivalTimeList[ 2 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Serialize Twcc Packet fail functionality for Bad
+ * Parameters.
+ */
+void test_rtcpSerializeTwccPacket_BadParams( void )
+{
+    RtcpContext_t context;
+    RtcpTwccPacket_t twccPacket = { 0 };
+    PacketArrivalInfo_t arrivalInfoList[ 2 ];
+    uint8_t buffer[ 64 ];
+    size_t bufferLength = sizeof( buffer );
+    RtcpResult_t result;
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+    twccPacket.arrivalInfoListLength = 2;
+
+    result = Rtcp_SerializeTwccPacket( NULL,
+                                       &( twccPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtcp_SerializeTwccPacket( &( context ),
+                                       NULL,
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtcp_SerializeTwccPacket( &( context ),
+                                       &( twccPacket ),
+                                       NULL,
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtcp_SerializeTwccPacket( &( context ),
+                                       &( twccPacket ),
+                                       &( buffer[ 0 ] ),
+                                       NULL );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    twccPacket.pArrivalInfoList = NULL;
+
+    result = Rtcp_SerializeTwccPacket( &( context ),
+                                       &( twccPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    /* More packets than the packet status count can hold. */
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+    twccPacket.arrivalInfoListLength = UINT16_MAX + 1;
+
+    result = Rtcp_SerializeTwccPacket( &( context ),
+                                       &( twccPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    twccPacket.arrivalInfoListLength = 0;
+
+    result = Rtcp_SerializeTwccPacket( &( context ),
+                                       &( twccPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    /* Packets more than 8 seconds apart. */
+    twccPacket.referenceTime = 0;
+    twccPacket.arrivalInfoListLength = 2;
+    arrivalInfoList[ 0 ].remoteArrivalTime = 0;
+    arrivalInfoList[ 1 ].remoteArrivalTime = 9 * RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND;
+
+    result = Rtcp_SerializeTwccPacket( &( context ),
+                                       &( twccPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    /* A packet more than 8 seconds before the previous one. The reference
+     * time is 140 * 64ms = 8.96 seconds. */
+    twccPacket.referenceTime = 140;
+    arrivalInfoList[ 0 ].remoteArrivalTime = 9 * RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND;
+    arrivalInfoList[ 1 ].remoteArrivalTime = 0;
+
+    result = Rtcp_SerializeTwccPacket( &( context ),
+                                       &( twccPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Serialize Twcc Packet fail functionality for small
+ * buffers.
+ */
+void test_rtcpSerializeTwccPacket_SmallBuffer( void )
+{
+    RtcpContext_t context;
+    RtcpTwccPacket_t twccPacket = { 0 };
+    PacketArrivalInfo_t arrivalInfoList[ 16 ];
+    uint8_t buffer[ 64 ];
+    size_t bufferLength, i;
+    RtcpResult_t result;
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    /* One large delta, then alternately received and not received, which
+     * takes 2 chunks and 9 receive delta bytes, padded to 36 bytes. */
+    for( i = 0; i < 16; i++ )
+    {
+        arrivalInfoList[ i ].remoteArrivalTime = ( ( i % 2 ) == 0 ) ? ( 1000 + i ) * 2500 : RTCP_TWCC_PACKET_LOST_TIME;
+    }
+
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+    twccPacket.arrivalInfoListLength = 16;
+
+    for( bufferLength = 0; bufferLength < 36; bufferLength++ )
+    {
+        result = Rtcp_SerializeTwccPacket( &( context ),
+                                           &( twccPacket ),
+                                           &( buffer[ 0 ] ),
+                                           &( bufferLength ) );
+
+        TEST_ASSERT_EQUAL( RTCP_RESULT_OUT_OF_MEMORY,
+                           result );
+    }
+
+    result = Rtcp_SerializeTwccPacket( &( context ),
+                                       &( twccPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 36,
+                       bufferLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Serialize Twcc Packet functionality.
+ */
+void test_rtcpSerializeTwccPacket( void )
+{
+    RtcpContext_t context;
+    RtcpTwccPacket_t twccPacket = { 0 };
+    PacketArrivalInfo_t arrivalInfoList[ 41 ];
+    uint8_t buffer[ 128 ];
+    size_t bufferLength = sizeof( buffer ), i;
+    RtcpResult_t result;
+    uint8_t expectedPacket[] =
+    {
+        0x8F, 0xCD, 0x00, 0x0E, /* Header: V=2, P=0, FMT=15, PT=205, Length = 14 words. */
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0x00, 0x0A,             /* Base Sequence Number. */
+        0x00, 0x29,             /* Packet Status Count = 41. */
+        0x00, 0x00, 0x01, 0x05, /* Reference Time = 1, Feedback Packet Count = 5. */
+        0x20, 0x14,             /* Run Length Chunk: 20 small deltas. */
+        0x95, 0x55,             /* Status Vector Chunk, 1 bit: 7 times not received, received. */
+        0xD2, 0x42,             /* Status Vector Chunk, 2 bit: 01 00 10 01 00 00 10. */
+        /* Recv delta. */
+        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+        0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+        0x01,
+        0x01, 0x2C,             /* 300 ticks. */
+        0x02,
+        0xFF, 0xFF,             /* -1 tick. */
+        0x00                    /* Zero padding. */
+    };
+    uint32_t ticks = 256;
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    for( i = 0; i < 41; i++ )
+    {
+        arrivalInfoList[ i ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+    }
+
+    for( i = 0; i < 20; i++ )
+    {
+        ticks += 1;
+        arrivalInfoList[ i ].remoteArrivalTime = ticks * 2500ULL;
+    }
+
+    for( i = 21; i < 34; i += 2 )
+    {
+        ticks += 2;
+        arrivalInfoList[ i ].remoteArrivalTime = ticks * 2500ULL;
+    }
+
+    arrivalInfoList[ 34 ].remoteArrivalTime = ( ticks + 1 ) * 2500ULL;
+    arrivalInfoList[ 36 ].remoteArrivalTime = ( ticks + 301 ) * 2500ULL;
+    arrivalInfoList[ 37 ].remoteArrivalTime = ( ticks + 303 ) * 2500ULL;
+    arrivalInfoList[ 40 ].remoteArrivalTime = ( ticks + 302 ) * 2500ULL;
+
+    twccPacket.senderSsrc = 0x12345678;
+    twccPacket.mediaSourceSsrc = 0x9ABCDEF0;
+    twccPacket.baseSeqNum = 10;
+    twccPacket.referenceTime = 1;
+    twccPacket.feedbackPacketCount = 5;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+    twccPacket.arrivalInfoListLength = 41;
+
+    result = Rtcp_SerializeTwccPacket( &( context ),
+                                       &( twccPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedPacket ),
+                       bufferLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPacket[ 0 ] ),
+                                   &( buffer[ 0 ] ),
+                                   sizeof( expectedPacket ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that RTCP Parse Twcc Packet gives back the arrival infos
+ * serialized with RTCP Serialize Twcc Packet.
+ */
+void test_rtcpSerializeTwccPacket_RoundTrip( void )
+{
+    RtcpContext_t context;
+    RtcpTwccPacket_t twccPacket = { 0 }, parsedTwccPacket = { 0 };
+    RtcpPacket_t rtcpPacket;
+    PacketArrivalInfo_t arrivalInfoList[ 500 ], parsedArrivalInfoList[ 500 ];
+    uint8_t buffer[ 1500 ];
+    size_t bufferLength = sizeof( buffer ), i;
+    RtcpResult_t result;
+    uint64_t arrivalTime = 0xFFFFFFULL * 640000ULL;
+    uint32_t state = 1;
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    /* Loss bursts, and small, large and negative receive deltas, from a
+     * fixed pseudo random sequence. */
+    for( i = 0; i < 500; i++ )
+    {
+        state = ( state * 1103515245U ) + 12345U;
+
+        arrivalInfoList[ i ].seqNum = ( uint16_t ) ( 0xFF00 + i );
+
+        if( ( ( i / 50 ) % 4 ) == 3 )
+        {
+            arrivalInfoList[ i ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+        }
+        else if( ( ( state >> 16 ) % 10 ) == 0 )
+        {
+            arrivalInfoList[ i ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+        }
+        else
+        {
+            arrivalTime += ( ( state >> 16 ) % 600 ) * 2500ULL;
+            arrivalInfoList[ i ].remoteArrivalTime = ( ( ( state >> 8 ) % 8 ) == 0 ) ? arrivalTime - 10000 : arrivalTime;
+        }
+    }
+
+    twccPacket.baseSeqNum = 0xFF00;
+    twccPacket.referenceTime = 0xFFFFFF;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+    twccPacket.arrivalInfoListLength = 500;
+
+    result = Rtcp_SerializeTwccPacket( &( context ),
+                                       &( twccPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    result = Rtcp_DeserializePacket( &( context ),
+                                     &( buffer[ 0 ] ),
+                                     bufferLength,
+                                     &( rtcpPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    parsedTwccPacket.pArrivalInfoList = &( parsedArrivalInfoList[ 0 ] );
+    parsedTwccPacket.arrivalInfoListLength = 500;
+
+    result = Rtcp_ParseTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( parsedTwccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 500,
+                       parsedTwccPacket.packetStatusCount );
+    TEST_ASSERT_EQUAL( 500,
+                       parsedTwccPacket.arrivalInfoListLength );
+
+    for( i = 0; i < 500; i++ )
+    {
+        TEST_ASSERT_EQUAL( arrivalInfoList[ i ].seqNum,
+                           parsedArrivalInfoList[ i ].seqNum );
+
+        /* The parsed times are relative to the 24 bit reference time. */
+        if( arrivalInfoList[ i ].remoteArrivalTime == RTCP_TWCC_PACKET_LOST_TIME )
+        {
+            TEST_ASSERT_EQUAL_UINT64( RTCP_TWCC_PACKET_LOST_TIME,
+                                      parsedArrivalInfoList[ i ].remoteArrivalTime );
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL_UINT64( arrivalInfoList[ i ].remoteArrivalTime,
+                                      parsedArrivalInfoList[ i ].remoteArrivalTime );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that RTCP Serialize Twcc Packet splits a run longer than a
+ * run length chunk can hold, and writes run length chunks for runs shorter
+ * than a one bit status vector chunk when large deltas rule it out.
+ */
+void test_rtcpSerializeTwccPacket_LongRuns( void )
+{
+    RtcpContext_t context;
+    RtcpTwccPacket_t twccPacket = { 0 }, parsedTwccPacket = { 0 };
+    RtcpPacket_t rtcpPacket;
+    PacketArrivalInfo_t arrivalInfoList[ 8214 ], parsedArrivalInfoList[ 8214 ];
+    uint8_t buffer[ 128 ];
+    size_t bufferLength = sizeof( buffer ), i;
+    RtcpResult_t result;
+    uint8_t expectedPacketChunks[] =
+    {
+        0x1F, 0xFF,             /* Run Length Chunk: 8191 not received. */
+        0x00, 0x09,             /* Run Length Chunk: 9 not received. */
+        0x40, 0x0A,             /* Run Length Chunk: 10 large deltas. */
+        0x20, 0x04              /* Run Length Chunk: 4 small deltas. */
+    };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    for( i = 0; i < 8200; i++ )
+    {
+        arrivalInfoList[ i ].seqNum = ( uint16_t ) i;
+        arrivalInfoList[ i ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+    }
+
+    /* Large deltas of 300 ticks, then small deltas of 1 tick. */
+    for( i = 8200; i < 8214; i++ )
+    {
+        arrivalInfoList[ i ].seqNum = ( uint16_t ) i;
+        arrivalInfoList[ i ].remoteArrivalTime = ( i < 8210 ) ? ( ( i - 8199 ) * 300ULL * 2500ULL ) :
+                                                                ( ( 3000ULL + ( i - 8209 ) ) * 2500ULL );
+    }
+
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+    twccPacket.arrivalInfoListLength = 8214;
+
+    result = Rtcp_SerializeTwccPacket( &( context ),
+                                       &( twccPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPacketChunks[ 0 ] ),
+                                   &( buffer[ 20 ] ),
+                                   sizeof( expectedPacketChunks ) );
+
+    result = Rtcp_DeserializePacket( &( context ),
+                                     &( buffer[ 0 ] ),
+                                     bufferLength,
+                                     &( rtcpPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    parsedTwccPacket.pArrivalInfoList = &( parsedArrivalInfoList[ 0 ] );
+    parsedTwccPacket.arrivalInfoListLength = 8214;
+
+    result = Rtcp_ParseTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( parsedTwccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 8214,
+                       parsedTwccPacket.arrivalInfoListLength );
+
+    for( i = 0; i < 8214; i++ )
+    {
+        TEST_ASSERT_EQUAL( arrivalInfoList[ i ].seqNum,
+                           parsedArrivalInfoList[ i ].seqNum );
+        TEST_ASSERT_EQUAL_UINT64( arrivalInfoList[ i ].remoteArrivalTime,
+                                  parsedArrivalInfoList[ i ].remoteArrivalTime );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a status vector chunk followed by a large delta
+ * round trips, i.e. that a one bit status vector chunk is not written for
+ * fewer than 14 packets before the large delta.
+ */
+void test_rtcpSerializeTwccPacket_RoundTrip_LargeDeltaAfterShortVector( void )
+{
+    RtcpContext_t context;
+    RtcpTwccPacket_t twccPacket = { 0 }, parsedTwccPacket = { 0 };
+    RtcpPacket_t rtcpPacket;
+    PacketArrivalInfo_t arrivalInfoList[ 24 ], parsedArrivalInfoList[ 32 ];
+    uint8_t buffer[ 256 ];
+    size_t bufferLength = sizeof( buffer ), i;
+    RtcpResult_t result;
+    uint64_t arrivalTime = 0x100ULL * 640000ULL;
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    /* 10 packets alternating received and lost, a large delta, and then
+     * more received, lost and large delta packets. */
+    for( i = 0; i < 24; i++ )
+    {
+        arrivalInfoList[ i ].seqNum = ( uint16_t ) ( 1000 + i );
+
+        if( ( i < 10 ) && ( ( i % 2 ) == 1 ) )
+        {
+            arrivalInfoList[ i ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+        }
+        else if( ( i == 10 ) || ( i == 20 ) )
+        {
+            arrivalTime += 1000 * 2500ULL;
+            arrivalInfoList[ i ].remoteArrivalTime = arrivalTime;
+        }
+        else if( ( i % 3 ) == 0 )
+        {
+            arrivalInfoList[ i ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+        }
+        else
+        {
+            arrivalTime += 2500ULL;
+            arrivalInfoList[ i ].remoteArrivalTime = arrivalTime;
+        }
+    }
+
+    twccPacket.baseSeqNum = 1000;
+    twccPacket.referenceTime = 0x100;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+    twccPacket.arrivalInfoListLength = 24;
+
+    result = Rtcp_SerializeTwccPacket( &( context ),
+                                       &( twccPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    result = Rtcp_DeserializePacket( &( context ),
+                                     &( buffer[ 0 ] ),
+                                     bufferLength,
+                                     &( rtcpPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    parsedTwccPacket.pArrivalInfoList = &( parsedArrivalInfoList[ 0 ] );
+    parsedTwccPacket.arrivalInfoListLength = 32;
+
+    result = Rtcp_ParseTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( parsedTwccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 24,
+                       parsedTwccPacket.packetStatusCount );
+    TEST_ASSERT_EQUAL( 24,
+                       parsedTwccPacket.arrivalInfoListLength );
+
+    for( i = 0; i < 24; i++ )
+    {
+        TEST_ASSERT_EQUAL( arrivalInfoList[ i ].seqNum,
+                           parsedArrivalInfoList[ i ].seqNum );
+        TEST_ASSERT_EQUAL_UINT64( arrivalInfoList[ i ].remoteArrivalTime,
+                                  parsedArrivalInfoList[ i ].remoteArrivalTime );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Serialize Nack Packet fail functionality for Bad
+ * Parameters.
+ */
+void test_rtcpSerializeNackPacket_BadParams( void )
+{
+    RtcpContext_t context;
+    RtcpNackPacket_t nackPacket = { 0 };
+    uint16_t seqNumList[] = { 100, 101, 99 };
+    uint8_t buffer[ 64 ];
+    size_t bufferLength = sizeof( buffer );
+    RtcpResult_t result;
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    nackPacket.pSeqNumList = &( seqNumList[ 0 ] );
+    nackPacket.seqNumListLength = 2;
+
+    result = Rtcp_SerializeNackPacket( NULL,
+                                       &( nackPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtcp_SerializeNackPacket( &( context ),
+                                       NULL,
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtcp_SerializeNackPacket( &( context ),
+                                       &( nackPacket ),
+                                       NULL,
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtcp_SerializeNackPacket( &( context ),
+                                       &( nackPacket ),
+                                       &( buffer[ 0 ] ),
+                                       NULL );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    nackPacket.pSeqNumList = NULL;
+
+    result = Rtcp_SerializeNackPacket( &( context ),
+                                       &( nackPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    nackPacket.pSeqNumList = &( seqNumList[ 0 ] );
+    nackPacket.seqNumListLength = 0;
+
+    result = Rtcp_SerializeNackPacket( &( context ),
+                                       &( nackPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    /* Out of order. */
+    nackPacket.seqNumListLength = 3;
+
+    result = Rtcp_SerializeNackPacket( &( context ),
+                                       &( nackPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Serialize Nack Packet fail functionality for small
+ * buffers.
+ */
+void test_rtcpSerializeNackPacket_SmallBuffer( void )
+{
+    RtcpContext_t context;
+    RtcpNackPacket_t nackPacket = { 0 };
+    uint16_t seqNumList[] = { 100, 116, 117 };
+    uint8_t buffer[ 64 ];
+    size_t bufferLength = 19;
+    RtcpResult_t result;
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    nackPacket.pSeqNumList = &( seqNumList[ 0 ] );
+    nackPacket.seqNumListLength = 3;
+
+    result = Rtcp_SerializeNackPacket( &( context ),
+                                       &( nackPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    bufferLength = 20;
+
+    result = Rtcp_SerializeNackPacket( &( context ),
+                                       &( nackPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 20,
+                       bufferLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that RTCP Serialize Nack Packet fails for more FCI entries
+ * than the RTCP header length field can describe.
+ */
+void test_rtcpSerializeNackPacket_TooManyFcis( void )
+{
+    RtcpContext_t context;
+    RtcpNackPacket_t nackPacket = { 0 };
+    uint16_t seqNumList[ 65535 ];
+    uint8_t buffer[ 64 ];
+    size_t bufferLength, i;
+    RtcpResult_t result;
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    /* Sequence numbers 17 apart, each in an FCI entry of its own. */
+    for( i = 0; i < 65535; i++ )
+    {
+        seqNumList[ i ] = ( uint16_t ) ( i * 17 );
+    }
+
+    nackPacket.pSeqNumList = &( seqNumList[ 0 ] );
+
+    /* 65535 FCI entries need a length field of 65536 words. The buffer
+     * length is large enough, so only the length field fails. Nothing is
+     * written on failure. */
+    nackPacket.seqNumListLength = 65535;
+    bufferLength = SIZE_MAX;
+
+    result = Rtcp_SerializeNackPacket( &( context ),
+                                       &( nackPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OUT_OF_MEMORY,
+                       result );
+    TEST_ASSERT_EQUAL( SIZE_MAX,
+                       bufferLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Serialize Nack Packet functionality.
+ */
+void test_rtcpSerializeNackPacket( void )
+{
+    RtcpContext_t context;
+    RtcpNackPacket_t nackPacket = { 0 }, parsedNackPacket = { 0 };
+    RtcpPacket_t rtcpPacket;
+    uint16_t seqNumList[] = { 65530, 65530, 65531, 65535, 0, 0, 10, 11, 50 };
+    uint16_t expectedSeqNumList[] = { 65530, 65531, 65535, 0, 10, 11, 50 };
+    uint16_t parsedSeqNumList[ 16 ];
+    uint8_t buffer[ 64 ];
+    size_t bufferLength = sizeof( buffer );
+    RtcpResult_t result;
+    uint8_t expectedPacket[] =
+    {
+        0x81, 0xCD, 0x00, 0x05, /* Header: V=2, P=0, FMT=1, PT=205, Length = 5 words. */
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0xFF, 0xFA, 0x80, 0x31, /* PID = 65530, BLP = 65531, 65535, 0, 10. */
+        0x00, 0x0B, 0x00, 0x00, /* PID = 11. */
+        0x00, 0x32, 0x00, 0x00  /* PID = 50. */
+    };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    /* Wraps around, with a repeated PID and a repeated sequence number. */
+    nackPacket.senderSsrc = 0x12345678;
+    nackPacket.mediaSourceSsrc = 0x9ABCDEF0;
+    nackPacket.pSeqNumList = &( seqNumList[ 0 ] );
+    nackPacket.seqNumListLength = sizeof( seqNumList ) / sizeof( seqNumList[ 0 ] );
+
+    result = Rtcp_SerializeNackPacket( &( context ),
+                                       &( nackPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedPacket ),
+                       bufferLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPacket[ 0 ] ),
+                                   &( buffer[ 0 ] ),
+                                   sizeof( expectedPacket ) );
+
+    result = Rtcp_DeserializePacket( &( context ),
+                                     &( buffer[ 0 ] ),
+                                     bufferLength,
+                                     &( rtcpPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    parsedNackPacket.pSeqNumList = &( parsedSeqNumList[ 0 ] );
+    parsedNackPacket.seqNumListLength = 16;
+
+    result = Rtcp_ParseNackPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( parsedNackPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedSeqNumList ) / sizeof( expectedSeqNumList[ 0 ] ),
+                       parsedNackPacket.seqNumListLength );
+    TEST_ASSERT_EQUAL_UINT16_ARRAY( &( expectedSeqNumList[ 0 ] ),
+                                    &( parsedSeqNumList[ 0 ] ),
+                                    parsedNackPacket.seqNumListLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Parse Nack Packet functionality with all the BLP bits
+ * set.
+ */
+void test_rtcpParseNackPacket_FullBitmask( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpResult_t result;
+    uint16_t seqNumList[ 19 ], i;
+    RtcpNackPacket_t rtcpNackPacket;
+    uint8_t nackPacketPayload[] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0xFF, 0xF8, 0xFF, 0xFF, /* NACK: PID = 65528, BLP = 0xFFFF. */
+        0x00, 0x20, 0x80, 0x00  /* NACK: PID = 32, BLP = 0x8000. */
+    };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.payloadLength = sizeof( nackPacketPayload );
+    rtcpPacket.pPayload = nackPacketPayload;
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_NACK;
+
+    rtcpNackPacket.pSeqNumList = NULL;
+
+    result = Rtcp_ParseNackPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpNackPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 19,
+                       rtcpNackPacket.seqNumListLength );
+
+    rtcpNackPacket.pSeqNumList = &( seqNumList[ 0 ] );
+    rtcpNackPacket.seqNumListLength = 18;
+
+    result = Rtcp_ParseNackPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpNackPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    rtcpNackPacket.seqNumListLength = 19;
+
+    result = Rtcp_ParseNackPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( rtcpNackPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 19,
+                       rtcpNackPacket.seqNumListLength );
+
+    for( i = 0; i < 17; i++ )
+    {
+        TEST_ASSERT_EQUAL( ( uint16_t ) ( 65528 + i ),
+                           seqNumList[ i ] );
+    }
+
+    TEST_ASSERT_EQUAL( 32,
+                       seqNumList[ 17 ] );
+    TEST_ASSERT_EQUAL( 48,
+                       seqNumList[ 18 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Parse Nack Packet Fcis fail functionality for Bad
+ * Parameters.
+ */
+void test_rtcpParseNackPacketFcis_BadParams( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpNackFciPacket_t nackFciPacket;
+    RtcpResult_t result;
+    uint8_t nackPacketPayload[ 16 ] = { 0 };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = &( nackPacketPayload[ 0 ] );
+    rtcpPacket.payloadLength = 12;
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_NACK;
+
+    result = Rtcp_ParseNackPacketFcis( NULL,
+                                       &( rtcpPacket ),
+                                       &( nackFciPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtcp_ParseNackPacketFcis( &( context ),
+                                       NULL,
+                                       &( nackFciPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtcp_ParseNackPacketFcis( &( context ),
+                                       &( rtcpPacket ),
+                                       NULL );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    rtcpPacket.pPayload = NULL;
+
+    result = Rtcp_ParseNackPacketFcis( &( context ),
+                                       &( rtcpPacket ),
+                                       &( nackFciPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    /* Not a whole number of FCI entries. */
+    rtcpPacket.pPayload = &( nackPacketPayload[ 0 ] );
+    rtcpPacket.payloadLength = 14;
+
+    result = Rtcp_ParseNackPacketFcis( &( context ),
+                                       &( rtcpPacket ),
+                                       &( nackFciPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    rtcpPacket.payloadLength = 10;
+
+    result = Rtcp_ParseNackPacketFcis( &( context ),
+                                       &( rtcpPacket ),
+                                       &( nackFciPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+
+    rtcpPacket.payloadLength = 12;
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_TWCC;
+
+    result = Rtcp_ParseNackPacketFcis( &( context ),
+                                       &( rtcpPacket ),
+                                       &( nackFciPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTCP Parse Nack Packet Fcis functionality.
+ */
+void test_rtcpParseNackPacketFcis( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpNackFciPacket_t nackFciPacket;
+    RtcpNackFci_t fciList[ 2 ];
+    RtcpResult_t result;
+    uint8_t nackPacketPayload[] =
+    {
+        0x12, 0x34, 0x56, 0x78, /* Sender SSRC. */
+        0x9A, 0xBC, 0xDE, 0xF0, /* Media Source SSRC. */
+        0x06, 0x3B, 0x0A, 0x09, /* NACK: PID = 0x063B, BLP = 0x0A09. */
+        0x07, 0x00, 0x00, 0x00  /* NACK: PID = 0x0700, BLP = 0. */
+    };
+
+    result = Rtcp_Init( &( context ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    rtcpPacket.pPayload = &( nackPacketPayload[ 0 ] );
+    rtcpPacket.payloadLength = sizeof( nackPacketPayload );
+    rtcpPacket.header.packetType = RTCP_PACKET_TRANSPORT_FEEDBACK_NACK;
+
+    nackFciPacket.pFciList = NULL;
+    nackFciPacket.fciListLength = 0;
+
+    result = Rtcp_ParseNackPacketFcis( &( context ),
+                                       &( rtcpPacket ),
+                                       &( nackFciPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       nackFciPacket.fciListLength );
+
+    nackFciPacket.pFciList = &( fciList[ 0 ] );
+    nackFciPacket.fciListLength = 1;
+
+    result = Rtcp_ParseNackPacketFcis( &( context ),
+                                       &( rtcpPacket ),
+                                       &( nackFciPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OUT_OF_MEMORY,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       nackFciPacket.fciListLength );
+
+    result = Rtcp_ParseNackPacketFcis( &( context ),
+                                       &( rtcpPacket ),
+                                       &( nackFciPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0x12345678,
+                       nackFciPacket.senderSsrc );
+    TEST_ASSERT_EQUAL( 0x9ABCDEF0,
+                       nackFciPacket.mediaSourceSsrc );
+    TEST_ASSERT_EQUAL( 2,
+                       nackFciPacket.fciListLength );
+    TEST_ASSERT_EQUAL( 0x063B,
+                       fciList[ 0 ].pid );
+    TEST_ASSERT_EQUAL( 0x0A09,
+                       fciList[ 0 ].blp );
+    TEST_ASSERT_EQUAL( 0x0700,
+                       fciList[ 1 ].pid );
+    TEST_ASSERT_EQUAL( 0,
+                       fciList[ 1 ].blp );
 }
 
 /*-----------------------------------------------------------*/
@@ -0,0 +1,254 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* API includes. */
+#include "rtcp_api.h"
+#include "rtcp_rtt_estimator.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define LOCAL_SSRC                     0x12345678
+#define REMOTE_SSRC                    0x9ABCDEF0
+#define SENDER_REPORT_ARRAY_LENGTH     2
+#define MILLISECONDS                   10000ULL
+
+/* DLSR values, in 1/65536 seconds. */
+#define DLSR_125_MILLISECONDS          8192
+#define DLSR_250_MILLISECONDS          16384
+
+RtcpRttEstimator_t rttEstimator;
+RtcpRttEstimatorSenderReport_t senderReportArray[ SENDER_REPORT_ARRAY_LENGTH ];
+
+void setUp( void )
+{
+    RtcpRttEstimatorResult_t result;
+
+    result = RtcpRttEstimator_Init( &( rttEstimator ),
+                                    LOCAL_SSRC,
+                                    &( senderReportArray[ 0 ] ),
+                                    SENDER_REPORT_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_OK,
+                       result );
+}
+
+void tearDown( void )
+{
+}
+
+static void AddSenderReport( uint32_t compactNtpTime,
+                             uint64_t sentTime )
+{
+    RtcpSenderReport_t senderReport = { 0 };
+
+    senderReport.senderSsrc = LOCAL_SSRC;
+    senderReport.senderInfo.ntpTime = ( ( uint64_t ) compactNtpTime ) << 16;
+
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_OK,
+                       RtcpRttEstimator_AddSenderReport( &( rttEstimator ),
+                                                         &( senderReport ),
+                                                         sentTime ) );
+}
+
+static RtcpRttEstimatorResult_t HandleReceptionReport( uint32_t sourceSsrc,
+                                                       uint32_t lastSR,
+                                                       uint32_t delaySinceLastSR,
+                                                       uint64_t arrivalTime,
+                                                       uint64_t * pRttSample )
+{
+    RtcpReceptionReport_t receptionReport = { 0 };
+    RtcpReceiverReport_t receiverReport;
+
+    receptionReport.sourceSsrc = sourceSsrc;
+    receptionReport.lastSR = lastSR;
+    receptionReport.delaySinceLastSR = delaySinceLastSR;
+
+    receiverReport.senderSsrc = REMOTE_SSRC;
+    receiverReport.pReceptionReports = &( receptionReport );
+    receiverReport.numReceptionReports = 1;
+
+    return RtcpRttEstimator_HandleReceiverReport( &( rttEstimator ),
+                                                  &( receiverReport ),
+                                                  arrivalTime,
+                                                  pRttSample );
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate RTT Estimator fail functionality for Bad Parameters.
+ */
+void test_rttEstimator_BadParams( void )
+{
+    RtcpSenderReport_t senderReport = { 0 };
+    RtcpReceiverReport_t receiverReport = { 0 };
+    uint64_t rtt;
+
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM,
+                       RtcpRttEstimator_Init( NULL, LOCAL_SSRC, &( senderReportArray[ 0 ] ), 2 ) );
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM,
+                       RtcpRttEstimator_Init( &( rttEstimator ), LOCAL_SSRC, NULL, 2 ) );
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM,
+                       RtcpRttEstimator_Init( &( rttEstimator ), LOCAL_SSRC, &( senderReportArray[ 0 ] ), 0 ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM,
+                       RtcpRttEstimator_AddSenderReport( NULL, &( senderReport ), 0 ) );
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM,
+                       RtcpRttEstimator_AddSenderReport( &( rttEstimator ), NULL, 0 ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM,
+                       RtcpRttEstimator_HandleReceiverReport( NULL, &( receiverReport ), 0, NULL ) );
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM,
+                       RtcpRttEstimator_HandleReceiverReport( &( rttEstimator ), NULL, 0, NULL ) );
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM,
+                       RtcpRttEstimator_HandleSenderReport( NULL, &( senderReport ), 0, NULL ) );
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM,
+                       RtcpRttEstimator_HandleSenderReport( &( rttEstimator ), NULL, 0, NULL ) );
+
+    /* Reports without reception reports. */
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_EMPTY,
+                       RtcpRttEstimator_HandleReceiverReport( &( rttEstimator ), &( receiverReport ), 0, NULL ) );
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_EMPTY,
+                       RtcpRttEstimator_HandleSenderReport( &( rttEstimator ), &( senderReport ), 0, NULL ) );
+
+    receiverReport.numReceptionReports = 1;
+    senderReport.numReceptionReports = 1;
+
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM,
+                       RtcpRttEstimator_HandleReceiverReport( &( rttEstimator ), &( receiverReport ), 0, NULL ) );
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM,
+                       RtcpRttEstimator_HandleSenderReport( &( rttEstimator ), &( senderReport ), 0, NULL ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM,
+                       RtcpRttEstimator_GetRoundTripTime( NULL, &( rtt ) ) );
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_BAD_PARAM,
+                       RtcpRttEstimator_GetRoundTripTime( &( rttEstimator ), NULL ) );
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_EMPTY,
+                       RtcpRttEstimator_GetRoundTripTime( &( rttEstimator ), &( rtt ) ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTT Estimator samples and smoothed round trip time.
+ */
+void test_rttEstimator_RoundTripTime( void )
+{
+    uint64_t rttSample, smoothedRtt;
+
+    AddSenderReport( 0x11110000,
+                     1000 * MILLISECONDS );
+    AddSenderReport( 0x22220000,
+                     2000 * MILLISECONDS );
+
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_OK,
+                       HandleReceptionReport( LOCAL_SSRC, 0x11110000, DLSR_250_MILLISECONDS, 1350 * MILLISECONDS, &( rttSample ) ) );
+    TEST_ASSERT_EQUAL_UINT64( 100 * MILLISECONDS,
+                              rttSample );
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_OK,
+                       RtcpRttEstimator_GetRoundTripTime( &( rttEstimator ), &( smoothedRtt ) ) );
+    TEST_ASSERT_EQUAL_UINT64( 100 * MILLISECONDS,
+                              smoothedRtt );
+
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_OK,
+                       HandleReceptionReport( LOCAL_SSRC, 0x22220000, DLSR_125_MILLISECONDS, 2300 * MILLISECONDS, &( rttSample ) ) );
+    TEST_ASSERT_EQUAL_UINT64( 175 * MILLISECONDS,
+                              rttSample );
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_OK,
+                       RtcpRttEstimator_GetRoundTripTime( &( rttEstimator ), &( smoothedRtt ) ) );
+    TEST_ASSERT_EQUAL_UINT64( ( 100 * MILLISECONDS ) - ( 100 * MILLISECONDS / 8 ) + ( 175 * MILLISECONDS / 8 ),
+                              smoothedRtt );
+
+    /* The DLSR is longer than the time since the SR was sent. */
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_OK,
+                       HandleReceptionReport( LOCAL_SSRC, 0x22220000, DLSR_250_MILLISECONDS, 2200 * MILLISECONDS, &( rttSample ) ) );
+    TEST_ASSERT_EQUAL_UINT64( 0,
+                              rttSample );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTT Estimator functionality for reception reports which do
+ * not refer to a recorded SR.
+ */
+void test_rttEstimator_NoSenderReport( void )
+{
+    uint64_t rttSample = 1;
+
+    AddSenderReport( 0x11110000,
+                     1000 * MILLISECONDS );
+
+    /* Another source, no SR received yet and an unknown SR. */
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_EMPTY,
+                       HandleReceptionReport( REMOTE_SSRC, 0x11110000, 0, 1100 * MILLISECONDS, &( rttSample ) ) );
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_EMPTY,
+                       HandleReceptionReport( LOCAL_SSRC, 0, 0, 1100 * MILLISECONDS, &( rttSample ) ) );
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_EMPTY,
+                       HandleReceptionReport( LOCAL_SSRC, 0x11120000, 0, 1100 * MILLISECONDS, &( rttSample ) ) );
+    TEST_ASSERT_EQUAL_UINT64( 1,
+                              rttSample );
+
+    /* The oldest SR is replaced. */
+    AddSenderReport( 0x22220000,
+                     2000 * MILLISECONDS );
+    AddSenderReport( 0x33330000,
+                     3000 * MILLISECONDS );
+
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_EMPTY,
+                       HandleReceptionReport( LOCAL_SSRC, 0x11110000, 0, 3100 * MILLISECONDS, NULL ) );
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_OK,
+                       HandleReceptionReport( LOCAL_SSRC, 0x22220000, 0, 3100 * MILLISECONDS, NULL ) );
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_OK,
+                       HandleReceptionReport( LOCAL_SSRC, 0x33330000, 0, 3100 * MILLISECONDS, NULL ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RTT Estimator functionality for a parsed SR packet with a
+ * reception report about the local source.
+ */
+void test_rttEstimator_HandleSenderReport( void )
+{
+    RtcpContext_t context;
+    RtcpPacket_t rtcpPacket;
+    RtcpSenderReport_t senderReport = { 0 }, parsedSenderReport;
+    RtcpReceptionReport_t receptionReports[ 2 ] = { 0 }, parsedReceptionReports[ 2 ];
+    uint8_t buffer[ 128 ];
+    size_t bufferLength = sizeof( buffer );
+    uint64_t rttSample;
+
+    AddSenderReport( 0x11110000,
+                     1000 * MILLISECONDS );
+
+    receptionReports[ 0 ].sourceSsrc = 0x55555555;
+    receptionReports[ 0 ].lastSR = 0x11110000;
+    receptionReports[ 1 ].sourceSsrc = LOCAL_SSRC;
+    receptionReports[ 1 ].lastSR = 0x11110000;
+    receptionReports[ 1 ].delaySinceLastSR = DLSR_125_MILLISECONDS;
+
+    senderReport.senderSsrc = REMOTE_SSRC;
+    senderReport.pReceptionReports = &( receptionReports[ 0 ] );
+    senderReport.numReceptionReports = 2;
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       Rtcp_Init( &( context ) ) );
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       Rtcp_SerializeSenderReport( &( context ), &( senderReport ), &( buffer[ 0 ] ), &( bufferLength ) ) );
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       Rtcp_DeserializePacket( &( context ), &( buffer[ 0 ] ), bufferLength, &( rtcpPacket ) ) );
+
+    parsedSenderReport.pReceptionReports = &( parsedReceptionReports[ 0 ] );
+    parsedSenderReport.numReceptionReports = 2;
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       Rtcp_ParseSenderReport( &( context ), &( rtcpPacket ), &( parsedSenderReport ) ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RTT_ESTIMATOR_RESULT_OK,
+                       RtcpRttEstimator_HandleSenderReport( &( rttEstimator ), &( parsedSenderReport ), 1200 * MILLISECONDS, &( rttSample ) ) );
+    TEST_ASSERT_EQUAL_UINT64( 75 * MILLISECONDS,
+                              rttSample );
+}
+
+/*-----------------------------------------------------------*/
@@ -16,11 +16,25 @@
 #define TWCC_PACKET_INFO_ARRAY_LENGTH         32
 TwccPacketInfo_t twccPacketInfoArray[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
 
+/* Longer than half of the 16-bit sequence number range. */
+#define TWCC_LONG_PACKET_INFO_ARRAY_LENGTH    40000
+TwccPacketInfo_t twccLongPacketInfoArray[ TWCC_LONG_PACKET_INFO_ARRAY_LENGTH ];
+uint16_t seqNumArray[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
+uint32_t relativeSentTimeArray[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
+uint16_t packetSizeArray[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
+TwccCompactPacketInfoArrays_t compactArrays;
+
+#define WRAP_TEST_INDEX( index )    ( ( index ) % TWCC_PACKET_INFO_ARRAY_LENGTH )
+
 void setUp( void )
 {
     memset( &( twccPacketInfoArray[ 0 ] ),
             0,
             sizeof( twccPacketInfoArray ) );
+
+    compactArrays.pSeqNumArray = &( seqNumArray[ 0 ] );
+    compactArrays.pRelativeSentTimeArray = &( relativeSentTimeArray[ 0 ] );
+    compactArrays.pPacketSizeArray = &( packetSizeArray[ 0 ] );
 }
 
 void tearDown( void )
@@ -693,3 +707,2695 @@ void test_twccHandlePacket_SeqNumNotFound( void )
 }
 
 /*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc Manager Init with flags fail functionality for Bad Parameters.
+ */
+void test_twccInitWithFlags_BadParams( void )
+{
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+
+    /* Unknown flag. */
+    result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                            &( twccPacketInfoArray[ 0 ] ),
+                                            TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                            0x80000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    /* Longer than 16-bit sequence numbers can match in the linear mode. */
+    result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                            &( twccLongPacketInfoArray[ 0 ] ),
+                                            RTCP_TWCC_MANAGER_MAX_LINEAR_LENGTH + 1,
+                                            RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                            &( twccLongPacketInfoArray[ 0 ] ),
+                                            RTCP_TWCC_MANAGER_MAX_LINEAR_LENGTH,
+                                            RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc Manager Add and Find packet functionality in the
+ * sequence number indexed mode.
+ */
+void test_twccAddPacket_SeqNumIndexed( void )
+{
+    uint16_t seqNum = 256;
+    uint32_t i;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    TwccPacketInfo_t twccPacketInfo = { 0 };
+    TwccPacketInfo_t * pFoundTwccPacketInfo;
+    size_t packetSize = ( rand() % ( 1000 ) );
+    uint64_t sentTime = time( NULL );
+
+    result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                            &( twccPacketInfoArray[ 0 ] ),
+                                            TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                            RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED,
+                       twccManager.flags );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_EMPTY,
+                       result );
+
+    for( i = 0; i < TWCC_PACKET_INFO_ARRAY_LENGTH + 1; i++ )
+    {
+        twccPacketInfo.packetSize = packetSize + ( size_t ) i;
+        twccPacketInfo.localSentTime = sentTime + ( uint64_t ) i;
+        twccPacketInfo.packetSeqNum = seqNum + ( uint16_t ) i;
+
+        result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                                &( twccPacketInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH,
+                       twccManager.count );
+
+    /* The first (i.e. the oldest) packet is deleted, and hence not found. */
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+
+    for( i = 1; i <= TWCC_PACKET_INFO_ARRAY_LENGTH; i++ )
+    {
+        result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                                 seqNum + ( uint16_t ) i,
+                                                 &( pFoundTwccPacketInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( sentTime + ( uint64_t ) i,
+                           pFoundTwccPacketInfo->localSentTime );
+        TEST_ASSERT_EQUAL( packetSize + ( size_t ) i,
+                           pFoundTwccPacketInfo->packetSize );
+        TEST_ASSERT_EQUAL( seqNum + ( uint16_t ) i,
+                           pFoundTwccPacketInfo->packetSeqNum );
+    }
+
+    /* A sequence number newer than the newest packet is not found. */
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + TWCC_PACKET_INFO_ARRAY_LENGTH + 1,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc Manager sequence number indexed mode when the sender
+ * skips sequence numbers and adds them later out of order.
+ */
+void test_twccAddPacket_SeqNumIndexed_Gap( void )
+{
+    uint16_t seqNum = 65534;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    TwccPacketInfo_t twccPacketInfo = { 0 };
+    TwccPacketInfo_t * pFoundTwccPacketInfo;
+    uint64_t sentTime = time( NULL );
+
+    result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                            &( twccPacketInfoArray[ 0 ] ),
+                                            TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                            RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* Add 65534 and 1, skipping 65535 and 0 across the wrap around. */
+    twccPacketInfo.packetSize = 100;
+    twccPacketInfo.localSentTime = sentTime;
+    twccPacketInfo.packetSeqNum = seqNum;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( twccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    twccPacketInfo.packetSize = 101;
+    twccPacketInfo.localSentTime = sentTime + 3;
+    twccPacketInfo.packetSeqNum = seqNum + 3;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( twccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 4,
+                       twccManager.count );
+
+    /* The slots reserved for the skipped sequence numbers are not valid. */
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + 1,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             0,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+
+    /* Add the skipped sequence number 0 late. */
+    twccPacketInfo.packetSize = 102;
+    twccPacketInfo.localSentTime = sentTime + 2;
+    twccPacketInfo.packetSeqNum = 0;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( twccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 4,
+                       twccManager.count );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             0,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 102,
+                       pFoundTwccPacketInfo->packetSize );
+    TEST_ASSERT_EQUAL( sentTime + 2,
+                       pFoundTwccPacketInfo->localSentTime );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 100,
+                       pFoundTwccPacketInfo->packetSize );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             1,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 101,
+                       pFoundTwccPacketInfo->packetSize );
+
+    /* Re-adding the newest packet updates it in place. */
+    twccPacketInfo.packetSize = 103;
+    twccPacketInfo.localSentTime = sentTime + 3;
+    twccPacketInfo.packetSeqNum = 1;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( twccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 4,
+                       twccManager.count );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             1,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 103,
+                       pFoundTwccPacketInfo->packetSize );
+
+    /* A packet older than every tracked packet is ignored. */
+    twccPacketInfo.packetSize = 104;
+    twccPacketInfo.localSentTime = sentTime - 1;
+    twccPacketInfo.packetSeqNum = seqNum - 1;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( twccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 4,
+                       twccManager.count );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum - 1,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc Manager sequence number indexed mode when the gap in
+ * sequence numbers is larger than the array.
+ */
+void test_twccAddPacket_SeqNumIndexed_LargeGap( void )
+{
+    uint16_t seqNum = 256;
+    uint32_t i;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    TwccPacketInfo_t twccPacketInfo = { 0 };
+    TwccPacketInfo_t * pFoundTwccPacketInfo;
+    uint64_t sentTime = time( NULL );
+
+    result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                            &( twccPacketInfoArray[ 0 ] ),
+                                            TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                            RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    for( i = 0; i < 4; i++ )
+    {
+        twccPacketInfo.packetSize = 100;
+        twccPacketInfo.localSentTime = sentTime + ( uint64_t ) i;
+        twccPacketInfo.packetSeqNum = seqNum + ( uint16_t ) i;
+
+        result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                                &( twccPacketInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    twccPacketInfo.localSentTime = sentTime + 4;
+    twccPacketInfo.packetSeqNum = seqNum + 3 + TWCC_PACKET_INFO_ARRAY_LENGTH;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( twccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1,
+                       twccManager.count );
+
+    for( i = 0; i < 4; i++ )
+    {
+        result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                                 seqNum + ( uint16_t ) i,
+                                                 &( pFoundTwccPacketInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                           result );
+    }
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             twccPacketInfo.packetSeqNum,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sentTime + 4,
+                       pFoundTwccPacketInfo->localSentTime );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc Manager Handle packet functionality in the sequence
+ * number indexed mode.
+ */
+void test_twccHandlePacket_SeqNumIndexed( void )
+{
+    uint16_t seqNum = 256;
+    uint32_t i;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    RtcpTwccPacket_t twccPacket;
+    TwccBandwidthInfo_t bandwidthInfo = { 0 };
+    TwccPacketInfo_t packetInfo = { 0 };
+    PacketArrivalInfo_t arrivalInfoList[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
+    size_t packetSize = ( rand() % ( 1000 ) );
+    uint64_t sentTime = time( NULL );
+
+    result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                            &( twccPacketInfoArray[ 0 ] ),
+                                            TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                            RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    for( i = 0; i < TWCC_PACKET_INFO_ARRAY_LENGTH; i++ )
+    {
+        packetInfo.packetSize = packetSize;
+        packetInfo.localSentTime = sentTime + ( uint64_t ) i;
+        packetInfo.packetSeqNum = seqNum + ( uint16_t ) i;
+
+        result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                                &( packetInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+
+        arrivalInfoList[ i ].seqNum = packetInfo.packetSeqNum;
+        if( ( i % 2 ) == 0 )
+        {
+            arrivalInfoList[ i ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME; /* Set half of the packets as lost. */
+        }
+        else
+        {
+            arrivalInfoList[ i ].remoteArrivalTime = packetInfo.localSentTime + 1; /* Set half of the packets as received. */
+        }
+    }
+
+    twccPacket.arrivalInfoListLength = TWCC_PACKET_INFO_ARRAY_LENGTH;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+
+    result = RtcpTwccManager_HandleTwccPacket( &( twccManager ),
+                                               &( twccPacket ),
+                                               &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH - 1,
+                       bandwidthInfo.duration );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH,
+                       bandwidthInfo.sentPackets );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH * packetSize,
+                       bandwidthInfo.sentBytes );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH / 2,
+                       bandwidthInfo.receivedPackets );
+    TEST_ASSERT_EQUAL( ( TWCC_PACKET_INFO_ARRAY_LENGTH / 2 ) * packetSize,
+                       bandwidthInfo.receivedBytes );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc Manager Handle packet functionality when a packet info
+ * in the middle of the feedback is missing and the array has wrapped around.
+ */
+void test_twccHandlePacket_MissingPacketInfo( void )
+{
+    uint16_t seqNum = 256;
+    uint32_t i;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    RtcpTwccPacket_t twccPacket;
+    TwccBandwidthInfo_t bandwidthInfo = { 0 };
+    TwccPacketInfo_t packetInfo = { 0 };
+    PacketArrivalInfo_t arrivalInfoList[ TWCC_PACKET_INFO_ARRAY_LENGTH + 1 ];
+    size_t packetSize = 100;
+    uint64_t sentTime = time( NULL );
+
+    result = RtcpTwccManager_Init( &( twccManager ),
+                                   &( twccPacketInfoArray[ 0 ] ),
+                                   TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* Add packets seqNum .. seqNum + 2 * TWCC_PACKET_INFO_ARRAY_LENGTH - 1,
+     * except seqNum + TWCC_PACKET_INFO_ARRAY_LENGTH + 8, so that the array
+     * wraps around. */
+    for( i = 0; i < ( 2 * TWCC_PACKET_INFO_ARRAY_LENGTH ); i++ )
+    {
+        if( i != ( TWCC_PACKET_INFO_ARRAY_LENGTH + 8 ) )
+        {
+            packetInfo.packetSize = packetSize;
+            packetInfo.localSentTime = sentTime + ( uint64_t ) i;
+            packetInfo.packetSeqNum = seqNum + ( uint16_t ) i;
+
+            result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                                    &( packetInfo ) );
+
+            TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                               result );
+        }
+    }
+
+    /* Feedback for the last TWCC_PACKET_INFO_ARRAY_LENGTH sent packets plus one
+     * which was never sent. */
+    for( i = 0; i < TWCC_PACKET_INFO_ARRAY_LENGTH + 1; i++ )
+    {
+        arrivalInfoList[ i ].seqNum = seqNum + TWCC_PACKET_INFO_ARRAY_LENGTH + ( uint16_t ) i;
+        arrivalInfoList[ i ].remoteArrivalTime = sentTime + ( uint64_t ) i;
+    }
+
+    twccPacket.arrivalInfoListLength = TWCC_PACKET_INFO_ARRAY_LENGTH + 1;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+
+    result = RtcpTwccManager_HandleTwccPacket( &( twccManager ),
+                                               &( twccPacket ),
+                                               &( bandwidthInfo ) );
+
+    /* The start time is the sent time of the packet right before the first
+     * packet in the feedback, and the end time is the sent time of the last
+     * found packet. */
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH,
+                       bandwidthInfo.duration );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH - 1,
+                       bandwidthInfo.sentPackets );
+    TEST_ASSERT_EQUAL( ( TWCC_PACKET_INFO_ARRAY_LENGTH - 1 ) * packetSize,
+                       bandwidthInfo.sentBytes );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH - 1,
+                       bandwidthInfo.receivedPackets );
+    TEST_ASSERT_EQUAL( ( TWCC_PACKET_INFO_ARRAY_LENGTH - 1 ) * packetSize,
+                       bandwidthInfo.receivedBytes );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc Manager Handle packet functionality when the arrival
+ * infos are not in the order in which packets were sent.
+ */
+void test_twccHandlePacket_OutOfOrder( void )
+{
+    uint16_t seqNum = 256;
+    uint32_t i;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    RtcpTwccPacket_t twccPacket;
+    TwccBandwidthInfo_t bandwidthInfo = { 0 };
+    TwccPacketInfo_t packetInfo = { 0 };
+    PacketArrivalInfo_t arrivalInfoList[ 4 ];
+    size_t packetSize = 100;
+    uint64_t sentTime = time( NULL );
+
+    result = RtcpTwccManager_Init( &( twccManager ),
+                                   &( twccPacketInfoArray[ 0 ] ),
+                                   TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    for( i = 0; i < 4; i++ )
+    {
+        packetInfo.packetSize = packetSize;
+        packetInfo.localSentTime = sentTime + ( uint64_t ) i;
+        packetInfo.packetSeqNum = seqNum + ( uint16_t ) i;
+
+        result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                                &( packetInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    arrivalInfoList[ 0 ].seqNum = seqNum + 2;
+    arrivalInfoList[ 1 ].seqNum = seqNum;
+    arrivalInfoList[ 2 ].seqNum = seqNum + 3;
+    arrivalInfoList[ 3 ].seqNum = seqNum + 1;
+
+    for( i = 0; i < 4; i++ )
+    {
+        arrivalInfoList[ i ].remoteArrivalTime = sentTime + ( uint64_t ) i;
+    }
+
+    twccPacket.arrivalInfoListLength = 4;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+
+    result = RtcpTwccManager_HandleTwccPacket( &( twccManager ),
+                                               &( twccPacket ),
+                                               &( bandwidthInfo ) );
+
+    /* Start time is the sent time of seqNum + 1 and the end time is the sent
+     * time of the last arrival info, i.e. also seqNum + 1. */
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       bandwidthInfo.duration );
+    TEST_ASSERT_EQUAL( 4,
+                       bandwidthInfo.sentPackets );
+    TEST_ASSERT_EQUAL( 4 * packetSize,
+                       bandwidthInfo.sentBytes );
+    TEST_ASSERT_EQUAL( 4,
+                       bandwidthInfo.receivedPackets );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc Manager Handle packet functionality when the arrival
+ * infos skip sequence numbers and start before the oldest packet info.
+ */
+void test_twccHandlePacket_SkippedSeqNums( void )
+{
+    uint16_t seqNum = 65500;
+    uint32_t i;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    RtcpTwccPacket_t twccPacket;
+    TwccBandwidthInfo_t bandwidthInfo = { 0 };
+    TwccPacketInfo_t packetInfo = { 0 };
+    PacketArrivalInfo_t arrivalInfoList[ 5 ];
+    size_t packetSize = 100;
+    uint64_t sentTime = RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND;
+
+    result = RtcpTwccManager_Init( &( twccManager ),
+                                   &( twccPacketInfoArray[ 0 ] ),
+                                   TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* Add 2 * TWCC_PACKET_INFO_ARRAY_LENGTH packets, so that the array wraps
+     * around and only the last TWCC_PACKET_INFO_ARRAY_LENGTH are kept. The
+     * size of each packet tells which ones are found. */
+    for( i = 0; i < ( 2 * TWCC_PACKET_INFO_ARRAY_LENGTH ); i++ )
+    {
+        packetInfo.packetSize = packetSize + i;
+        packetInfo.localSentTime = sentTime + ( uint64_t ) i;
+        packetInfo.packetSeqNum = seqNum + ( uint16_t ) i;
+
+        result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                                &( packetInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    /* The first arrival info is for an overwritten packet info and the last
+     * one is for a packet which was never sent. */
+    arrivalInfoList[ 0 ].seqNum = seqNum + TWCC_PACKET_INFO_ARRAY_LENGTH - 1;
+    arrivalInfoList[ 1 ].seqNum = seqNum + TWCC_PACKET_INFO_ARRAY_LENGTH + 1;
+    arrivalInfoList[ 2 ].seqNum = seqNum + TWCC_PACKET_INFO_ARRAY_LENGTH + 4;
+    arrivalInfoList[ 3 ].seqNum = seqNum + ( 2 * TWCC_PACKET_INFO_ARRAY_LENGTH ) - 1;
+    arrivalInfoList[ 4 ].seqNum = seqNum + ( 2 * TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    for( i = 0; i < 5; i++ )
+    {
+        arrivalInfoList[ i ].remoteArrivalTime = 2 * sentTime + i;
+    }
+
+    twccPacket.arrivalInfoListLength = 5;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+
+    result = RtcpTwccManager_HandleTwccPacket( &( twccManager ),
+                                               &( twccPacket ),
+                                               &( bandwidthInfo ) );
+
+    /* The start time is the sent time of the oldest packet info, which is
+     * right before the first found one. */
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH - 1,
+                       bandwidthInfo.duration );
+    TEST_ASSERT_EQUAL( 3,
+                       bandwidthInfo.sentPackets );
+    TEST_ASSERT_EQUAL( ( 3 * packetSize ) + ( 4 * TWCC_PACKET_INFO_ARRAY_LENGTH ) + 4,
+                       bandwidthInfo.sentBytes );
+    TEST_ASSERT_EQUAL( 3,
+                       bandwidthInfo.receivedPackets );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc Manager Handle packet functionality in the sequence
+ * number indexed mode when the feedback covers a skipped sequence number.
+ */
+void test_twccHandlePacket_SeqNumIndexed_Gap( void )
+{
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    RtcpTwccPacket_t twccPacket;
+    TwccBandwidthInfo_t bandwidthInfo = { 0 };
+    TwccPacketInfo_t packetInfo = { 0 };
+    PacketArrivalInfo_t arrivalInfoList[ 3 ];
+    size_t packetSize = 100;
+    uint64_t sentTime = time( NULL );
+
+    result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                            &( twccPacketInfoArray[ 0 ] ),
+                                            TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                            RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* Add 65535 and 1, skipping 0. */
+    packetInfo.packetSize = packetSize;
+    packetInfo.localSentTime = sentTime;
+    packetInfo.packetSeqNum = 65535;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    packetInfo.localSentTime = sentTime + 2;
+    packetInfo.packetSeqNum = 1;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    arrivalInfoList[ 0 ].seqNum = 65535;
+    arrivalInfoList[ 0 ].remoteArrivalTime = sentTime;
+    arrivalInfoList[ 1 ].seqNum = 0;
+    arrivalInfoList[ 1 ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+    arrivalInfoList[ 2 ].seqNum = 1;
+    arrivalInfoList[ 2 ].remoteArrivalTime = sentTime + 2;
+
+    twccPacket.arrivalInfoListLength = 3;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+
+    result = RtcpTwccManager_HandleTwccPacket( &( twccManager ),
+                                               &( twccPacket ),
+                                               &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       bandwidthInfo.duration );
+    TEST_ASSERT_EQUAL( 2,
+                       bandwidthInfo.sentPackets );
+    TEST_ASSERT_EQUAL( 2 * packetSize,
+                       bandwidthInfo.sentBytes );
+    TEST_ASSERT_EQUAL( 2,
+                       bandwidthInfo.receivedPackets );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc Manager Handle packet functionality when the packet
+ * before the first packet in the feedback has no sent time.
+ */
+void test_twccHandlePacket_PreviousPacketNoSentTime( void )
+{
+    uint16_t seqNum = 256;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    RtcpTwccPacket_t twccPacket;
+    TwccBandwidthInfo_t bandwidthInfo = { 0 };
+    TwccPacketInfo_t packetInfo = { 0 };
+    PacketArrivalInfo_t arrivalInfoList[ 2 ];
+    size_t packetSize = 100;
+
+    result = RtcpTwccManager_Init( &( twccManager ),
+                                   &( twccPacketInfoArray[ 0 ] ),
+                                   TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    packetInfo.packetSize = packetSize;
+    packetInfo.localSentTime = RTCP_TWCC_PACKET_UNINITIALIZED_TIME;
+    packetInfo.packetSeqNum = seqNum - 1;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    packetInfo.localSentTime = 5;
+    packetInfo.packetSeqNum = seqNum;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    packetInfo.localSentTime = 8;
+    packetInfo.packetSeqNum = seqNum + 1;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    arrivalInfoList[ 0 ].seqNum = seqNum;
+    arrivalInfoList[ 0 ].remoteArrivalTime = 10;
+    arrivalInfoList[ 1 ].seqNum = seqNum + 1;
+    arrivalInfoList[ 1 ].remoteArrivalTime = 12;
+
+    twccPacket.arrivalInfoListLength = 2;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+
+    result = RtcpTwccManager_HandleTwccPacket( &( twccManager ),
+                                               &( twccPacket ),
+                                               &( bandwidthInfo ) );
+
+    /* The start time falls back to the sent time of the first packet in the
+     * feedback. */
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 3,
+                       bandwidthInfo.duration );
+    TEST_ASSERT_EQUAL( 2,
+                       bandwidthInfo.sentPackets );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc Manager Init with power of two length flag.
+ */
+void test_twccInitWithFlags_PowerOfTwoLength( void )
+{
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+
+    result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                            &( twccPacketInfoArray[ 0 ] ),
+                                            TWCC_PACKET_INFO_ARRAY_LENGTH - 1,
+                                            RTCP_TWCC_MANAGER_FLAG_POWER_OF_TWO_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                            &( twccPacketInfoArray[ 0 ] ),
+                                            TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                            RTCP_TWCC_MANAGER_FLAG_POWER_OF_TWO_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH - 1,
+                       twccManager.indexMask );
+
+    result = RtcpTwccManager_Init( &( twccManager ),
+                                   &( twccPacketInfoArray[ 0 ] ),
+                                   TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       twccManager.indexMask );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc Manager Add, Find and Handle packet functionality with
+ * power of two length.
+ */
+void test_twccHandlePacket_PowerOfTwoLength( void )
+{
+    uint16_t seqNum = 256;
+    uint32_t i;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    RtcpTwccPacket_t twccPacket;
+    TwccBandwidthInfo_t bandwidthInfo = { 0 };
+    TwccPacketInfo_t packetInfo = { 0 };
+    TwccPacketInfo_t * pFoundTwccPacketInfo;
+    PacketArrivalInfo_t arrivalInfoList[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
+    size_t packetSize = 100;
+    uint64_t sentTime = time( NULL );
+
+    result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                            &( twccPacketInfoArray[ 0 ] ),
+                                            TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                            RTCP_TWCC_MANAGER_FLAG_POWER_OF_TWO_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* Add more packets than the array length so that indices wrap around. */
+    for( i = 0; i < ( TWCC_PACKET_INFO_ARRAY_LENGTH + ( TWCC_PACKET_INFO_ARRAY_LENGTH / 2 ) ); i++ )
+    {
+        packetInfo.packetSize = packetSize;
+        packetInfo.localSentTime = sentTime + ( uint64_t ) i;
+        packetInfo.packetSeqNum = seqNum + ( uint16_t ) i;
+
+        result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                                &( packetInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH,
+                       twccManager.count );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH / 2,
+                       twccManager.readIndex );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + ( TWCC_PACKET_INFO_ARRAY_LENGTH / 2 ) - 1,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+
+    for( i = 0; i < TWCC_PACKET_INFO_ARRAY_LENGTH; i++ )
+    {
+        arrivalInfoList[ i ].seqNum = seqNum + ( TWCC_PACKET_INFO_ARRAY_LENGTH / 2 ) + ( uint16_t ) i;
+        arrivalInfoList[ i ].remoteArrivalTime = sentTime + ( uint64_t ) i;
+    }
+
+    twccPacket.arrivalInfoListLength = TWCC_PACKET_INFO_ARRAY_LENGTH;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+
+    result = RtcpTwccManager_HandleTwccPacket( &( twccManager ),
+                                               &( twccPacket ),
+                                               &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH - 1,
+                       bandwidthInfo.duration );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH,
+                       bandwidthInfo.sentPackets );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH,
+                       bandwidthInfo.receivedPackets );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc SPSC Manager functionality for Bad Parameters.
+ */
+void test_twccSpscManager_BadParams( void )
+{
+    RtcpTwccSpscManager_t twccSpscManager;
+    RtcpTwccManagerResult_t result;
+    RtcpTwccPacket_t twccPacket = { 0 };
+    TwccBandwidthInfo_t bandwidthInfo;
+    TwccPacketInfo_t packetInfo = { 0 };
+
+    result = RtcpTwccSpscManager_Init( NULL,
+                                       &( twccPacketInfoArray[ 0 ] ),
+                                       TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccSpscManager_Init( &( twccSpscManager ),
+                                       NULL,
+                                       TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccSpscManager_Init( &( twccSpscManager ),
+                                       &( twccPacketInfoArray[ 0 ] ),
+                                       0 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    /* Array length must be a power of two. */
+    result = RtcpTwccSpscManager_Init( &( twccSpscManager ),
+                                       &( twccPacketInfoArray[ 0 ] ),
+                                       TWCC_PACKET_INFO_ARRAY_LENGTH - 1 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    /* Longer than 16-bit sequence numbers can match. */
+    result = RtcpTwccSpscManager_Init( &( twccSpscManager ),
+                                       &( twccLongPacketInfoArray[ 0 ] ),
+                                       RTCP_TWCC_MANAGER_MAX_LINEAR_LENGTH * 2 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccSpscManager_Init( &( twccSpscManager ),
+                                       &( twccPacketInfoArray[ 0 ] ),
+                                       TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    result = RtcpTwccSpscManager_AddPacketInfo( NULL,
+                                                &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccSpscManager_AddPacketInfo( &( twccSpscManager ),
+                                                NULL );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccSpscManager_HandleTwccPacket( NULL,
+                                                   &( twccPacket ),
+                                                   &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccSpscManager_HandleTwccPacket( &( twccSpscManager ),
+                                                   NULL,
+                                                   &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccSpscManager_HandleTwccPacket( &( twccSpscManager ),
+                                                   &( twccPacket ),
+                                                   NULL );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that Twcc SPSC Manager reports full instead of overwriting
+ * packet infos not yet released by the consumer.
+ */
+void test_twccSpscManager_Full( void )
+{
+    uint16_t seqNum = 65530;
+    uint32_t i;
+    RtcpTwccSpscManager_t twccSpscManager;
+    RtcpTwccManagerResult_t result;
+    RtcpTwccPacket_t twccPacket;
+    TwccBandwidthInfo_t bandwidthInfo;
+    TwccPacketInfo_t packetInfo = { 0 };
+    PacketArrivalInfo_t arrivalInfoList[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
+    size_t packetSize = 100;
+    uint64_t sentTime = 1000;
+
+    result = RtcpTwccSpscManager_Init( &( twccSpscManager ),
+                                       &( twccPacketInfoArray[ 0 ] ),
+                                       TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* Handling a TWCC packet with no packet info must not release anything. */
+    twccPacket.arrivalInfoListLength = 0;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+
+    result = RtcpTwccSpscManager_HandleTwccPacket( &( twccSpscManager ),
+                                                   &( twccPacket ),
+                                                   &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       twccSpscManager.readIndex );
+
+    for( i = 0; i < TWCC_PACKET_INFO_ARRAY_LENGTH; i++ )
+    {
+        packetInfo.packetSize = packetSize;
+        packetInfo.localSentTime = sentTime + ( uint64_t ) i;
+        packetInfo.packetSeqNum = seqNum + ( uint16_t ) i;
+
+        result = RtcpTwccSpscManager_AddPacketInfo( &( twccSpscManager ),
+                                                    &( packetInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    result = RtcpTwccSpscManager_AddPacketInfo( &( twccSpscManager ),
+                                                &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_FULL,
+                       result );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH,
+                       twccSpscManager.writeIndex );
+
+    for( i = 0; i < TWCC_PACKET_INFO_ARRAY_LENGTH; i++ )
+    {
+        arrivalInfoList[ i ].seqNum = seqNum + ( uint16_t ) i;
+        arrivalInfoList[ i ].remoteArrivalTime = sentTime + ( uint64_t ) i;
+    }
+
+    twccPacket.arrivalInfoListLength = TWCC_PACKET_INFO_ARRAY_LENGTH;
+
+    result = RtcpTwccSpscManager_HandleTwccPacket( &( twccSpscManager ),
+                                                   &( twccPacket ),
+                                                   &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH - 1,
+                       bandwidthInfo.duration );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH,
+                       bandwidthInfo.sentPackets );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH * packetSize,
+                       bandwidthInfo.sentBytes );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH,
+                       bandwidthInfo.receivedPackets );
+
+    /* All the packet infos are covered by the TWCC packet and released, even
+     * though they are within the time window. */
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH,
+                       twccSpscManager.readIndex );
+
+    packetInfo.packetSeqNum = seqNum + ( uint16_t ) TWCC_PACKET_INFO_ARRAY_LENGTH;
+
+    result = RtcpTwccSpscManager_AddPacketInfo( &( twccSpscManager ),
+                                                &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that Twcc SPSC Manager never reports full with sustained
+ * traffic and a ring holding fewer packet infos than the time window.
+ */
+void test_twccSpscManager_SustainedTraffic( void )
+{
+    uint16_t seqNum = 65000;
+    uint32_t i;
+    uint32_t feedbackInterval = 8;
+    RtcpTwccSpscManager_t twccSpscManager;
+    RtcpTwccManagerResult_t result;
+    RtcpTwccPacket_t twccPacket;
+    TwccBandwidthInfo_t bandwidthInfo;
+    TwccPacketInfo_t packetInfo = { 0 };
+    PacketArrivalInfo_t arrivalInfoList[ 8 ];
+    /* 2000 packets per second. */
+    uint64_t sendInterval = RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND / 2000;
+
+    result = RtcpTwccSpscManager_Init( &( twccSpscManager ),
+                                       &( twccPacketInfoArray[ 0 ] ),
+                                       TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+    twccPacket.arrivalInfoListLength = feedbackInterval;
+
+    for( i = 0; i < ( 100 * TWCC_PACKET_INFO_ARRAY_LENGTH ); i++ )
+    {
+        packetInfo.packetSize = 100;
+        packetInfo.packetSeqNum = seqNum + ( uint16_t ) i;
+        packetInfo.localSentTime = ( uint64_t ) i * sendInterval;
+
+        result = RtcpTwccSpscManager_AddPacketInfo( &( twccSpscManager ),
+                                                    &( packetInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+
+        arrivalInfoList[ i % feedbackInterval ].seqNum = packetInfo.packetSeqNum;
+        arrivalInfoList[ i % feedbackInterval ].remoteArrivalTime = packetInfo.localSentTime;
+
+        if( ( i % feedbackInterval ) == ( feedbackInterval - 1 ) )
+        {
+            result = RtcpTwccSpscManager_HandleTwccPacket( &( twccSpscManager ),
+                                                           &( twccPacket ),
+                                                           &( bandwidthInfo ) );
+
+            TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                               result );
+            TEST_ASSERT_EQUAL( feedbackInterval,
+                               bandwidthInfo.sentPackets );
+            TEST_ASSERT_EQUAL( twccSpscManager.writeIndex,
+                               twccSpscManager.readIndex );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that Twcc SPSC Manager releases older packet infos to the
+ * producer when handling a TWCC packet.
+ */
+void test_twccSpscManager_OlderPacketInfoDeletion( void )
+{
+    uint16_t seqNum = 256;
+    uint32_t i;
+    RtcpTwccSpscManager_t twccSpscManager;
+    RtcpTwccManagerResult_t result;
+    RtcpTwccPacket_t twccPacket;
+    TwccBandwidthInfo_t bandwidthInfo;
+    TwccPacketInfo_t packetInfo = { 0 };
+    PacketArrivalInfo_t arrivalInfoList[ 2 ];
+    size_t packetSize = 100;
+    uint64_t sentTime = RTCP_TWCC_ESTIMATOR_TIME_WINDOW;
+
+    result = RtcpTwccSpscManager_Init( &( twccSpscManager ),
+                                       &( twccPacketInfoArray[ 0 ] ),
+                                       TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* Packet infos 0 - 3 are older than the time window with respect to the
+     * newest one and packet info 4 was sent "later" than the newest one (i.e.
+     * the clock was adjusted). */
+    for( i = 0; i < 8; i++ )
+    {
+        packetInfo.packetSize = packetSize;
+        packetInfo.packetSeqNum = seqNum + ( uint16_t ) i;
+
+        if( i < 4 )
+        {
+            packetInfo.localSentTime = ( uint64_t ) i;
+        }
+        else if( i == 4 )
+        {
+            packetInfo.localSentTime = ( 2 * sentTime ) + 1;
+        }
+        else
+        {
+            packetInfo.localSentTime = 2 * sentTime;
+        }
+
+        result = RtcpTwccSpscManager_AddPacketInfo( &( twccSpscManager ),
+                                                    &( packetInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    arrivalInfoList[ 0 ].seqNum = seqNum + 3;
+    arrivalInfoList[ 0 ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+    arrivalInfoList[ 1 ].seqNum = seqNum + 4;
+    arrivalInfoList[ 1 ].remoteArrivalTime = 1;
+
+    twccPacket.arrivalInfoListLength = 2;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+
+    result = RtcpTwccSpscManager_HandleTwccPacket( &( twccSpscManager ),
+                                                   &( twccPacket ),
+                                                   &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1,
+                       bandwidthInfo.sentPackets );
+
+    /* Packet infos 0 - 3 are released because they are older than the time
+     * window and packet info 4 because the TWCC packet covers it. */
+    TEST_ASSERT_EQUAL( 5,
+                       twccSpscManager.readIndex );
+    TEST_ASSERT_EQUAL( packetSize,
+                       bandwidthInfo.receivedBytes );
+
+    /* Packet infos 5 - 7 are within the time window of this packet info. */
+    packetInfo.localSentTime = 3 * sentTime;
+    packetInfo.packetSeqNum = seqNum + 8;
+
+    result = RtcpTwccSpscManager_AddPacketInfo( &( twccSpscManager ),
+                                                &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    twccPacket.arrivalInfoListLength = 0;
+
+    result = RtcpTwccSpscManager_HandleTwccPacket( &( twccSpscManager ),
+                                                   &( twccPacket ),
+                                                   &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 5,
+                       twccSpscManager.readIndex );
+
+    /* A packet info far ahead of the rest releases all but the newest packet
+     * info. */
+    packetInfo.localSentTime = 5 * sentTime;
+    packetInfo.packetSeqNum = seqNum + 9;
+
+    result = RtcpTwccSpscManager_AddPacketInfo( &( twccSpscManager ),
+                                                &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    result = RtcpTwccSpscManager_HandleTwccPacket( &( twccSpscManager ),
+                                                   &( twccPacket ),
+                                                   &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 9,
+                       twccSpscManager.readIndex );
+    TEST_ASSERT_EQUAL( 10,
+                       twccSpscManager.writeIndex );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that Twcc SPSC Manager releases packet infos older than a
+ * non-default time window.
+ */
+void test_twccSpscManager_SetTimeWindow( void )
+{
+    uint16_t seqNum = 256;
+    uint32_t i;
+    RtcpTwccSpscManager_t twccSpscManager;
+    RtcpTwccManagerResult_t result;
+    RtcpTwccPacket_t twccPacket = { 0 };
+    TwccBandwidthInfo_t bandwidthInfo;
+    TwccPacketInfo_t packetInfo = { 0 };
+    PacketArrivalInfo_t arrivalInfoList[ 1 ];
+    uint64_t timeWindow = 100;
+
+    result = RtcpTwccSpscManager_Init( &( twccSpscManager ),
+                                       &( twccPacketInfoArray[ 0 ] ),
+                                       TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( RTCP_TWCC_ESTIMATOR_TIME_WINDOW,
+                              twccSpscManager.timeWindow );
+
+    result = RtcpTwccSpscManager_SetTimeWindow( NULL,
+                                                timeWindow );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccSpscManager_SetTimeWindow( &( twccSpscManager ),
+                                                0 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccSpscManager_SetTimeWindow( &( twccSpscManager ),
+                                                timeWindow );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( timeWindow,
+                              twccSpscManager.timeWindow );
+
+    /* Packet infos sent 50 apart, i.e. the 3 oldest ones are more than the
+     * time window older than the newest one. */
+    for( i = 0; i < 6; i++ )
+    {
+        packetInfo.packetSize = 100;
+        packetInfo.packetSeqNum = seqNum + ( uint16_t ) i;
+        packetInfo.localSentTime = 1000 + ( ( uint64_t ) i * 50 );
+
+        result = RtcpTwccSpscManager_AddPacketInfo( &( twccSpscManager ),
+                                                    &( packetInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    twccPacket.arrivalInfoListLength = 0;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+
+    result = RtcpTwccSpscManager_HandleTwccPacket( &( twccSpscManager ),
+                                                   &( twccPacket ),
+                                                   &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 3,
+                       twccSpscManager.readIndex );
+
+    arrivalInfoList[ 0 ].seqNum = seqNum + 3;
+    arrivalInfoList[ 0 ].remoteArrivalTime = 1;
+
+    twccPacket.arrivalInfoListLength = 1;
+
+    result = RtcpTwccSpscManager_HandleTwccPacket( &( twccSpscManager ),
+                                                   &( twccPacket ),
+                                                   &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 4,
+                       twccSpscManager.readIndex );
+    TEST_ASSERT_EQUAL( 1,
+                       bandwidthInfo.sentPackets );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc Manager compact init and add fail functionality for Bad
+ * Parameters.
+ */
+void test_twccInitCompact_BadParams( void )
+{
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    TwccCompactPacketInfoArrays_t badCompactArrays;
+    TwccPacketInfo_t packetInfo = { 0 };
+
+    result = RtcpTwccManager_InitCompact( NULL,
+                                          &( compactArrays ),
+                                          TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                          RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccManager_InitCompact( &( twccManager ),
+                                          NULL,
+                                          TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                          RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    badCompactArrays = compactArrays;
+    badCompactArrays.pSeqNumArray = NULL;
+
+    result = RtcpTwccManager_InitCompact( &( twccManager ),
+                                          &( badCompactArrays ),
+                                          TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                          RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    badCompactArrays = compactArrays;
+    badCompactArrays.pRelativeSentTimeArray = NULL;
+
+    result = RtcpTwccManager_InitCompact( &( twccManager ),
+                                          &( badCompactArrays ),
+                                          TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                          RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    badCompactArrays = compactArrays;
+    badCompactArrays.pPacketSizeArray = NULL;
+
+    result = RtcpTwccManager_InitCompact( &( twccManager ),
+                                          &( badCompactArrays ),
+                                          TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                          RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccManager_InitCompact( &( twccManager ),
+                                          &( compactArrays ),
+                                          0,
+                                          RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    /* Compact storage is selected by the init function, not by a flag. */
+    result = RtcpTwccManager_InitCompact( &( twccManager ),
+                                          &( compactArrays ),
+                                          TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                          0x80000000 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccManager_InitCompact( &( twccManager ),
+                                          &( compactArrays ),
+                                          TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                          RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* Packet size does not fit in 16 bits. */
+    packetInfo.packetSize = UINT16_MAX + 1;
+    packetInfo.localSentTime = 1;
+    packetInfo.packetSeqNum = 1;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       twccManager.count );
+
+    /* Packet infos without sent time are stored as is. */
+    packetInfo.packetSize = UINT16_MAX;
+    packetInfo.localSentTime = RTCP_TWCC_PACKET_UNINITIALIZED_TIME;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1,
+                       twccManager.count );
+    TEST_ASSERT_EQUAL( UINT16_MAX,
+                       packetSizeArray[ 0 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc Manager Add, Find and Handle packet functionality with
+ * compact storage.
+ */
+void test_twccHandlePacket_CompactStorage( void )
+{
+    uint16_t seqNum = 65520;
+    uint32_t i;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    RtcpTwccPacket_t twccPacket;
+    TwccBandwidthInfo_t bandwidthInfo;
+    TwccPacketInfo_t packetInfo = { 0 };
+    TwccPacketInfo_t * pFoundTwccPacketInfo;
+    PacketArrivalInfo_t arrivalInfoList[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
+    uint64_t sentTime = 0x123456789ULL;
+
+    result = RtcpTwccManager_InitCompact( &( twccManager ),
+                                          &( compactArrays ),
+                                          TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                          RTCP_TWCC_MANAGER_FLAG_POWER_OF_TWO_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* Add more packets than the array length so that indices wrap around. */
+    for( i = 0; i < ( TWCC_PACKET_INFO_ARRAY_LENGTH + ( TWCC_PACKET_INFO_ARRAY_LENGTH / 2 ) ); i++ )
+    {
+        packetInfo.packetSize = 1000 + ( size_t ) i;
+        packetInfo.localSentTime = sentTime + ( uint64_t ) i;
+        packetInfo.packetSeqNum = seqNum + ( uint16_t ) i;
+
+        result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                                &( packetInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH,
+                       twccManager.count );
+    TEST_ASSERT_EQUAL( sentTime - 1,
+                       twccManager.baseSentTime );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + ( TWCC_PACKET_INFO_ARRAY_LENGTH / 2 ) - 1,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_PTR( &( twccManager.foundTwccPacketInfo ),
+                           pFoundTwccPacketInfo );
+    TEST_ASSERT_EQUAL( ( uint16_t ) ( seqNum + TWCC_PACKET_INFO_ARRAY_LENGTH ),
+                       pFoundTwccPacketInfo->packetSeqNum );
+    TEST_ASSERT_EQUAL_UINT64( sentTime + TWCC_PACKET_INFO_ARRAY_LENGTH,
+                              pFoundTwccPacketInfo->localSentTime );
+    TEST_ASSERT_EQUAL( 1000 + TWCC_PACKET_INFO_ARRAY_LENGTH,
+                       pFoundTwccPacketInfo->packetSize );
+
+    for( i = 0; i < TWCC_PACKET_INFO_ARRAY_LENGTH; i++ )
+    {
+        arrivalInfoList[ i ].seqNum = seqNum + ( TWCC_PACKET_INFO_ARRAY_LENGTH / 2 ) + ( uint16_t ) i;
+        arrivalInfoList[ i ].remoteArrivalTime = ( ( i % 2 ) == 0 ) ? RTCP_TWCC_PACKET_LOST_TIME : 1;
+    }
+
+    twccPacket.arrivalInfoListLength = TWCC_PACKET_INFO_ARRAY_LENGTH;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+
+    result = RtcpTwccManager_HandleTwccPacket( &( twccManager ),
+                                               &( twccPacket ),
+                                               &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH - 1,
+                       bandwidthInfo.duration );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH,
+                       bandwidthInfo.sentPackets );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH / 2,
+                       bandwidthInfo.receivedPackets );
+    /* Sizes 1016 to 1047, received ones are 1017, 1019, ..., 1047. */
+    TEST_ASSERT_EQUAL( ( 1016 + 1047 ) * 16,
+                       bandwidthInfo.sentBytes );
+    TEST_ASSERT_EQUAL( ( 1017 + 1047 ) * 8,
+                       bandwidthInfo.receivedBytes );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc Manager sequence number indexed mode with compact
+ * storage.
+ */
+void test_twccHandlePacket_CompactStorageSeqNumIndexed( void )
+{
+    uint16_t seqNum = 100;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    RtcpTwccPacket_t twccPacket;
+    TwccBandwidthInfo_t bandwidthInfo;
+    TwccPacketInfo_t packetInfo = { 0 };
+    TwccPacketInfo_t * pFoundTwccPacketInfo;
+    PacketArrivalInfo_t arrivalInfoList[ 3 ];
+
+    result = RtcpTwccManager_InitCompact( &( twccManager ),
+                                          &( compactArrays ),
+                                          TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                          RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    packetInfo.packetSize = 100;
+    packetInfo.localSentTime = 10;
+    packetInfo.packetSeqNum = seqNum;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* Skip seqNum + 1. */
+    packetInfo.packetSize = 300;
+    packetInfo.localSentTime = 30;
+    packetInfo.packetSeqNum = seqNum + 2;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 3,
+                       twccManager.count );
+    TEST_ASSERT_EQUAL( 0,
+                       relativeSentTimeArray[ 1 ] );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + 1,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+
+    arrivalInfoList[ 0 ].seqNum = seqNum;
+    arrivalInfoList[ 0 ].remoteArrivalTime = 1;
+    arrivalInfoList[ 1 ].seqNum = seqNum + 1;
+    arrivalInfoList[ 1 ].remoteArrivalTime = 2;
+    arrivalInfoList[ 2 ].seqNum = seqNum + 2;
+    arrivalInfoList[ 2 ].remoteArrivalTime = 3;
+
+    twccPacket.arrivalInfoListLength = 3;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+
+    result = RtcpTwccManager_HandleTwccPacket( &( twccManager ),
+                                               &( twccPacket ),
+                                               &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 20,
+                       bandwidthInfo.duration );
+    TEST_ASSERT_EQUAL( 2,
+                       bandwidthInfo.sentPackets );
+    TEST_ASSERT_EQUAL( 400,
+                       bandwidthInfo.receivedBytes );
+
+    /* Jump more than the relative sent time range ahead of the tracked packet
+     * infos, which can't be kept with a common base. */
+    packetInfo.packetSize = 400;
+    packetInfo.localSentTime = 0x100000000ULL + 40;
+    packetInfo.packetSeqNum = seqNum + 3;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1,
+                       twccManager.count );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + 2,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + 3,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( 0x100000000ULL + 40,
+                              pFoundTwccPacketInfo->localSentTime );
+    TEST_ASSERT_EQUAL( 400,
+                       pFoundTwccPacketInfo->packetSize );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that Twcc Manager with compact storage keeps tracked packet
+ * infos when the relative sent times need a new base.
+ */
+void test_twccAddPacket_CompactStorageRebase( void )
+{
+    uint16_t seqNum = 100;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    TwccPacketInfo_t packetInfo = { 0 };
+    TwccPacketInfo_t * pFoundTwccPacketInfo;
+    uint64_t sentTime = 0xFFFFFF00ULL;
+
+    result = RtcpTwccManager_InitCompact( &( twccManager ),
+                                          &( compactArrays ),
+                                          TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                          RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    packetInfo.packetSize = 100;
+    packetInfo.localSentTime = sentTime;
+    packetInfo.packetSeqNum = seqNum;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( 0,
+                              twccManager.baseSentTime );
+
+    /* Skip seqNum + 1 and cross the relative sent time range. */
+    packetInfo.packetSize = 300;
+    packetInfo.localSentTime = sentTime + 0x200;
+    packetInfo.packetSeqNum = seqNum + 2;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 3,
+                       twccManager.count );
+    TEST_ASSERT_EQUAL_UINT64( sentTime - 1,
+                              twccManager.baseSentTime );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( sentTime,
+                              pFoundTwccPacketInfo->localSentTime );
+
+    /* A late packet sent before the base, i.e. after a clock adjustment. */
+    packetInfo.packetSize = 200;
+    packetInfo.localSentTime = sentTime - 0x10;
+    packetInfo.packetSeqNum = seqNum + 1;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( sentTime - 0x11,
+                              twccManager.baseSentTime );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + 1,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( sentTime - 0x10,
+                              pFoundTwccPacketInfo->localSentTime );
+    TEST_ASSERT_EQUAL( 200,
+                       pFoundTwccPacketInfo->packetSize );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + 2,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( sentTime + 0x200,
+                              pFoundTwccPacketInfo->localSentTime );
+    TEST_ASSERT_EQUAL( 300,
+                       pFoundTwccPacketInfo->packetSize );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that Twcc Manager feeds received packets to the attached
+ * delay based estimator.
+ */
+void test_twccHandlePacket_DelayBasedEstimator( void )
+{
+    uint16_t seqNum = 256;
+    uint32_t i;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    RtcpDelayBasedEstimator_t delayBasedEstimator;
+    RtcpTwccPacket_t twccPacket;
+    TwccBandwidthInfo_t bandwidthInfo;
+    TwccPacketInfo_t packetInfo = { 0 };
+    PacketArrivalInfo_t arrivalInfoList[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
+    size_t packetSize = 1000;
+    uint64_t sentTime = RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND;
+
+    result = RtcpTwccManager_SetDelayBasedEstimator( NULL,
+                                                     &( delayBasedEstimator ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccManager_Init( &( twccManager ),
+                                   &( twccPacketInfoArray[ 0 ] ),
+                                   TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_NULL( twccManager.pDelayBasedEstimator );
+
+    TEST_ASSERT_EQUAL( RTCP_DELAY_BASED_ESTIMATOR_RESULT_OK,
+                       RtcpDelayBasedEstimator_Init( &( delayBasedEstimator ),
+                                                     1000000,
+                                                     100000,
+                                                     2000000 ) );
+
+    result = RtcpTwccManager_SetDelayBasedEstimator( &( twccManager ),
+                                                     &( delayBasedEstimator ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* Packets are sent 10 ms apart. */
+    for( i = 0; i < TWCC_PACKET_INFO_ARRAY_LENGTH; i++ )
+    {
+        packetInfo.packetSize = packetSize;
+        packetInfo.localSentTime = sentTime + ( ( uint64_t ) i * 100000 );
+        packetInfo.packetSeqNum = seqNum + ( uint16_t ) i;
+
+        result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                                &( packetInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    /* The last packet is lost. */
+    for( i = 0; i < TWCC_PACKET_INFO_ARRAY_LENGTH; i++ )
+    {
+        arrivalInfoList[ i ].seqNum = seqNum + ( uint16_t ) i;
+        arrivalInfoList[ i ].remoteArrivalTime = 5 * sentTime + ( ( uint64_t ) i * 100000 );
+    }
+
+    arrivalInfoList[ TWCC_PACKET_INFO_ARRAY_LENGTH - 1 ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+
+    twccPacket.arrivalInfoListLength = TWCC_PACKET_INFO_ARRAY_LENGTH;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+
+    result = RtcpTwccManager_HandleTwccPacket( &( twccManager ),
+                                               &( twccPacket ),
+                                               &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH - 1,
+                       bandwidthInfo.receivedPackets );
+    /* Each packet is a group, the first two groups produce no delta. */
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH - 3,
+                       delayBasedEstimator.numDeltas );
+    TEST_ASSERT_EQUAL_UINT64( sentTime + ( ( uint64_t ) ( TWCC_PACKET_INFO_ARRAY_LENGTH - 2 ) * 100000 ),
+                              delayBasedEstimator.currentGroup.firstSentTime );
+    TEST_ASSERT_EQUAL( RTCP_BANDWIDTH_USAGE_NORMAL,
+                       delayBasedEstimator.bandwidthUsage );
+    TEST_ASSERT_GREATER_THAN( 1000000,
+                              delayBasedEstimator.targetBitrateBps );
+
+    /* Detach the estimator. */
+    result = RtcpTwccManager_SetDelayBasedEstimator( &( twccManager ),
+                                                     NULL );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    result = RtcpTwccManager_HandleTwccPacket( &( twccManager ),
+                                               &( twccPacket ),
+                                               &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH - 3,
+                       delayBasedEstimator.numDeltas );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate TWCC packet handling with per packet feedback output.
+ */
+void test_twccHandlePacket_WithFeedback( void )
+{
+    uint16_t seqNum = 65534;
+    uint32_t i;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    RtcpTwccPacket_t twccPacket;
+    TwccBandwidthInfo_t bandwidthInfo;
+    TwccPacketInfo_t packetInfo = { 0 };
+    PacketArrivalInfo_t arrivalInfoList[ 6 ];
+    TwccPacketFeedback_t packetFeedbackArray[ 6 ];
+    size_t packetFeedbackCount = 0;
+    uint64_t sentTime = RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND;
+
+    result = RtcpTwccManager_Init( &( twccManager ),
+                                   &( twccPacketInfoArray[ 0 ] ),
+                                   TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* Add 5 packets, with wrapping sequence numbers. */
+    for( i = 0; i < 5; i++ )
+    {
+        packetInfo.packetSize = 100 + i;
+        packetInfo.localSentTime = sentTime + i;
+        packetInfo.packetSeqNum = seqNum + ( uint16_t ) i;
+
+        result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                                &( packetInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    /* The 3rd packet is lost and the last arrival info does not match any
+     * packet info. */
+    for( i = 0; i < 6; i++ )
+    {
+        arrivalInfoList[ i ].seqNum = seqNum + ( uint16_t ) i;
+        arrivalInfoList[ i ].remoteArrivalTime = 2 * sentTime + i;
+    }
+
+    arrivalInfoList[ 2 ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+
+    twccPacket.arrivalInfoListLength = 6;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+
+    result = RtcpTwccManager_HandleTwccPacketWithFeedback( NULL,
+                                                           &( twccPacket ),
+                                                           &( bandwidthInfo ),
+                                                           &( packetFeedbackArray[ 0 ] ),
+                                                           6,
+                                                           &( packetFeedbackCount ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccManager_HandleTwccPacketWithFeedback( &( twccManager ),
+                                                           NULL,
+                                                           &( bandwidthInfo ),
+                                                           &( packetFeedbackArray[ 0 ] ),
+                                                           6,
+                                                           &( packetFeedbackCount ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccManager_HandleTwccPacketWithFeedback( &( twccManager ),
+                                                           &( twccPacket ),
+                                                           NULL,
+                                                           &( packetFeedbackArray[ 0 ] ),
+                                                           6,
+                                                           &( packetFeedbackCount ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccManager_HandleTwccPacketWithFeedback( &( twccManager ),
+                                                           &( twccPacket ),
+                                                           &( bandwidthInfo ),
+                                                           NULL,
+                                                           6,
+                                                           &( packetFeedbackCount ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccManager_HandleTwccPacketWithFeedback( &( twccManager ),
+                                                           &( twccPacket ),
+                                                           &( bandwidthInfo ),
+                                                           &( packetFeedbackArray[ 0 ] ),
+                                                           6,
+                                                           NULL );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    /* Feedback array smaller than the arrival info list. */
+    result = RtcpTwccManager_HandleTwccPacketWithFeedback( &( twccManager ),
+                                                           &( twccPacket ),
+                                                           &( bandwidthInfo ),
+                                                           &( packetFeedbackArray[ 0 ] ),
+                                                           5,
+                                                           &( packetFeedbackCount ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccManager_HandleTwccPacketWithFeedback( &( twccManager ),
+                                                           &( twccPacket ),
+                                                           &( bandwidthInfo ),
+                                                           &( packetFeedbackArray[ 0 ] ),
+                                                           6,
+                                                           &( packetFeedbackCount ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 5,
+                       bandwidthInfo.sentPackets );
+    TEST_ASSERT_EQUAL( 4,
+                       bandwidthInfo.receivedPackets );
+    TEST_ASSERT_EQUAL( 5,
+                       packetFeedbackCount );
+
+    for( i = 0; i < 5; i++ )
+    {
+        TEST_ASSERT_EQUAL( ( uint16_t ) ( seqNum + i ),
+                           packetFeedbackArray[ i ].packetSeqNum );
+        TEST_ASSERT_EQUAL_UINT64( sentTime + i,
+                                  packetFeedbackArray[ i ].localSentTime );
+        TEST_ASSERT_EQUAL_UINT64( arrivalInfoList[ i ].remoteArrivalTime,
+                                  packetFeedbackArray[ i ].remoteArrivalTime );
+        TEST_ASSERT_EQUAL( 100 + i,
+                           packetFeedbackArray[ i ].packetSize );
+    }
+
+    TEST_ASSERT_EQUAL_UINT64( RTCP_TWCC_PACKET_LOST_TIME,
+                              packetFeedbackArray[ 2 ].remoteArrivalTime );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate sequence number unwrapping.
+ */
+void test_twccSeqNumUnwrapper( void )
+{
+    RtcpTwccSeqNumUnwrapper_t seqNumUnwrapper;
+    RtcpTwccManagerResult_t result;
+    uint64_t extendedSeqNum;
+
+    result = RtcpTwccSeqNumUnwrapper_Init( NULL );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccSeqNumUnwrapper_Init( &( seqNumUnwrapper ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    result = RtcpTwccSeqNumUnwrapper_Unwrap( NULL,
+                                             0,
+                                             &( extendedSeqNum ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccSeqNumUnwrapper_Unwrap( &( seqNumUnwrapper ),
+                                             0,
+                                             NULL );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    /* The first sequence number is unwrapped to itself. */
+    result = RtcpTwccSeqNumUnwrapper_Unwrap( &( seqNumUnwrapper ),
+                                             65535,
+                                             &( extendedSeqNum ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( 65535,
+                              extendedSeqNum );
+
+    /* Forward across the wrap. */
+    result = RtcpTwccSeqNumUnwrapper_Unwrap( &( seqNumUnwrapper ),
+                                             10,
+                                             &( extendedSeqNum ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( 65546,
+                              extendedSeqNum );
+
+    /* Backward across the wrap. */
+    result = RtcpTwccSeqNumUnwrapper_Unwrap( &( seqNumUnwrapper ),
+                                             65530,
+                                             &( extendedSeqNum ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( 65530,
+                              extendedSeqNum );
+
+    /* Forward by almost half of the range, twice. */
+    result = RtcpTwccSeqNumUnwrapper_Unwrap( &( seqNumUnwrapper ),
+                                             ( uint16_t ) ( 65530 + 32767 ),
+                                             &( extendedSeqNum ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( 65530 + 32767,
+                              extendedSeqNum );
+
+    result = RtcpTwccSeqNumUnwrapper_Unwrap( &( seqNumUnwrapper ),
+                                             ( uint16_t ) ( 65530 + 65534 ),
+                                             &( extendedSeqNum ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( 65530 + 65534,
+                              extendedSeqNum );
+
+    /* Extended sequence numbers do not go below zero. */
+    result = RtcpTwccSeqNumUnwrapper_Init( &( seqNumUnwrapper ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    result = RtcpTwccSeqNumUnwrapper_Unwrap( &( seqNumUnwrapper ),
+                                             5,
+                                             &( extendedSeqNum ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( 5,
+                              extendedSeqNum );
+
+    result = RtcpTwccSeqNumUnwrapper_Unwrap( &( seqNumUnwrapper ),
+                                             65530,
+                                             &( extendedSeqNum ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( 65530,
+                              extendedSeqNum );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the sequence number indexed mode with a history longer than
+ * half of the sequence number range.
+ */
+void test_twccAddPacket_SeqNumIndexedLongHistory( void )
+{
+    uint16_t seqNum = 60000;
+    uint32_t i;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    TwccPacketInfo_t twccPacketInfo = { 0 };
+    TwccPacketInfo_t * pFoundTwccPacketInfo;
+    uint64_t sentTime = RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND;
+    RtcpTwccPacket_t twccPacket;
+    TwccBandwidthInfo_t bandwidthInfo;
+    PacketArrivalInfo_t arrivalInfoList[ 2 ];
+
+    result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                            &( twccLongPacketInfoArray[ 0 ] ),
+                                            TWCC_LONG_PACKET_INFO_ARRAY_LENGTH,
+                                            RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    result = RtcpTwccManager_FindPacketInfoExtended( NULL,
+                                                     seqNum,
+                                                     &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccManager_FindPacketInfoExtended( &( twccManager ),
+                                                     seqNum,
+                                                     NULL );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccManager_FindPacketInfoExtended( &( twccManager ),
+                                                     seqNum,
+                                                     &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_EMPTY,
+                       result );
+
+    /* Sequence numbers wrap while the history is filled. */
+    for( i = 0; i < TWCC_LONG_PACKET_INFO_ARRAY_LENGTH; i++ )
+    {
+        twccPacketInfo.packetSize = 100;
+        twccPacketInfo.localSentTime = sentTime + i;
+        twccPacketInfo.packetSeqNum = ( uint16_t ) ( seqNum + i );
+
+        result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                                &( twccPacketInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    TEST_ASSERT_EQUAL( TWCC_LONG_PACKET_INFO_ARRAY_LENGTH,
+                       twccManager.count );
+    TEST_ASSERT_EQUAL_UINT64( ( uint64_t ) seqNum + TWCC_LONG_PACKET_INFO_ARRAY_LENGTH - 1,
+                              twccManager.newestExtendedSeqNum );
+
+    /* The oldest packet is more than half of the sequence number range behind
+     * the newest one, so its 16-bit sequence number refers to a packet not
+     * sent yet. */
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+
+    result = RtcpTwccManager_FindPacketInfoExtended( &( twccManager ),
+                                                     seqNum,
+                                                     &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( sentTime,
+                              pFoundTwccPacketInfo->localSentTime );
+
+    /* Older than the oldest one and newer than the newest one. */
+    result = RtcpTwccManager_FindPacketInfoExtended( &( twccManager ),
+                                                     seqNum - 1,
+                                                     &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+
+    result = RtcpTwccManager_FindPacketInfoExtended( &( twccManager ),
+                                                     ( uint64_t ) seqNum + TWCC_LONG_PACKET_INFO_ARRAY_LENGTH,
+                                                     &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+
+    /* A recent packet across the wrap is found with its 16-bit sequence
+     * number. */
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             ( uint16_t ) ( seqNum + TWCC_LONG_PACKET_INFO_ARRAY_LENGTH - 10 ),
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( sentTime + TWCC_LONG_PACKET_INFO_ARRAY_LENGTH - 10,
+                              pFoundTwccPacketInfo->localSentTime );
+
+    /* Feedback for the two newest packets. */
+    arrivalInfoList[ 0 ].seqNum = ( uint16_t ) ( seqNum + TWCC_LONG_PACKET_INFO_ARRAY_LENGTH - 2 );
+    arrivalInfoList[ 0 ].remoteArrivalTime = 2 * sentTime;
+    arrivalInfoList[ 1 ].seqNum = ( uint16_t ) ( seqNum + TWCC_LONG_PACKET_INFO_ARRAY_LENGTH - 1 );
+    arrivalInfoList[ 1 ].remoteArrivalTime = 2 * sentTime + 1;
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+    twccPacket.arrivalInfoListLength = 2;
+
+    result = RtcpTwccManager_HandleTwccPacket( &( twccManager ),
+                                               &( twccPacket ),
+                                               &( bandwidthInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       bandwidthInfo.receivedPackets );
+    TEST_ASSERT_EQUAL( 2,
+                       bandwidthInfo.duration );
+
+    /* Only supported in the sequence number indexed mode. */
+    result = RtcpTwccManager_Init( &( twccManager ),
+                                   &( twccPacketInfoArray[ 0 ] ),
+                                   TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    result = RtcpTwccManager_FindPacketInfoExtended( &( twccManager ),
+                                                     seqNum,
+                                                     &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Twcc Manager Set Time Window fail functionality for Bad
+ * Parameters.
+ */
+void test_twccSetTimeWindow_BadParams( void )
+{
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+
+    result = RtcpTwccManager_SetTimeWindow( NULL,
+                                            RTCP_TWCC_ESTIMATOR_TIME_WINDOW );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccManager_Init( &( twccManager ),
+                                   &( twccPacketInfoArray[ 0 ] ),
+                                   TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( RTCP_TWCC_ESTIMATOR_TIME_WINDOW,
+                              twccManager.timeWindow );
+
+    result = RtcpTwccManager_SetTimeWindow( &( twccManager ),
+                                            0 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that packet infos are deleted according to the time window
+ * set on the manager.
+ */
+void test_twccOlderPacketInfoDeletion_TimeWindow( void )
+{
+    uint16_t seqNum = 256;
+    uint32_t i;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    TwccPacketInfo_t twccPacketInfo = { 0 };
+    TwccPacketInfo_t * pFoundTwccPacketInfo;
+    uint64_t sentTime = RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND;
+
+    result = RtcpTwccManager_Init( &( twccManager ),
+                                   &( twccPacketInfoArray[ 0 ] ),
+                                   TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    result = RtcpTwccManager_SetTimeWindow( &( twccManager ),
+                                            10 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* One packet every 2 units of time. A packet is deleted once it is more
+     * than 10 units older than the newest one, so 6 packets are kept. */
+    for( i = 0; i < TWCC_PACKET_INFO_ARRAY_LENGTH; i++ )
+    {
+        twccPacketInfo.packetSize = 100;
+        twccPacketInfo.localSentTime = sentTime + ( ( uint64_t ) i * 2 );
+        twccPacketInfo.packetSeqNum = seqNum + ( uint16_t ) i;
+
+        result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                                &( twccPacketInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( ( i < 6 ) ? ( i + 1 ) : 6,
+                           twccManager.count );
+    }
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + TWCC_PACKET_INFO_ARRAY_LENGTH - 7,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + TWCC_PACKET_INFO_ARRAY_LENGTH - 6,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the lazy eviction mode keeps the same packet infos as
+ * the default mode, without clearing the evicted slots.
+ */
+void test_twccAddPacket_LazyEviction( void )
+{
+    uint16_t seqNum = 65500;
+    uint32_t i, j;
+    RtcpTwccManager_t twccManager, lazyTwccManager;
+    RtcpTwccManagerResult_t result;
+    TwccPacketInfo_t twccPacketInfo = { 0 };
+    TwccPacketInfo_t lazyTwccPacketInfoArray[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
+    TwccPacketInfo_t * pFoundTwccPacketInfo, * pLazyFoundTwccPacketInfo;
+    uint64_t sentTime = RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND;
+    /* Sent time increments, including bursts and pauses longer than the
+     * time window. */
+    const uint64_t sentTimeIncrements[] = { 1, 0, 3, 2, 0, 0, 7, 25, 1, 4 };
+
+    result = RtcpTwccManager_Init( &( twccManager ),
+                                   &( twccPacketInfoArray[ 0 ] ),
+                                   TWCC_PACKET_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    result = RtcpTwccManager_InitWithFlags( &( lazyTwccManager ),
+                                            &( lazyTwccPacketInfoArray[ 0 ] ),
+                                            TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                            RTCP_TWCC_MANAGER_FLAG_LAZY_EVICTION );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    ( void ) RtcpTwccManager_SetTimeWindow( &( twccManager ), 20 );
+    ( void ) RtcpTwccManager_SetTimeWindow( &( lazyTwccManager ), 20 );
+
+    for( i = 0; i < 200; i++ )
+    {
+        sentTime += sentTimeIncrements[ i % ( sizeof( sentTimeIncrements ) / sizeof( sentTimeIncrements[ 0 ] ) ) ];
+        twccPacketInfo.packetSize = 100 + i;
+        twccPacketInfo.localSentTime = sentTime;
+        twccPacketInfo.packetSeqNum = ( uint16_t ) ( seqNum + i );
+
+        result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                                &( twccPacketInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+
+        result = RtcpTwccManager_AddPacketInfo( &( lazyTwccManager ),
+                                                &( twccPacketInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( twccManager.count,
+                           lazyTwccManager.count );
+        TEST_ASSERT_EQUAL( twccManager.readIndex,
+                           lazyTwccManager.readIndex );
+
+        for( j = 0; j < twccManager.count; j++ )
+        {
+            result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                                     ( uint16_t ) ( seqNum + i - j ),
+                                                     &( pFoundTwccPacketInfo ) );
+
+            TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                               result );
+
+            result = RtcpTwccManager_FindPacketInfo( &( lazyTwccManager ),
+                                                     ( uint16_t ) ( seqNum + i - j ),
+                                                     &( pLazyFoundTwccPacketInfo ) );
+
+            TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                               result );
+            TEST_ASSERT_EQUAL_UINT64( pFoundTwccPacketInfo->localSentTime,
+                                      pLazyFoundTwccPacketInfo->localSentTime );
+            TEST_ASSERT_EQUAL( pFoundTwccPacketInfo->packetSize,
+                               pLazyFoundTwccPacketInfo->packetSize );
+        }
+    }
+
+    /* Evicted slots keep their stale contents. */
+    TEST_ASSERT_EQUAL( 0,
+                       twccPacketInfoArray[ WRAP_TEST_INDEX( twccManager.readIndex + TWCC_PACKET_INFO_ARRAY_LENGTH - 1 ) ].localSentTime );
+    TEST_ASSERT_TRUE( lazyTwccPacketInfoArray[ WRAP_TEST_INDEX( lazyTwccManager.readIndex + TWCC_PACKET_INFO_ARRAY_LENGTH - 1 ) ].localSentTime != 0 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the lazy eviction mode with the slots reserved for skipped
+ * sequence numbers in the sequence number indexed mode.
+ */
+void test_twccAddPacket_LazyEvictionSeqNumIndexedGap( void )
+{
+    uint16_t seqNum = 256;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    TwccPacketInfo_t twccPacketInfo = { 0 };
+    TwccPacketInfo_t * pFoundTwccPacketInfo;
+    uint64_t sentTime = RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND;
+
+    result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                            &( twccPacketInfoArray[ 0 ] ),
+                                            TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                            RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED |
+                                            RTCP_TWCC_MANAGER_FLAG_LAZY_EVICTION );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    result = RtcpTwccManager_SetTimeWindow( &( twccManager ),
+                                            10 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* Packets seqNum, seqNum + 4 (3 reserved slots) and seqNum + 5. */
+    twccPacketInfo.packetSize = 100;
+    twccPacketInfo.localSentTime = sentTime;
+    twccPacketInfo.packetSeqNum = seqNum;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( twccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    twccPacketInfo.localSentTime = sentTime + 5;
+    twccPacketInfo.packetSeqNum = seqNum + 4;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( twccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 5,
+                       twccManager.count );
+
+    twccPacketInfo.localSentTime = sentTime + 11;
+    twccPacketInfo.packetSeqNum = seqNum + 5;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( twccPacketInfo ) );
+
+    /* Only the first packet is older than the time window. The reserved slots
+     * take the sent time of seqNum + 4 and are kept. */
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 5,
+                       twccManager.count );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + 4,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT64( sentTime + 5,
+                              pFoundTwccPacketInfo->localSentTime );
+
+    /* A packet newer than the time window evicts everything but itself. */
+    twccPacketInfo.localSentTime = sentTime + 30;
+    twccPacketInfo.packetSeqNum = seqNum + 6;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( twccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1,
+                       twccManager.count );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + 6,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the lazy eviction search when the exponential probes
+ * overshoot the expired packet infos, and when the reserved slots before the
+ * newest packet info take its sent time.
+ */
+void test_twccAddPacket_LazyEvictionSearchBoundaries( void )
+{
+    uint16_t seqNum = 256;
+    uint32_t i;
+    RtcpTwccManager_t twccManager;
+    RtcpTwccManagerResult_t result;
+    TwccPacketInfo_t twccPacketInfo = { 0 };
+    TwccPacketInfo_t * pFoundTwccPacketInfo;
+    uint64_t sentTime = RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND;
+
+    result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                            &( twccPacketInfoArray[ 0 ] ),
+                                            TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                            RTCP_TWCC_MANAGER_FLAG_LAZY_EVICTION );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* 5 packets which expire below and 4 which do not, added with the
+     * default time window. */
+    for( i = 0; i < 9; i++ )
+    {
+        twccPacketInfo.packetSize = 100;
+        twccPacketInfo.localSentTime = ( i < 5 ) ? sentTime : sentTime + 15;
+        twccPacketInfo.packetSeqNum = ( uint16_t ) ( seqNum + i );
+
+        result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                                &( twccPacketInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    result = RtcpTwccManager_SetTimeWindow( &( twccManager ),
+                                            10 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* The probes at offsets 0, 1 and 3 are expired and the one at offset 7 is
+     * not, so the search bisects offsets 4 to 7. */
+    twccPacketInfo.localSentTime = sentTime + 20;
+    twccPacketInfo.packetSeqNum = seqNum + 9;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( twccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 5,
+                       twccManager.count );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + 4,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + 5,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    result = RtcpTwccManager_InitWithFlags( &( twccManager ),
+                                            &( twccPacketInfoArray[ 0 ] ),
+                                            TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                            RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED |
+                                            RTCP_TWCC_MANAGER_FLAG_LAZY_EVICTION );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    result = RtcpTwccManager_SetTimeWindow( &( twccManager ),
+                                            10 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    /* Packets seqNum and seqNum + 1, then seqNum + 5 with 3 reserved slots
+     * before it. */
+    for( i = 0; i < 2; i++ )
+    {
+        twccPacketInfo.localSentTime = sentTime + ( 5 * i );
+        twccPacketInfo.packetSeqNum = ( uint16_t ) ( seqNum + i );
+
+        result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                                &( twccPacketInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    twccPacketInfo.localSentTime = sentTime + 30;
+    twccPacketInfo.packetSeqNum = seqNum + 5;
+
+    result = RtcpTwccManager_AddPacketInfo( &( twccManager ),
+                                            &( twccPacketInfo ) );
+
+    /* Both packets are evicted. The reserved slots take the sent time of the
+     * newest packet info and are kept. */
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 4,
+                       twccManager.count );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + 1,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+
+    result = RtcpTwccManager_FindPacketInfo( &( twccManager ),
+                                             seqNum + 5,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
@@ -28,6 +28,7 @@ list(APPEND mock_define_list
 # List the files you would like to test here.
 list(APPEND real_source_files
             ${MODULE_ROOT_DIR}/source/rtcp_twcc_manager.c
+            ${MODULE_ROOT_DIR}/source/rtcp_delay_based_estimator.c
             ${MODULE_ROOT_DIR}/source/rtcp_api.c
             ${MODULE_ROOT_DIR}/source/rtcp_endianness.c
         )
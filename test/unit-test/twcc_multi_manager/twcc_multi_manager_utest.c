@@ -0,0 +1,637 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "rtcp_twcc_multi_manager.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define SESSION_ARRAY_LENGTH                  4
+#define TWCC_PACKET_INFO_ARRAY_LENGTH         16
+#define TWCC_PACKET_INFO_SLAB_LENGTH          ( SESSION_ARRAY_LENGTH * TWCC_PACKET_INFO_ARRAY_LENGTH )
+
+RtcpTwccMultiManager_t twccMultiManager;
+RtcpTwccSession_t sessionArray[ SESSION_ARRAY_LENGTH ];
+TwccPacketInfo_t twccPacketInfoSlab[ TWCC_PACKET_INFO_SLAB_LENGTH ];
+
+void setUp( void )
+{
+    RtcpTwccManagerResult_t result;
+
+    result = RtcpTwccMultiManager_Init( &( twccMultiManager ),
+                                        &( sessionArray[ 0 ] ),
+                                        SESSION_ARRAY_LENGTH,
+                                        &( twccPacketInfoSlab[ 0 ] ),
+                                        TWCC_PACKET_INFO_SLAB_LENGTH,
+                                        TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                        RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate TWCC Multi Manager Init fail functionality for Bad
+ * Parameters.
+ */
+void test_twccMultiManagerInit_BadParams( void )
+{
+    RtcpTwccMultiManager_t multiManager;
+    RtcpTwccManagerResult_t result;
+
+    result = RtcpTwccMultiManager_Init( NULL,
+                                        &( sessionArray[ 0 ] ),
+                                        SESSION_ARRAY_LENGTH,
+                                        &( twccPacketInfoSlab[ 0 ] ),
+                                        TWCC_PACKET_INFO_SLAB_LENGTH,
+                                        TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                        RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccMultiManager_Init( &( multiManager ),
+                                        NULL,
+                                        SESSION_ARRAY_LENGTH,
+                                        &( twccPacketInfoSlab[ 0 ] ),
+                                        TWCC_PACKET_INFO_SLAB_LENGTH,
+                                        TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                        RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccMultiManager_Init( &( multiManager ),
+                                        &( sessionArray[ 0 ] ),
+                                        0,
+                                        &( twccPacketInfoSlab[ 0 ] ),
+                                        TWCC_PACKET_INFO_SLAB_LENGTH,
+                                        TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                        RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccMultiManager_Init( &( multiManager ),
+                                        &( sessionArray[ 0 ] ),
+                                        RTCP_TWCC_MULTI_MANAGER_MAX_SESSIONS + 1,
+                                        &( twccPacketInfoSlab[ 0 ] ),
+                                        TWCC_PACKET_INFO_SLAB_LENGTH,
+                                        TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                        RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccMultiManager_Init( &( multiManager ),
+                                        &( sessionArray[ 0 ] ),
+                                        SESSION_ARRAY_LENGTH,
+                                        NULL,
+                                        TWCC_PACKET_INFO_SLAB_LENGTH,
+                                        TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                        RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccMultiManager_Init( &( multiManager ),
+                                        &( sessionArray[ 0 ] ),
+                                        SESSION_ARRAY_LENGTH,
+                                        &( twccPacketInfoSlab[ 0 ] ),
+                                        TWCC_PACKET_INFO_SLAB_LENGTH,
+                                        0,
+                                        RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    /* The slab is too short for all the sessions. */
+    result = RtcpTwccMultiManager_Init( &( multiManager ),
+                                        &( sessionArray[ 0 ] ),
+                                        SESSION_ARRAY_LENGTH,
+                                        &( twccPacketInfoSlab[ 0 ] ),
+                                        TWCC_PACKET_INFO_SLAB_LENGTH - 1,
+                                        TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                        RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    /* sessionArrayLength * twccPacketInfoArrayLength overflows. */
+    result = RtcpTwccMultiManager_Init( &( multiManager ),
+                                        &( sessionArray[ 0 ] ),
+                                        SESSION_ARRAY_LENGTH,
+                                        &( twccPacketInfoSlab[ 0 ] ),
+                                        TWCC_PACKET_INFO_SLAB_LENGTH,
+                                        ( SIZE_MAX / 2 ) + 1,
+                                        RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    /* Not a power of two. */
+    result = RtcpTwccMultiManager_Init( &( multiManager ),
+                                        &( sessionArray[ 0 ] ),
+                                        SESSION_ARRAY_LENGTH,
+                                        &( twccPacketInfoSlab[ 0 ] ),
+                                        TWCC_PACKET_INFO_SLAB_LENGTH,
+                                        TWCC_PACKET_INFO_ARRAY_LENGTH - 1,
+                                        RTCP_TWCC_MANAGER_FLAG_POWER_OF_TWO_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate TWCC Multi Manager open and close session functionality.
+ */
+void test_twccMultiManager_OpenCloseSession( void )
+{
+    RtcpTwccManagerResult_t result;
+    RtcpTwccSessionHandle_t sessionHandles[ SESSION_ARRAY_LENGTH ], sessionHandle;
+    RtcpTwccManager_t * pTwccManager;
+    size_t i;
+
+    result = RtcpTwccMultiManager_OpenSession( NULL,
+                                               &( sessionHandle ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccMultiManager_OpenSession( &( twccMultiManager ),
+                                               NULL );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    for( i = 0; i < SESSION_ARRAY_LENGTH; i++ )
+    {
+        result = RtcpTwccMultiManager_OpenSession( &( twccMultiManager ),
+                                                   &( sessionHandles[ i ] ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+
+        result = RtcpTwccMultiManager_GetManager( &( twccMultiManager ),
+                                                  sessionHandles[ i ],
+                                                  &( pTwccManager ) );
+
+        /* Each session uses its own slice of the slab. */
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL_PTR( &( twccPacketInfoSlab[ i * TWCC_PACKET_INFO_ARRAY_LENGTH ] ),
+                               pTwccManager->pTwccPacketInfoArray );
+        TEST_ASSERT_EQUAL( TWCC_PACKET_INFO_ARRAY_LENGTH,
+                           pTwccManager->twccPacketInfoArrayLength );
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_FLAG_SEQ_NUM_INDEXED,
+                           pTwccManager->flags );
+    }
+
+    TEST_ASSERT_EQUAL( SESSION_ARRAY_LENGTH,
+                       twccMultiManager.openSessionCount );
+
+    result = RtcpTwccMultiManager_OpenSession( &( twccMultiManager ),
+                                               &( sessionHandle ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_FULL,
+                       result );
+
+    result = RtcpTwccMultiManager_CloseSession( NULL,
+                                                sessionHandles[ 1 ] );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccMultiManager_CloseSession( &( twccMultiManager ),
+                                                sessionHandles[ 1 ] );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( SESSION_ARRAY_LENGTH - 1,
+                       twccMultiManager.openSessionCount );
+
+    /* Closing twice fails. */
+    result = RtcpTwccMultiManager_CloseSession( &( twccMultiManager ),
+                                                sessionHandles[ 1 ] );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    /* The closed session is reused with a new handle. */
+    result = RtcpTwccMultiManager_OpenSession( &( twccMultiManager ),
+                                               &( sessionHandle ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_TRUE( sessionHandle != sessionHandles[ 1 ] );
+    TEST_ASSERT_EQUAL( sessionHandles[ 1 ] & 0xFFFF,
+                       sessionHandle & 0xFFFF );
+
+    /* The stale handle is rejected. */
+    result = RtcpTwccMultiManager_GetManager( &( twccMultiManager ),
+                                              sessionHandles[ 1 ],
+                                              &( pTwccManager ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccMultiManager_GetManager( &( twccMultiManager ),
+                                              SESSION_ARRAY_LENGTH,
+                                              &( pTwccManager ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccMultiManager_GetManager( &( twccMultiManager ),
+                                              sessionHandle,
+                                              NULL );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate TWCC Multi Manager bulk add and bulk TWCC packet handling
+ * functionality.
+ */
+void test_twccMultiManager_AddAndHandle( void )
+{
+    RtcpTwccManagerResult_t result;
+    RtcpTwccSessionHandle_t sessionHandles[ 2 ];
+    RtcpTwccSessionPacketInfo_t sessionPacketInfos[ 6 ];
+    RtcpTwccSessionTwccPacket_t sessionTwccPackets[ 3 ];
+    RtcpTwccPacket_t twccPacket;
+    PacketArrivalInfo_t arrivalInfoList[ 3 ];
+    RtcpTwccManager_t * pTwccManager;
+    TwccPacketInfo_t * pFoundTwccPacketInfo;
+    uint64_t sentTime = RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND;
+    size_t i;
+
+    for( i = 0; i < 2; i++ )
+    {
+        result = RtcpTwccMultiManager_OpenSession( &( twccMultiManager ),
+                                                   &( sessionHandles[ i ] ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    /* Packets of both sessions are interleaved, with the same sequence
+     * numbers but different sizes. */
+    for( i = 0; i < 6; i++ )
+    {
+        sessionPacketInfos[ i ].sessionHandle = sessionHandles[ i % 2 ];
+        sessionPacketInfos[ i ].twccPacketInfo.packetSeqNum = ( uint16_t ) ( 100 + ( i / 2 ) );
+        sessionPacketInfos[ i ].twccPacketInfo.localSentTime = sentTime + i;
+        sessionPacketInfos[ i ].twccPacketInfo.packetSize = 1000 * ( ( i % 2 ) + 1 );
+    }
+
+    result = RtcpTwccMultiManager_AddPacketInfos( NULL,
+                                                  &( sessionPacketInfos[ 0 ] ),
+                                                  6 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccMultiManager_AddPacketInfos( &( twccMultiManager ),
+                                                  NULL,
+                                                  6 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    /* An invalid handle in the batch rejects the whole batch. */
+    sessionPacketInfos[ 5 ].sessionHandle = SESSION_ARRAY_LENGTH - 1;
+
+    result = RtcpTwccMultiManager_AddPacketInfos( &( twccMultiManager ),
+                                                  &( sessionPacketInfos[ 0 ] ),
+                                                  6 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       sessionArray[ 0 ].twccManager.count );
+
+    sessionPacketInfos[ 5 ].sessionHandle = sessionHandles[ 1 ];
+
+    result = RtcpTwccMultiManager_AddPacketInfos( &( twccMultiManager ),
+                                                  &( sessionPacketInfos[ 0 ] ),
+                                                  6 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    for( i = 0; i < 2; i++ )
+    {
+        result = RtcpTwccMultiManager_GetManager( &( twccMultiManager ),
+                                                  sessionHandles[ i ],
+                                                  &( pTwccManager ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( 3,
+                           pTwccManager->count );
+
+        result = RtcpTwccManager_FindPacketInfo( pTwccManager,
+                                                 101,
+                                                 &( pFoundTwccPacketInfo ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( 1000 * ( i + 1 ),
+                           pFoundTwccPacketInfo->packetSize );
+    }
+
+    /* Packet 101 is lost. */
+    arrivalInfoList[ 0 ].seqNum = 100;
+    arrivalInfoList[ 0 ].remoteArrivalTime = 2 * sentTime;
+    arrivalInfoList[ 1 ].seqNum = 101;
+    arrivalInfoList[ 1 ].remoteArrivalTime = RTCP_TWCC_PACKET_LOST_TIME;
+    arrivalInfoList[ 2 ].seqNum = 102;
+    arrivalInfoList[ 2 ].remoteArrivalTime = 2 * sentTime + 4;
+    memset( &( twccPacket ),
+            0,
+            sizeof( RtcpTwccPacket_t ) );
+    twccPacket.pArrivalInfoList = &( arrivalInfoList[ 0 ] );
+    twccPacket.arrivalInfoListLength = 3;
+
+    sessionTwccPackets[ 0 ].sessionHandle = sessionHandles[ 0 ];
+    sessionTwccPackets[ 0 ].pTwccPacket = &( twccPacket );
+    sessionTwccPackets[ 1 ].sessionHandle = SESSION_ARRAY_LENGTH - 1;
+    sessionTwccPackets[ 1 ].pTwccPacket = &( twccPacket );
+    sessionTwccPackets[ 2 ].sessionHandle = sessionHandles[ 1 ];
+    sessionTwccPackets[ 2 ].pTwccPacket = &( twccPacket );
+
+    result = RtcpTwccMultiManager_HandleTwccPackets( NULL,
+                                                     &( sessionTwccPackets[ 0 ] ),
+                                                     3 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccMultiManager_HandleTwccPackets( &( twccMultiManager ),
+                                                     &( sessionTwccPackets[ 0 ] ),
+                                                     3 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       sessionTwccPackets[ 0 ].result );
+    TEST_ASSERT_EQUAL( 3,
+                       sessionTwccPackets[ 0 ].bandwidthInfo.sentPackets );
+    TEST_ASSERT_EQUAL( 2,
+                       sessionTwccPackets[ 0 ].bandwidthInfo.receivedPackets );
+    TEST_ASSERT_EQUAL( 3000,
+                       sessionTwccPackets[ 0 ].bandwidthInfo.sentBytes );
+    TEST_ASSERT_EQUAL( 2000,
+                       sessionTwccPackets[ 0 ].bandwidthInfo.receivedBytes );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       sessionTwccPackets[ 1 ].result );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       sessionTwccPackets[ 2 ].result );
+    TEST_ASSERT_EQUAL( 6000,
+                       sessionTwccPackets[ 2 ].bandwidthInfo.sentBytes );
+    TEST_ASSERT_EQUAL( 4000,
+                       sessionTwccPackets[ 2 ].bandwidthInfo.receivedBytes );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate TWCC Multi Manager get manager, bulk add and bulk TWCC
+ * packet handling fail functionality for Bad Parameters, and empty batches.
+ */
+void test_twccMultiManager_BadParamsAndEmptyBatches( void )
+{
+    RtcpTwccManagerResult_t result;
+    RtcpTwccSessionHandle_t sessionHandle;
+    RtcpTwccManager_t * pTwccManager;
+
+    result = RtcpTwccMultiManager_OpenSession( &( twccMultiManager ),
+                                               &( sessionHandle ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    result = RtcpTwccMultiManager_GetManager( NULL,
+                                              sessionHandle,
+                                              &( pTwccManager ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccMultiManager_HandleTwccPackets( &( twccMultiManager ),
+                                                     NULL,
+                                                     1 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccMultiManager_AddPacketInfos( &( twccMultiManager ),
+                                                  NULL,
+                                                  0 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    result = RtcpTwccMultiManager_HandleTwccPackets( &( twccMultiManager ),
+                                                     NULL,
+                                                     0 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate TWCC Multi Manager bulk add returns the first error of the
+ * managers, and adds the other packet infos.
+ */
+void test_twccMultiManager_AddPacketInfos_FirstError( void )
+{
+    RtcpTwccManagerResult_t result;
+    RtcpTwccSessionHandle_t sessionHandles[ 2 ];
+    RtcpTwccSessionPacketInfo_t sessionPacketInfos[ 4 ];
+    RtcpTwccManager_t * pTwccManager;
+    TwccPacketInfo_t * pFoundTwccPacketInfo;
+    TwccCompactPacketInfoArrays_t compactArrays;
+    uint16_t seqNumArray[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
+    uint32_t relativeSentTimeArray[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
+    uint16_t packetSizeArray[ TWCC_PACKET_INFO_ARRAY_LENGTH ];
+    size_t i;
+
+    for( i = 0; i < 2; i++ )
+    {
+        result = RtcpTwccMultiManager_OpenSession( &( twccMultiManager ),
+                                                   &( sessionHandles[ i ] ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    /* The packet sizes of the second session must fit in 16 bits. */
+    compactArrays.pSeqNumArray = &( seqNumArray[ 0 ] );
+    compactArrays.pRelativeSentTimeArray = &( relativeSentTimeArray[ 0 ] );
+    compactArrays.pPacketSizeArray = &( packetSizeArray[ 0 ] );
+
+    result = RtcpTwccMultiManager_GetManager( &( twccMultiManager ),
+                                              sessionHandles[ 1 ],
+                                              &( pTwccManager ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    result = RtcpTwccManager_InitCompact( pTwccManager,
+                                          &( compactArrays ),
+                                          TWCC_PACKET_INFO_ARRAY_LENGTH,
+                                          RTCP_TWCC_MANAGER_FLAG_NONE );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    for( i = 0; i < 4; i++ )
+    {
+        sessionPacketInfos[ i ].sessionHandle = sessionHandles[ i % 2 ];
+        sessionPacketInfos[ i ].twccPacketInfo.packetSeqNum = ( uint16_t ) ( 100 + ( i / 2 ) );
+        sessionPacketInfos[ i ].twccPacketInfo.localSentTime = RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND + i;
+        sessionPacketInfos[ i ].twccPacketInfo.packetSize = 1000;
+    }
+
+    sessionPacketInfos[ 1 ].twccPacketInfo.packetSize = UINT16_MAX + 1;
+
+    result = RtcpTwccMultiManager_AddPacketInfos( &( twccMultiManager ),
+                                                  &( sessionPacketInfos[ 0 ] ),
+                                                  4 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       sessionArray[ 0 ].twccManager.count );
+    TEST_ASSERT_EQUAL( 1,
+                       pTwccManager->count );
+
+    result = RtcpTwccManager_FindPacketInfo( pTwccManager,
+                                             101,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+
+    result = RtcpTwccManager_FindPacketInfo( pTwccManager,
+                                             100,
+                                             &( pFoundTwccPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_PACKET_NOT_FOUND,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate TWCC Multi Manager reuse of the last closed session, with
+ * an empty history, and rejection of its stale handle by the bulk functions.
+ */
+void test_twccMultiManager_SessionReuse( void )
+{
+    RtcpTwccManagerResult_t result;
+    RtcpTwccSessionHandle_t sessionHandles[ 3 ], sessionHandle;
+    RtcpTwccSessionPacketInfo_t sessionPacketInfo;
+    RtcpTwccSessionTwccPacket_t sessionTwccPacket;
+    RtcpTwccPacket_t twccPacket;
+    size_t i;
+
+    for( i = 0; i < 3; i++ )
+    {
+        result = RtcpTwccMultiManager_OpenSession( &( twccMultiManager ),
+                                                   &( sessionHandles[ i ] ) );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    sessionPacketInfo.sessionHandle = sessionHandles[ 0 ];
+    sessionPacketInfo.twccPacketInfo.packetSeqNum = 100;
+    sessionPacketInfo.twccPacketInfo.localSentTime = RTCP_TWCC_HUNDREDS_OF_NANOS_IN_A_SECOND;
+    sessionPacketInfo.twccPacketInfo.packetSize = 1000;
+
+    result = RtcpTwccMultiManager_AddPacketInfos( &( twccMultiManager ),
+                                                  &( sessionPacketInfo ),
+                                                  1 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1,
+                       sessionArray[ 0 ].twccManager.count );
+
+    /* The last closed session is opened first. */
+    for( i = 0; i < 2; i++ )
+    {
+        result = RtcpTwccMultiManager_CloseSession( &( twccMultiManager ),
+                                                    sessionHandles[ i ] );
+
+        TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                           result );
+    }
+
+    result = RtcpTwccMultiManager_OpenSession( &( twccMultiManager ),
+                                               &( sessionHandle ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1,
+                       sessionHandle & 0xFFFF );
+
+    result = RtcpTwccMultiManager_OpenSession( &( twccMultiManager ),
+                                               &( sessionHandle ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       sessionHandle & 0xFFFF );
+    TEST_ASSERT_EQUAL( 0,
+                       sessionArray[ 0 ].twccManager.count );
+
+    /* The stale handle of the reused session is rejected. */
+    result = RtcpTwccMultiManager_AddPacketInfos( &( twccMultiManager ),
+                                                  &( sessionPacketInfo ),
+                                                  1 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       sessionArray[ 0 ].twccManager.count );
+
+    memset( &( twccPacket ),
+            0,
+            sizeof( RtcpTwccPacket_t ) );
+    sessionTwccPacket.sessionHandle = sessionHandles[ 0 ];
+    sessionTwccPacket.pTwccPacket = &( twccPacket );
+
+    result = RtcpTwccMultiManager_HandleTwccPackets( &( twccMultiManager ),
+                                                     &( sessionTwccPacket ),
+                                                     1 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( RTCP_TWCC_MANAGER_RESULT_BAD_PARAM,
+                       sessionTwccPacket.result );
+}
+
+/*-----------------------------------------------------------*/
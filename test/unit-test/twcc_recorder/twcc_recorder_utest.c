@@ -0,0 +1,302 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* API includes. */
+#include "rtcp_api.h"
+#include "rtcp_twcc_recorder.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define ARRIVAL_INFO_ARRAY_LENGTH    16
+
+RtcpTwccRecorder_t twccRecorder;
+PacketArrivalInfo_t arrivalInfoArray[ ARRIVAL_INFO_ARRAY_LENGTH ];
+
+void setUp( void )
+{
+    RtcpTwccRecorderResult_t result;
+
+    result = RtcpTwccRecorder_Init( &( twccRecorder ),
+                                    &( arrivalInfoArray[ 0 ] ),
+                                    ARRIVAL_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                       result );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate TWCC Recorder fail functionality for Bad Parameters.
+ */
+void test_twccRecorder_BadParams( void )
+{
+    RtcpTwccRecorder_t recorder;
+    RtcpTwccPacket_t twccPacket;
+    RtcpTwccRecorderResult_t result;
+
+    result = RtcpTwccRecorder_Init( NULL,
+                                    &( arrivalInfoArray[ 0 ] ),
+                                    ARRIVAL_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccRecorder_Init( &( recorder ),
+                                    NULL,
+                                    ARRIVAL_INFO_ARRAY_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccRecorder_Init( &( recorder ),
+                                    &( arrivalInfoArray[ 0 ] ),
+                                    0 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccRecorder_RecordPacket( NULL,
+                                            1,
+                                            1000 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccRecorder_RecordPacket( &( twccRecorder ),
+                                            1,
+                                            RTCP_TWCC_PACKET_LOST_TIME );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccRecorder_GetTwccPacket( NULL,
+                                             &( twccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccRecorder_GetTwccPacket( &( twccRecorder ),
+                                             NULL );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtcpTwccRecorder_GetTwccPacket( &( twccRecorder ),
+                                             &( twccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_EMPTY,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate TWCC Recorder functionality with lost and reordered
+ * packets.
+ */
+void test_twccRecorder_GetTwccPacket( void )
+{
+    RtcpTwccPacket_t twccPacket;
+    RtcpTwccRecorderResult_t result;
+
+    /* 65534, 65535, 0 and 2 arrive in order, then 1 late. 3 and 4 are lost. */
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                       RtcpTwccRecorder_RecordPacket( &( twccRecorder ), 65534, 1000000 ) );
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                       RtcpTwccRecorder_RecordPacket( &( twccRecorder ), 65535, 1002500 ) );
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                       RtcpTwccRecorder_RecordPacket( &( twccRecorder ), 0, 1005000 ) );
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                       RtcpTwccRecorder_RecordPacket( &( twccRecorder ), 2, 1010000 ) );
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                       RtcpTwccRecorder_RecordPacket( &( twccRecorder ), 1, 1012500 ) );
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                       RtcpTwccRecorder_RecordPacket( &( twccRecorder ), 5, 1020000 ) );
+
+    result = RtcpTwccRecorder_GetTwccPacket( &( twccRecorder ),
+                                             &( twccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 65534,
+                       twccPacket.baseSeqNum );
+    TEST_ASSERT_EQUAL( 8,
+                       twccPacket.packetStatusCount );
+    TEST_ASSERT_EQUAL( 8,
+                       twccPacket.arrivalInfoListLength );
+    TEST_ASSERT_EQUAL( 1,
+                       twccPacket.referenceTime ); /* 1000000 in multiples of 64ms. */
+    TEST_ASSERT_EQUAL( 0,
+                       twccPacket.feedbackPacketCount );
+    TEST_ASSERT_EQUAL_PTR( &( arrivalInfoArray[ 0 ] ),
+                           twccPacket.pArrivalInfoList );
+
+    TEST_ASSERT_EQUAL( 1,
+                       twccPacket.pArrivalInfoList[ 3 ].seqNum );
+    TEST_ASSERT_EQUAL_UINT64( 1012500,
+                              twccPacket.pArrivalInfoList[ 3 ].remoteArrivalTime );
+    TEST_ASSERT_EQUAL( 3,
+                       twccPacket.pArrivalInfoList[ 5 ].seqNum );
+    TEST_ASSERT_EQUAL_UINT64( RTCP_TWCC_PACKET_LOST_TIME,
+                              twccPacket.pArrivalInfoList[ 5 ].remoteArrivalTime );
+    TEST_ASSERT_EQUAL( 4,
+                       twccPacket.pArrivalInfoList[ 6 ].seqNum );
+    TEST_ASSERT_EQUAL_UINT64( RTCP_TWCC_PACKET_LOST_TIME,
+                              twccPacket.pArrivalInfoList[ 6 ].remoteArrivalTime );
+    TEST_ASSERT_EQUAL( 5,
+                       twccPacket.pArrivalInfoList[ 7 ].seqNum );
+
+    result = RtcpTwccRecorder_GetTwccPacket( &( twccRecorder ),
+                                             &( twccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_EMPTY,
+                       result );
+
+    /* 4 arrives after it was reported, and is ignored. The next TWCC packet
+     * starts after 5, with 6 lost. */
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                       RtcpTwccRecorder_RecordPacket( &( twccRecorder ), 4, 1700000 ) );
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                       RtcpTwccRecorder_RecordPacket( &( twccRecorder ), 7, 1702500 ) );
+
+    result = RtcpTwccRecorder_GetTwccPacket( &( twccRecorder ),
+                                             &( twccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 6,
+                       twccPacket.baseSeqNum );
+    TEST_ASSERT_EQUAL( 2,
+                       twccPacket.packetStatusCount );
+    TEST_ASSERT_EQUAL( 2,
+                       twccPacket.referenceTime );
+    TEST_ASSERT_EQUAL( 1,
+                       twccPacket.feedbackPacketCount );
+    TEST_ASSERT_EQUAL_UINT64( RTCP_TWCC_PACKET_LOST_TIME,
+                              twccPacket.pArrivalInfoList[ 0 ].remoteArrivalTime );
+    TEST_ASSERT_EQUAL_UINT64( 1702500,
+                              twccPacket.pArrivalInfoList[ 1 ].remoteArrivalTime );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate TWCC Recorder functionality when the array is full.
+ */
+void test_twccRecorder_Full( void )
+{
+    RtcpTwccPacket_t twccPacket;
+    RtcpTwccRecorderResult_t result;
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                       RtcpTwccRecorder_RecordPacket( &( twccRecorder ), 100, 1000000 ) );
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                       RtcpTwccRecorder_RecordPacket( &( twccRecorder ), 100 + ARRIVAL_INFO_ARRAY_LENGTH - 1, 1002500 ) );
+
+    result = RtcpTwccRecorder_RecordPacket( &( twccRecorder ),
+                                            100 + ARRIVAL_INFO_ARRAY_LENGTH,
+                                            1005000 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_FULL,
+                       result );
+
+    result = RtcpTwccRecorder_GetTwccPacket( &( twccRecorder ),
+                                             &( twccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( ARRIVAL_INFO_ARRAY_LENGTH,
+                       twccPacket.packetStatusCount );
+
+    result = RtcpTwccRecorder_RecordPacket( &( twccRecorder ),
+                                            100 + ARRIVAL_INFO_ARRAY_LENGTH,
+                                            1005000 );
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a TWCC packet of a TWCC Recorder is serialized and
+ * parsed back.
+ */
+void test_twccRecorder_SerializeTwccPacket( void )
+{
+    RtcpContext_t context;
+    RtcpTwccPacket_t twccPacket, parsedTwccPacket;
+    RtcpPacket_t rtcpPacket;
+    PacketArrivalInfo_t parsedArrivalInfoList[ ARRIVAL_INFO_ARRAY_LENGTH ];
+    uint8_t buffer[ 128 ];
+    size_t bufferLength = sizeof( buffer );
+    RtcpResult_t result;
+    uint16_t i;
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       Rtcp_Init( &( context ) ) );
+
+    /* Every third packet is lost, and the arrival times are 64ms apart from
+     * an arrival time which is not a multiple of the reference time. */
+    for( i = 0; i < ARRIVAL_INFO_ARRAY_LENGTH; i++ )
+    {
+        if( ( i % 3 ) != 1 )
+        {
+            TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                               RtcpTwccRecorder_RecordPacket( &( twccRecorder ), i, 12345000ULL + ( i * 640000ULL ) ) );
+        }
+    }
+
+    TEST_ASSERT_EQUAL( RTCP_TWCC_RECORDER_RESULT_OK,
+                       RtcpTwccRecorder_GetTwccPacket( &( twccRecorder ), &( twccPacket ) ) );
+
+    twccPacket.senderSsrc = 0x12345678;
+    twccPacket.mediaSourceSsrc = 0x9ABCDEF0;
+
+    result = Rtcp_SerializeTwccPacket( &( context ),
+                                       &( twccPacket ),
+                                       &( buffer[ 0 ] ),
+                                       &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    result = Rtcp_DeserializePacket( &( context ),
+                                     &( buffer[ 0 ] ),
+                                     bufferLength,
+                                     &( rtcpPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+
+    parsedTwccPacket.pArrivalInfoList = &( parsedArrivalInfoList[ 0 ] );
+    parsedTwccPacket.arrivalInfoListLength = ARRIVAL_INFO_ARRAY_LENGTH;
+
+    result = Rtcp_ParseTwccPacket( &( context ),
+                                   &( rtcpPacket ),
+                                   &( parsedTwccPacket ) );
+
+    TEST_ASSERT_EQUAL( RTCP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0x12345678,
+                       parsedTwccPacket.senderSsrc );
+    TEST_ASSERT_EQUAL( 0x9ABCDEF0,
+                       parsedTwccPacket.mediaSourceSsrc );
+    TEST_ASSERT_EQUAL( ARRIVAL_INFO_ARRAY_LENGTH,
+                       parsedTwccPacket.arrivalInfoListLength );
+
+    for( i = 0; i < ARRIVAL_INFO_ARRAY_LENGTH; i++ )
+    {
+        TEST_ASSERT_EQUAL( i,
+                           parsedArrivalInfoList[ i ].seqNum );
+        TEST_ASSERT_EQUAL_UINT64( arrivalInfoArray[ i ].remoteArrivalTime,
+                                  parsedArrivalInfoList[ i ].remoteArrivalTime );
+    }
+}
+
+/*-----------------------------------------------------------*/